@@ -0,0 +1,84 @@
+package NginxConf;
+
+# Copyright (C) Nginx, Inc.
+#
+# the parts shared by geo2bin.pl and map2bin.pl: the tokenizer of the
+# "key value;" entries and the atomic replacement of the output file
+
+
+use warnings;
+use strict;
+
+use File::Basename qw(dirname);
+use File::Temp qw(tempfile);
+
+# returns a list of [ ';', $line ] and [ 'w', $line, $word ] tokens,
+# quoted strings are unescaped as in the configuration parser
+
+sub tokens {
+	my ($text) = @_;
+	my $line = 1;
+	my @tokens;
+
+	for (;;) {
+		if ($text =~ /\G([ \t\r]+)/gc) {
+			next;
+		}
+
+		if ($text =~ /\G\n/gc) {
+			$line++;
+			next;
+		}
+
+		if ($text =~ /\G#[^\n]*/gc) {
+			next;
+		}
+
+		last if $text =~ /\G\z/gc;
+
+		if ($text =~ /\G;/gc) {
+			push @tokens, [ ';', $line ];
+			next;
+		}
+
+		if ($text =~ /\G(["'])((?:\\.|(?!\1)[^\\])*)\1/gcs) {
+			my $s = $2;
+			$line += ($s =~ tr/\n//);
+			$s =~ s/\\([\\"'tnr])/$1 eq 't' ? "\t" : $1 eq 'n' ? "\n"
+			                      : $1 eq 'r' ? "\r" : $1/ge;
+			push @tokens, [ 'w', $line, $s ];
+			next;
+		}
+
+		if ($text =~ /\G([^\s;]+)/gc) {
+			push @tokens, [ 'w', $line, $1 ];
+			next;
+		}
+
+		die "line $line: unexpected character\n";
+	}
+
+	return @tokens;
+}
+
+# nginx maps the files into memory, so they are never changed in place:
+# the data are written to a temporary file in the same directory, which
+# is then renamed; the temporary file is removed on errors
+
+sub write_file {
+	my ($name, @data) = @_;
+
+	my ($fh, $tmp) = tempfile(".nginx.XXXXXX", DIR => dirname($name),
+	                          UNLINK => 1);
+
+	binmode $fh;
+
+	print $fh @data or die "writing \"$tmp\" failed: $!\n";
+
+	close $fh or die "writing \"$tmp\" failed: $!\n";
+	chmod 0644, $tmp or die "chmod \"$tmp\" failed: $!\n";
+	rename $tmp, $name
+		or die "renaming \"$tmp\" to \"$name\" failed: $!\n";
+}
+
+1;
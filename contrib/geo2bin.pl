@@ -0,0 +1,270 @@
+#!/usr/bin/perl -w
+
+# Copyright (C) Nginx, Inc.
+#
+# this script converts geo entries, as used inside a geo block or in an
+# included file, to the compiled format loaded with
+#
+#   geo $country {
+#       include_binary geo.bin;
+#   }
+#
+# both IPv4 and IPv6 entries are supported, as networks ("10.0.0.0/8"),
+# single addresses or ranges ("10.0.0.1-10.0.0.9", "2001:db8::-2001:db8::ff").
+# a more specific entry inside another one wins, as with the geo module,
+# partially overlapping ranges are rejected.  "default" is stored in the
+# file, "ranges" is ignored, "delete", "include" and "proxy" are not
+# supported and must stay in the configuration.  255.255.255.255 is
+# rejected as with usual entries: nginx looks up this address for clients
+# with an invalid address.
+#
+# nginx maps the file into memory as is, so it must never be changed in
+# place while in use: truncating or rewriting it kills the worker processes
+# with SIGBUS.  the script writes a temporary file in the same directory
+# and renames it to the name given, any other tool must do the same.
+#
+# the tokenizer is shared with map2bin.pl in NginxConf.pm.
+#
+# usage: geo2bin.pl geo.bin < geo.conf
+
+
+use warnings;
+use strict;
+
+use Socket qw(AF_INET AF_INET6 inet_pton inet_ntop);
+
+use FindBin;
+use lib $FindBin::Bin;
+
+use NginxConf;
+
+die "usage: geo2bin.pl file.bin < geo.conf\n" if @ARGV != 1;
+
+my $out = $ARGV[0];
+
+binmode STDIN;
+
+my $text = do { local $/; <STDIN> };
+my $line = 0;
+my (@tokens, %v4, %v6, $default);
+
+# addresses are kept packed in network byte order, so they compare as strings
+
+sub addr {
+	my ($s) = @_;
+	my $a;
+
+	if ($s =~ /^\d+\.\d+\.\d+\.\d+$/) {
+		$a = inet_pton(AF_INET, $s);
+
+		# INADDR_NONE, as ngx_inet_addr() and ngx_ptocidr() do
+
+		undef $a if defined $a && $a eq "\xff\xff\xff\xff";
+
+	} elsif ($s =~ /:/) {
+		$a = inet_pton(AF_INET6, $s);
+	}
+
+	die "line $line: invalid address \"$s\"\n" unless defined $a;
+
+	return $a;
+}
+
+sub name {
+	my ($a) = @_;
+	return inet_ntop(length($a) == 4 ? AF_INET : AF_INET6, $a);
+}
+
+sub inc {
+	my @b = unpack("C*", shift);
+
+	for (my $i = $#b; $i >= 0; $i--) {
+		if ($b[$i] < 255) {
+			$b[$i]++;
+			return pack("C*", @b);
+		}
+
+		$b[$i] = 0;
+	}
+
+	return undef;
+}
+
+sub dec {
+	my @b = unpack("C*", shift);
+
+	for (my $i = $#b; $i >= 0; $i--) {
+		if ($b[$i] > 0) {
+			$b[$i]--;
+			return pack("C*", @b);
+		}
+
+		$b[$i] = 255;
+	}
+
+	return undef;
+}
+
+sub network {
+	my ($net) = @_;
+	my ($start, $end);
+
+	if ($net =~ m{^(.+)/(\d+)$}) {
+		my $a = addr($1);
+		my $bits = 8 * length($a);
+
+		die "line $line: invalid network \"$net\"\n" if $2 > $bits;
+
+		my $mask = pack("B$bits", '1' x $2);
+
+		$start = $a & $mask;
+		$end = $start | ~$mask;
+
+	} elsif ($net =~ /^([^-]+)-([^-]+)$/) {
+		$start = addr($1);
+		$end = addr($2);
+
+		die "line $line: invalid range \"$net\"\n"
+			if length($start) != length($end) || $start gt $end;
+
+	} else {
+		$start = $end = addr($net);
+	}
+
+	return ($start, $end);
+}
+
+for my $t (NginxConf::tokens($text)) {
+	$line = $t->[1];
+
+	if ($t->[0] eq ';') {
+		if (@tokens == 1 && $tokens[0] eq 'ranges') {
+			@tokens = ();
+			next;
+		}
+
+		die "line $line: invalid number of the geo parameters\n"
+			if @tokens != 2;
+
+		my ($net, $value) = @tokens;
+		@tokens = ();
+
+		if ($net =~ /^(delete|include|include_binary|proxy|proxy_recursive)$/) {
+			die "line $line: \"$net\" is not supported\n";
+		}
+
+		if ($net eq 'default') {
+			$default = $value;
+			next;
+		}
+
+		my ($start, $end) = network($net);
+
+		# a duplicate entry replaces the previous one, as in the geo module
+
+		my $ranges = length($start) == 4 ? \%v4 : \%v6;
+		$ranges->{$start . $end} = [ $start, $end, $value ];
+		next;
+	}
+
+	push @tokens, $t->[2];
+}
+
+die "unexpected end of file\n" if @tokens;
+
+# nested ranges are split so that the innermost one wins, the result is
+# a sorted list of non-overlapping ranges with adjacent equal ones merged
+
+sub flatten {
+	my ($ranges) = @_;
+	my (@out, @stack, $cur);
+
+	my $emit = sub {
+		my ($s, $e, $v) = @_;
+
+		if (@out && $out[-1][2] eq $v) {
+			my $next = inc($out[-1][1]);
+
+			if (defined $next && $next eq $s) {
+				$out[-1][1] = $e;
+				return;
+			}
+		}
+
+		push @out, [ $s, $e, $v ];
+	};
+
+	my $pop = sub {
+		my $top = pop @stack;
+
+		$emit->($cur, $top->[1], $top->[2])
+			if defined $cur && $cur le $top->[1];
+
+		# undefined once the end of the address space is reached
+
+		$cur = inc($top->[1]);
+	};
+
+	for my $r (sort { $a->[0] cmp $b->[0] || $b->[1] cmp $a->[1] }
+	           values %$ranges)
+	{
+		$pop->() while @stack && $stack[-1][1] lt $r->[0];
+
+		if (@stack) {
+			my $top = $stack[-1];
+
+			die "range \"" . name($r->[0]) . "-" . name($r->[1])
+			    . "\" overlaps \"" . name($top->[0]) . "-"
+			    . name($top->[1]) . "\"\n"
+				if $r->[1] gt $top->[1];
+
+			$emit->($cur, dec($r->[0]), $top->[2])
+				if $cur lt $r->[0];
+		}
+
+		$cur = $r->[0];
+		push @stack, $r;
+	}
+
+	$pop->() while @stack;
+
+	return @out;
+}
+
+my @v4 = flatten(\%v4);
+my @v6 = flatten(\%v6);
+
+# equal values are stored once
+
+my (@values, %index);
+
+for my $value ((defined $default ? ($default) : ()),
+               map { $_->[2] } @v4, @v6)
+{
+	next if exists $index{$value};
+	$index{$value} = @values;
+	push @values, $value;
+}
+
+my $offset = 32 + 8 * @values + 12 * @v4 + 36 * @v6;
+my ($table, $strings) = ('', '');
+
+for my $value (@values) {
+	$table .= pack("LL", $offset + length($strings), length($value));
+	$strings .= $value;
+}
+
+die "the geo base is too large\n" if $offset + length($strings) > 0xffffffff;
+
+NginxConf::write_file($out,
+                      pack("a8LLLLLL", "NGXGEOB1", 0x01020304, scalar @values,
+                           defined $default ? $index{$default} : 0xffffffff,
+                           scalar @v4, scalar @v6, 0),
+                      $table,
+                      pack("L*", map { unpack("N", $_->[0]) } @v4),
+                      pack("L*", map { unpack("N", $_->[1]) } @v4),
+                      pack("L*", map { $index{$_->[2]} } @v4),
+                      (map { $_->[0] } @v6),
+                      (map { $_->[1] } @v6),
+                      pack("L*", map { $index{$_->[2]} } @v6),
+                      $strings);
@@ -0,0 +1,105 @@
+#!/usr/bin/perl -w
+
+# Copyright (C) Nginx, Inc.
+#
+# this script converts exact "key value;" map entries, as used inside
+# a map block or in an included file, to the binary format loaded with
+#
+#   map $http_host $backend {
+#       include_binary hosts.bin;
+#   }
+#
+# keys are lowercased as the map module does, values are strings only,
+# "default", "hostnames", "include", regular expressions and variables
+# are not supported and must stay in the configuration.
+#
+# nginx maps the file into memory as is, so it must never be changed in
+# place while in use: truncating or rewriting it kills the worker processes
+# with SIGBUS.  the script writes a temporary file in the same directory
+# and renames it to the name given, any other tool must do the same.
+#
+# the tokenizer is shared with geo2bin.pl in NginxConf.pm.
+#
+# usage: map2bin.pl hosts.bin < hosts.conf
+
+
+use warnings;
+use strict;
+
+use FindBin;
+use lib $FindBin::Bin;
+
+use NginxConf;
+
+die "usage: map2bin.pl file.bin < map.conf\n" if @ARGV != 1;
+
+my $out = $ARGV[0];
+
+binmode STDIN;
+
+my $text = do { local $/; <STDIN> };
+my $line = 0;
+my (@tokens, %map, %values);
+
+for my $t (NginxConf::tokens($text)) {
+	$line = $t->[1];
+
+	if ($t->[0] eq ';') {
+		die "line $line: invalid number of the map parameters\n"
+			if @tokens != 2;
+
+		my ($key, $value) = @tokens;
+		@tokens = ();
+
+		if ($key =~ /^(default|hostnames|include|include_binary)$/) {
+			die "line $line: \"$key\" is not supported\n";
+		}
+
+		die "line $line: regex \"$key\" is not supported\n"
+			if $key =~ /^~/;
+		# a text map would expand variables anywhere in a value
+
+		die "line $line: variable in \"$value\" is not supported\n"
+			if $value =~ /\$/;
+
+		$key =~ s/^\\//;
+		$key =~ tr/A-Z/a-z/;
+
+		die "line $line: conflicting parameter \"$key\"\n"
+			if exists $map{$key};
+
+		$map{$key} = $value;
+		next;
+	}
+
+	push @tokens, $t->[2];
+}
+
+die "unexpected end of file\n" if @tokens;
+
+# the map module does a binary search over entries sorted bytewise
+
+my @keys = sort keys %map;
+my $n = @keys;
+my $offset = 16 + 16 * $n;
+my ($entries, $strings) = ('', '');
+
+for my $key (@keys) {
+	my $value = $map{$key};
+
+	# equal values are stored once
+
+	if (!exists $values{$value}) {
+		$values{$value} = $offset + length($strings);
+		$strings .= $value;
+	}
+
+	$entries .= pack("LLLL", $offset + length($strings), length($key),
+	                 $values{$value}, length($value));
+	$strings .= $key;
+}
+
+die "the map is too large\n" if $offset + length($strings) > 0xffffffff;
+
+NginxConf::write_file($out, pack("a8LL", "NGXMAPB1", 0x01020304, $n),
+                      $entries, $strings);
@@ -0,0 +1,687 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * the benchmark and equivalence check of the request line and header
+ * parsers: the scalar byte loop is compared with the SSE4.2 fast path
+ * if supported by the CPU; see README
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+#define NGX_PARSER_BENCH_CORPUS      4096
+#define NGX_PARSER_BENCH_GENERATED   2000
+#define NGX_PARSER_BENCH_SPLIT       200
+#define NGX_PARSER_BENCH_MAX         16384
+#define NGX_PARSER_BENCH_TRACE       (1024 * 1024)
+#define NGX_PARSER_BENCH_BYTES       (256 * 1024 * 1024)
+
+
+typedef struct {
+    u_char             *data;
+    size_t              len;
+} ngx_parser_bench_req_t;
+
+
+typedef struct {
+    char                    *name;
+    ngx_parser_bench_req_t  *reqs;
+    ngx_uint_t               nreqs;
+
+    /* the generated adversarial requests are not used for the benchmark */
+    ngx_uint_t               adversarial;
+} ngx_parser_bench_set_t;
+
+
+typedef struct {
+    char               *name;
+    ngx_uint_t          features;
+} ngx_parser_bench_mode_t;
+
+
+static ngx_int_t ngx_parser_bench_load(ngx_parser_bench_set_t *set);
+static void ngx_parser_bench_generate(ngx_parser_bench_set_t *set);
+static size_t ngx_parser_bench_request(u_char *buf, ngx_uint_t adversarial);
+static u_char *ngx_parser_bench_token(u_char *p, size_t n, char *alphabet);
+static uint32_t ngx_parser_bench_random(void);
+static ngx_uint_t ngx_parser_bench_check(ngx_parser_bench_set_t *set,
+    ngx_uint_t split);
+static size_t ngx_parser_bench_parse(u_char *buf, size_t len, size_t split,
+    u_char *trace);
+static u_char *ngx_parser_bench_trace(u_char *p, u_char *base,
+    ngx_http_request_t *r, ngx_int_t rc, ngx_uint_t header);
+static void ngx_parser_bench_run(ngx_parser_bench_set_t *set);
+static double ngx_parser_bench_now(void);
+
+
+/* the objects linked do not include ngx_alloc.o, ngx_cycle.o and ngx_log.o */
+
+ngx_uint_t             ngx_cacheline_size;
+volatile ngx_cycle_t  *ngx_cycle;
+
+static ngx_parser_bench_mode_t  ngx_parser_bench_modes[] = {
+    { "scalar", 0 },
+    { "sse4.2", NGX_CPU_SSE42 },
+    { NULL, 0 }
+};
+
+#define ngx_parser_bench_supported(mode)                                      \
+    ((ngx_parser_bench_cpu & (mode)->features) == (mode)->features)
+
+static ngx_uint_t  ngx_parser_bench_cpu;
+static uint64_t    ngx_parser_bench_seed = 88172645463325252ULL;
+
+static u_char      ngx_parser_bench_trace0[NGX_PARSER_BENCH_TRACE];
+static u_char      ngx_parser_bench_trace1[NGX_PARSER_BENCH_TRACE];
+
+
+void
+ngx_log_error_core(ngx_uint_t level, ngx_log_t *log, ngx_err_t err,
+    const char *fmt, ...)
+{
+}
+
+
+void *
+ngx_alloc(size_t size, ngx_log_t *log)
+{
+    return malloc(size);
+}
+
+
+void *
+ngx_pnalloc(ngx_pool_t *pool, size_t size)
+{
+    return malloc(size);
+}
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_uint_t                failed;
+    ngx_parser_bench_set_t    corpus, generated;
+    ngx_parser_bench_mode_t  *mode;
+
+    ngx_cpuinfo();
+
+    ngx_parser_bench_cpu = ngx_cpu_features;
+
+    printf("cpu:");
+
+    for (mode = ngx_parser_bench_modes; mode->name; mode++) {
+        if (ngx_parser_bench_supported(mode)) {
+            printf(" %s", mode->name);
+        }
+    }
+
+    printf("\n");
+
+    ngx_memzero(&corpus, sizeof(ngx_parser_bench_set_t));
+    ngx_memzero(&generated, sizeof(ngx_parser_bench_set_t));
+
+    corpus.name = (argc > 1) ? argv[1] : "corpus.txt";
+    generated.name = "generated";
+
+    if (ngx_parser_bench_load(&corpus) != NGX_OK) {
+        return 1;
+    }
+
+    ngx_parser_bench_generate(&generated);
+
+    printf("equivalence with the scalar parser:\n");
+
+    failed = ngx_parser_bench_check(&corpus, corpus.nreqs);
+    failed |= ngx_parser_bench_check(&generated, NGX_PARSER_BENCH_SPLIT);
+
+    printf("throughput:\n");
+
+    ngx_parser_bench_run(&corpus);
+    ngx_parser_bench_run(&generated);
+
+    printf("%s\n", failed ? "FAILED" : "ok");
+
+    return failed;
+}
+
+
+/*
+ * the corpus file holds pipelined requests without bodies,
+ * it is split into the requests with the scalar parser
+ */
+
+static ngx_int_t
+ngx_parser_bench_load(ngx_parser_bench_set_t *set)
+{
+    u_char                  *buf;
+    FILE                    *f;
+    long                     size;
+    ngx_int_t                rc;
+    ngx_buf_t                b;
+    ngx_uint_t               line;
+    ngx_http_request_t       r;
+    ngx_parser_bench_req_t  *req;
+
+    f = fopen(set->name, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "fopen(\"%s\") failed\n", set->name);
+        return NGX_ERROR;
+    }
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    buf = malloc(size);
+    if (buf == NULL || fread(buf, 1, size, f) != (size_t) size) {
+        fprintf(stderr, "reading \"%s\" failed\n", set->name);
+        fclose(f);
+        return NGX_ERROR;
+    }
+
+    fclose(f);
+
+    set->reqs = malloc(NGX_PARSER_BENCH_CORPUS
+                       * sizeof(ngx_parser_bench_req_t));
+    if (set->reqs == NULL) {
+        fprintf(stderr, "malloc() failed\n");
+        return NGX_ERROR;
+    }
+
+    ngx_cpu_features = 0;
+
+    ngx_memzero(&b, sizeof(ngx_buf_t));
+    b.pos = buf;
+    b.last = buf + size;
+
+    while (b.pos < b.last) {
+
+        if (set->nreqs == NGX_PARSER_BENCH_CORPUS) {
+            fprintf(stderr, "too many requests in \"%s\"\n", set->name);
+            return NGX_ERROR;
+        }
+
+        ngx_memzero(&r, sizeof(ngx_http_request_t));
+
+        req = &set->reqs[set->nreqs++];
+
+        req->data = b.pos;
+        line = 1;
+
+        for ( ;; ) {
+            if (line) {
+                rc = ngx_http_parse_request_line(&r, &b);
+
+            } else {
+                rc = ngx_http_parse_header_line(&r, &b, 1);
+            }
+
+            if (rc == NGX_OK) {
+                line = 0;
+                continue;
+            }
+
+            if (rc == NGX_HTTP_PARSE_HEADER_DONE) {
+                break;
+            }
+
+            fprintf(stderr, "invalid request at offset %ld in \"%s\"\n",
+                    (long) (b.pos - buf), set->name);
+            return NGX_ERROR;
+        }
+
+        req->len = b.pos - req->data;
+    }
+
+    return NGX_OK;
+}
+
+
+/*
+ * requests with long cookies, tokens and query strings; every third one
+ * is adversarial and mixes in control and high bytes, NULs, odd spaces
+ * and bare LFs, so it is not necessarily valid
+ */
+
+static void
+ngx_parser_bench_generate(ngx_parser_bench_set_t *set)
+{
+    u_char      *buf;
+    ngx_uint_t   i;
+
+    buf = malloc(NGX_PARSER_BENCH_GENERATED * NGX_PARSER_BENCH_MAX);
+    set->reqs = malloc(NGX_PARSER_BENCH_GENERATED
+                       * sizeof(ngx_parser_bench_req_t));
+
+    if (buf == NULL || set->reqs == NULL) {
+        fprintf(stderr, "malloc() failed\n");
+        exit(1);
+    }
+
+    for (i = 0; i < NGX_PARSER_BENCH_GENERATED; i++) {
+        set->reqs[i].data = buf + i * NGX_PARSER_BENCH_MAX;
+        set->reqs[i].len = ngx_parser_bench_request(set->reqs[i].data,
+                                                    i % 3 == 0);
+    }
+
+    set->nreqs = NGX_PARSER_BENCH_GENERATED;
+    set->adversarial = 1;
+}
+
+
+static size_t
+ngx_parser_bench_request(u_char *buf, ngx_uint_t adversarial)
+{
+    u_char      *p;
+    char        *a, *rare;
+    ngx_uint_t   i, k;
+
+    static char  *methods[] = { "GET", "POST", "PUT", "HEAD", "DELETE" };
+    static char  *usual =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    static char  *odd = "ABCabc012 /.%?#+\r\n\t\x01\x7f\x80\xff=&;:,\\";
+
+    rare = adversarial ? odd : usual;
+
+    p = ngx_sprintf(buf, "%s ", methods[ngx_parser_bench_random() % 5]);
+
+    if (ngx_parser_bench_random() % 8 == 0) {
+        p = ngx_cpymem(p, "http://example.com:8080",
+                       sizeof("http://example.com:8080") - 1);
+    }
+
+    for (i = ngx_parser_bench_random() % 6 + 1; i; i--) {
+        *p++ = '/';
+        a = ngx_parser_bench_random() % 4 ? usual : rare;
+        p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 24, a);
+
+        if (ngx_parser_bench_random() % 5 == 0) {
+            *p++ = '.';
+            p = ngx_parser_bench_token(p, 3, usual);
+        }
+    }
+
+    if (ngx_parser_bench_random() % 2) {
+        *p++ = '?';
+
+        for (i = ngx_parser_bench_random() % 5 + 1; i; i--) {
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 10 + 1,
+                                       usual);
+            *p++ = '=';
+
+            k = ngx_parser_bench_random() % 3
+                ? ngx_parser_bench_random() % 40
+                : 200 + ngx_parser_bench_random() % 400;
+
+            a = ngx_parser_bench_random() % 4 ? usual : rare;
+            p = ngx_parser_bench_token(p, k, a);
+            *p++ = '&';
+        }
+    }
+
+    if (adversarial && ngx_parser_bench_random() % 4 == 0) {
+        p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 64, odd);
+    }
+
+    if (ngx_parser_bench_random() % 10) {
+        p = ngx_cpymem(p, " HTTP/1.1", sizeof(" HTTP/1.1") - 1);
+
+    } else {
+        p = ngx_cpymem(p, "  HTTP/1.0", sizeof("  HTTP/1.0") - 1);
+    }
+
+    if (ngx_parser_bench_random() % 10) {
+        *p++ = CR;
+    }
+
+    *p++ = LF;
+
+    for (i = ngx_parser_bench_random() % 20; i; i--) {
+
+        switch (ngx_parser_bench_random() % 8) {
+
+        case 0:
+            p = ngx_sprintf(p, "Host: example.com");
+            break;
+
+        case 1:
+            p = ngx_sprintf(p, "User-Agent: Mozilla/5.0 (X11; Linux x86_64) "
+                            "AppleWebKit/537.36 (KHTML, like Gecko) "
+                            "Chrome/120.0 Safari/537.36");
+            break;
+
+        case 2:
+            p = ngx_sprintf(p, "Cookie: ");
+
+            for (k = ngx_parser_bench_random() % 40; k; k--) {
+                p = ngx_parser_bench_token(p,
+                                           ngx_parser_bench_random() % 12 + 1,
+                                           usual);
+                *p++ = '=';
+                a = ngx_parser_bench_random() % 8 ? usual : rare;
+                p = ngx_parser_bench_token(p,
+                                           ngx_parser_bench_random() % 64, a);
+                *p++ = ';'; *p++ = ' ';
+            }
+
+            break;
+
+        case 3:
+            p = ngx_sprintf(p, "Authorization: Bearer ");
+            p = ngx_parser_bench_token(p,
+                                       400 + ngx_parser_bench_random() % 600,
+                                       usual);
+            break;
+
+        case 4:
+            p = ngx_sprintf(p, "X-Pad:");
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 40, " ");
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 50, rare);
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 40, " ");
+            break;
+
+        case 5:
+            p = ngx_sprintf(p, "X-Empty:");
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 3, " ");
+            break;
+
+        case 6:
+            p = ngx_sprintf(p, "Accept-Language: en-US,en;q=0.9");
+            break;
+
+        default:
+            a = ngx_parser_bench_random() % 4 ? usual : rare;
+            p = ngx_parser_bench_token(p,
+                                       ngx_parser_bench_random() % 16 + 1, a);
+            *p++ = ':'; *p++ = ' ';
+            p = ngx_parser_bench_token(p, ngx_parser_bench_random() % 300,
+                                       rare);
+        }
+
+        if (adversarial && ngx_parser_bench_random() % 16 == 0) {
+            *p++ = '\0';
+        }
+
+        if (ngx_parser_bench_random() % 10) {
+            *p++ = CR;
+        }
+
+        *p++ = LF;
+    }
+
+    *p++ = CR; *p++ = LF;
+
+    return p - buf;
+}
+
+
+static u_char *
+ngx_parser_bench_token(u_char *p, size_t n, char *alphabet)
+{
+    size_t  len;
+
+    len = ngx_strlen(alphabet);
+
+    while (n--) {
+        *p++ = alphabet[ngx_parser_bench_random() % len];
+    }
+
+    return p;
+}
+
+
+/* xorshift, the corpus must not depend on the libc random() */
+
+static uint32_t
+ngx_parser_bench_random(void)
+{
+    ngx_parser_bench_seed ^= ngx_parser_bench_seed << 13;
+    ngx_parser_bench_seed ^= ngx_parser_bench_seed >> 7;
+    ngx_parser_bench_seed ^= ngx_parser_bench_seed << 17;
+
+    return (uint32_t) ngx_parser_bench_seed;
+}
+
+
+/*
+ * every request is parsed by the scalar parser and by each fast path,
+ * the parser state after every call must be the same; the first "split"
+ * requests are also parsed stopping at every possible buffer end first
+ */
+
+static ngx_uint_t
+ngx_parser_bench_check(ngx_parser_bench_set_t *set, ngx_uint_t split)
+{
+    size_t                    k, len0, len1;
+    ngx_uint_t                i, checks, failed;
+    ngx_parser_bench_req_t   *req;
+    ngx_parser_bench_mode_t  *mode;
+
+    req = set->reqs;
+    checks = 0;
+    failed = 0;
+
+    for (i = 0; i < set->nreqs; i++) {
+
+        for (k = 0; k < req[i].len; k += (i < split) ? 1 : req[i].len) {
+
+            ngx_cpu_features = 0;
+
+            len0 = ngx_parser_bench_parse(req[i].data, req[i].len, k,
+                                          ngx_parser_bench_trace0);
+
+            for (mode = ngx_parser_bench_modes + 1; mode->name; mode++) {
+
+                if (!ngx_parser_bench_supported(mode)) {
+                    continue;
+                }
+
+                ngx_cpu_features = mode->features;
+
+                len1 = ngx_parser_bench_parse(req[i].data, req[i].len, k,
+                                              ngx_parser_bench_trace1);
+                checks++;
+
+                if (len0 == len1
+                    && ngx_memcmp(ngx_parser_bench_trace0,
+                                  ngx_parser_bench_trace1, len0)
+                       == 0)
+                {
+                    continue;
+                }
+
+                if (failed++ < 3) {
+                    printf("  %s: request %lu, split at %lu differs with %s\n"
+                           "  scalar: %.*s\n  %s: %.*s\n",
+                           set->name, (unsigned long) i, (unsigned long) k,
+                           mode->name, (int) len0, ngx_parser_bench_trace0,
+                           mode->name, (int) len1, ngx_parser_bench_trace1);
+                }
+            }
+        }
+    }
+
+    printf("  %s: %lu requests, %lu checks, %lu differ\n",
+           set->name, (unsigned long) set->nreqs, (unsigned long) checks,
+           (unsigned long) failed);
+
+    return failed ? 1 : 0;
+}
+
+
+/* a request is parsed up to "split" bytes first, then the rest */
+
+static size_t
+ngx_parser_bench_parse(u_char *buf, size_t len, size_t split, u_char *trace)
+{
+    u_char              *p;
+    ngx_int_t            rc;
+    ngx_buf_t            b;
+    ngx_uint_t           header;
+    ngx_http_request_t   r;
+
+    ngx_memzero(&r, sizeof(ngx_http_request_t));
+    ngx_memzero(&b, sizeof(ngx_buf_t));
+
+    b.pos = buf;
+    b.last = buf + (split ? split : len);
+
+    p = trace;
+    header = 0;
+
+    for ( ;; ) {
+        if (header) {
+            rc = ngx_http_parse_header_line(&r, &b, 1);
+
+        } else {
+            rc = ngx_http_parse_request_line(&r, &b);
+        }
+
+        if (p) {
+            p = ngx_parser_bench_trace(p, buf, &r, rc, header);
+        }
+
+        if (rc == NGX_AGAIN) {
+            if (b.last == buf + len) {
+                break;
+            }
+
+            b.last = buf + len;
+            continue;
+        }
+
+        if (rc == NGX_OK) {
+            header = 1;
+            continue;
+        }
+
+        break;
+    }
+
+    return p ? (size_t) (p - trace) : 0;
+}
+
+
+#define ngx_parser_bench_offset(x)  ((x) ? (long) ((x) - base) : -1L)
+
+static u_char *
+ngx_parser_bench_trace(u_char *p, u_char *base, ngx_http_request_t *r,
+    ngx_int_t rc, ngx_uint_t header)
+{
+    long  header_end;
+
+    /* the end of a value is only known once its line is parsed */
+
+    if (header && rc == NGX_AGAIN && r->state == 3) {
+        header_end = -2L;
+
+    } else {
+        header_end = ngx_parser_bench_offset(r->header_end);
+    }
+
+    return ngx_sprintf(p, "rc:%i state:%ui method:%l uri:%l-%l args:%l "
+                       "ext:%l complex:%d quoted:%d plus:%d space:%d "
+                       "version:%ui.%ui name:%l-%l value:%l-%l hash:%ui "
+                       "invalid:%d lowcase:%ui:%*s|",
+                       rc, r->state,
+                       ngx_parser_bench_offset(r->method_end),
+                       ngx_parser_bench_offset(r->uri_start),
+                       ngx_parser_bench_offset(r->uri_end),
+                       ngx_parser_bench_offset(r->args_start),
+                       ngx_parser_bench_offset(r->uri_ext),
+                       (int) r->complex_uri, (int) r->quoted_uri,
+                       (int) r->plus_in_uri, (int) r->space_in_uri,
+                       r->http_major, r->http_minor,
+                       ngx_parser_bench_offset(r->header_name_start),
+                       ngx_parser_bench_offset(r->header_name_end),
+                       ngx_parser_bench_offset(r->header_start),
+                       header_end, r->header_hash, (int) r->invalid_header,
+                       r->lowcase_index,
+                       (size_t) ngx_min(r->lowcase_index,
+                                        NGX_HTTP_LC_HEADER_LEN),
+                       r->lowcase_header);
+}
+
+
+/*
+ * each request is parsed in a single buffer, the adversarial
+ * requests are left out as they may stop at an error early
+ */
+
+#define ngx_parser_bench_used(set, i)  (!(set)->adversarial || (i) % 3)
+
+static void
+ngx_parser_bench_run(ngx_parser_bench_set_t *set)
+{
+    double                    start, scalar, t;
+    size_t                    bytes;
+    ngx_uint_t                i, n, count, rounds;
+    ngx_parser_bench_req_t   *req;
+    ngx_parser_bench_mode_t  *mode;
+
+    req = set->reqs;
+    bytes = 0;
+    count = 0;
+
+    for (i = 0; i < set->nreqs; i++) {
+        if (ngx_parser_bench_used(set, i)) {
+            bytes += req[i].len;
+            count++;
+        }
+    }
+
+    rounds = NGX_PARSER_BENCH_BYTES / bytes + 1;
+    scalar = 0;
+
+    printf("  %s: %lu requests, %lu bytes, %lu rounds\n",
+           set->name, (unsigned long) count, (unsigned long) bytes,
+           (unsigned long) rounds);
+
+    for (mode = ngx_parser_bench_modes; mode->name; mode++) {
+
+        if (!ngx_parser_bench_supported(mode)) {
+            continue;
+        }
+
+        ngx_cpu_features = mode->features;
+
+        start = ngx_parser_bench_now();
+
+        for (n = 0; n < rounds; n++) {
+            for (i = 0; i < set->nreqs; i++) {
+                if (ngx_parser_bench_used(set, i)) {
+                    (void) ngx_parser_bench_parse(req[i].data, req[i].len, 0,
+                                                  NULL);
+                }
+            }
+        }
+
+        t = ngx_parser_bench_now() - start;
+
+        if (scalar == 0) {
+            scalar = t;
+        }
+
+        printf("    %-8s %8.1f ns/request %6.2f GB/s  x%.1f\n",
+               mode->name, t * 1e9 / rounds / count,
+               (double) bytes * rounds / t / 1e9, scalar / t);
+    }
+}
+
+
+static double
+ngx_parser_bench_now(void)
+{
+    struct timespec  ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,366 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * the microbenchmark of the event timer backends: the rbtree and
+ * the timing wheel ("timer_wheel on") are linked from a built tree
+ * and driven directly, without an event loop; see README
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_event.h>
+
+
+#define NGX_TIMER_BENCH_OPS      5000000
+#define NGX_TIMER_BENCH_EVENTS   20000
+#define NGX_TIMER_BENCH_STEPS    2000000
+#define NGX_TIMER_BENCH_SEEDS    3
+
+
+typedef struct {
+    ngx_uint_t          fired;
+    ngx_uint_t          early;
+    ngx_uint_t          overshoot;
+    uint64_t            hash;
+} ngx_timer_bench_stat_t;
+
+
+static double ngx_timer_bench_rearm(ngx_uint_t wheel, ngx_uint_t n,
+    ngx_uint_t ops);
+static ngx_int_t ngx_timer_bench_check(ngx_uint_t wheel, unsigned seed,
+    ngx_timer_bench_stat_t *st);
+static ngx_msec_t ngx_timer_bench_nearest(void);
+static void ngx_timer_bench_handler(ngx_event_t *ev);
+static double ngx_timer_bench_now(void);
+
+
+/* the objects linked do not include ngx_times.o */
+
+volatile ngx_msec_t  ngx_current_msec;
+
+static ngx_log_t               ngx_timer_bench_log;
+static ngx_event_t            *ngx_timer_bench_events;
+static ngx_timer_bench_stat_t *ngx_timer_bench_stat;
+
+
+#if (NGX_DEBUG)
+
+/* debug logging is disabled by the zero log level, only the symbol is used */
+
+void
+ngx_log_error_core(ngx_uint_t level, ngx_log_t *log, ngx_err_t err,
+    const char *fmt, ...)
+{
+}
+
+#endif
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    double                  rbtree, wheel;
+    unsigned                seed;
+    long                    n;
+    ngx_uint_t              i, nsizes, failed;
+    ngx_timer_bench_stat_t  rst, wst;
+
+    static ngx_uint_t  sizes[] = { 10000, 100000, 500000 };
+
+    nsizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    if (argc > 1) {
+        n = strtol(argv[1], NULL, 10);
+
+        if (n <= 0) {
+            fprintf(stderr, "invalid number of timers \"%s\"\n", argv[1]);
+            return 1;
+        }
+
+        sizes[0] = (ngx_uint_t) n;
+        nsizes = 1;
+    }
+
+    printf("re-arm under churn, per operation:\n");
+
+    for (i = 0; i < nsizes; i++) {
+        rbtree = ngx_timer_bench_rearm(0, sizes[i], NGX_TIMER_BENCH_OPS);
+        wheel = ngx_timer_bench_rearm(1, sizes[i], NGX_TIMER_BENCH_OPS);
+
+        printf("  %7lu timers: rbtree %7.1f ns, wheel %7.1f ns\n",
+               (unsigned long) sizes[i], rbtree, wheel);
+    }
+
+    printf("equivalence, %d timers, %d steps:\n",
+           NGX_TIMER_BENCH_EVENTS, NGX_TIMER_BENCH_STEPS);
+
+    failed = 0;
+
+    for (seed = 1; seed <= NGX_TIMER_BENCH_SEEDS; seed++) {
+
+        if (ngx_timer_bench_check(0, seed, &rst) != NGX_OK
+            || ngx_timer_bench_check(1, seed, &wst) != NGX_OK)
+        {
+            return 1;
+        }
+
+        if (rst.hash != wst.hash || rst.fired != wst.fired
+            || rst.early || wst.early || rst.overshoot || wst.overshoot)
+        {
+            failed = 1;
+        }
+
+        printf("  seed %u: fired %lu/%lu, early %lu/%lu, "
+               "find overshoot %lu/%lu, order %s\n",
+               seed, (unsigned long) rst.fired, (unsigned long) wst.fired,
+               (unsigned long) rst.early, (unsigned long) wst.early,
+               (unsigned long) rst.overshoot, (unsigned long) wst.overshoot,
+               rst.hash == wst.hash ? "same" : "DIFFERS");
+    }
+
+    printf("%s\n", failed ? "FAILED" : "ok");
+
+    return failed;
+}
+
+
+/*
+ * n timers of 60-75s, like keepalive and read timeouts, are deleted
+ * and added again at random; every 1024 operations the clock advances
+ * by 1ms and the next timer is looked up and the expired ones are run
+ */
+
+static double
+ngx_timer_bench_rearm(ngx_uint_t wheel, ngx_uint_t n, ngx_uint_t ops)
+{
+    double        start;
+    ngx_uint_t    i, k;
+    ngx_event_t  *ev;
+
+    ngx_use_timer_wheel = wheel;
+    ngx_current_msec = 1000000;
+
+    ngx_event_timer_init(&ngx_timer_bench_log);
+
+    ev = calloc(n, sizeof(ngx_event_t));
+    if (ev == NULL) {
+        fprintf(stderr, "calloc() failed\n");
+        exit(1);
+    }
+
+    ngx_timer_bench_events = ev;
+    ngx_timer_bench_stat = NULL;
+
+    srandom(1);
+
+    for (i = 0; i < n; i++) {
+        ev[i].handler = ngx_timer_bench_handler;
+        ev[i].log = &ngx_timer_bench_log;
+
+        ngx_event_add_timer(&ev[i], 60000 + random() % 15000);
+    }
+
+    start = ngx_timer_bench_now();
+
+    for (k = 0; k < ops; k++) {
+        i = random() % n;
+
+        /* an explicit delete bypasses the lazy re-arm of close values */
+
+        if (ev[i].timer_set) {
+            ngx_event_del_timer(&ev[i]);
+        }
+
+        ngx_event_add_timer(&ev[i], 60000 + random() % 15000);
+
+        if ((k & 1023) == 0) {
+            ngx_current_msec++;
+            (void) ngx_event_find_timer();
+            ngx_event_expire_timers();
+        }
+    }
+
+    start = (ngx_timer_bench_now() - start) / ops;
+
+    for (i = 0; i < n; i++) {
+        if (ev[i].timer_set) {
+            ngx_event_del_timer(&ev[i]);
+        }
+    }
+
+    free(ev);
+
+    return start;
+}
+
+
+/*
+ * a random mix of short, usual and very long timers, deletions, small
+ * clock steps and large jumps; both backends must run the same timers
+ * at the same time, none early, and ngx_event_find_timer() must never
+ * return more than the time to the nearest timer
+ */
+
+static ngx_int_t
+ngx_timer_bench_check(ngx_uint_t wheel, unsigned seed,
+    ngx_timer_bench_stat_t *st)
+{
+    ngx_uint_t    i, k, r;
+    ngx_msec_t    timer, nearest;
+    ngx_event_t  *ev;
+
+    ngx_memzero(st, sizeof(ngx_timer_bench_stat_t));
+
+    ngx_use_timer_wheel = wheel;
+
+    /* the clock wraps around during the run */
+    ngx_current_msec = (ngx_msec_t) 0xfffff000 - 12345;
+
+    ngx_event_timer_init(&ngx_timer_bench_log);
+
+    ev = calloc(NGX_TIMER_BENCH_EVENTS, sizeof(ngx_event_t));
+    if (ev == NULL) {
+        fprintf(stderr, "calloc() failed\n");
+        return NGX_ERROR;
+    }
+
+    ngx_timer_bench_events = ev;
+    ngx_timer_bench_stat = st;
+
+    for (i = 0; i < NGX_TIMER_BENCH_EVENTS; i++) {
+        ev[i].handler = ngx_timer_bench_handler;
+        ev[i].log = &ngx_timer_bench_log;
+    }
+
+    srandom(seed);
+
+    for (k = 0; k < NGX_TIMER_BENCH_STEPS; k++) {
+        i = random() % NGX_TIMER_BENCH_EVENTS;
+        r = random() % 100;
+
+        if (r < 60) {
+            switch (random() % 16) {
+            case 0:
+                timer = random() % 100000000;
+                break;
+            case 1: case 2: case 3:
+                timer = random() % 300;
+                break;
+            default:
+                timer = random() % 70000;
+            }
+
+            ngx_event_add_timer(&ev[i], timer);
+
+        } else if (r < 70) {
+            if (ev[i].timer_set) {
+                ngx_event_del_timer(&ev[i]);
+            }
+
+        } else if (r < 99) {
+            timer = ngx_event_find_timer();
+
+            if (k % 97 == 0) {
+                nearest = ngx_timer_bench_nearest();
+
+                /* the wheel runs on 1ms ticks */
+
+                if (timer > nearest && !(nearest == 0 && timer == 1)) {
+                    st->overshoot++;
+                }
+            }
+
+            ngx_current_msec += 1 + random() % 50;
+            ngx_event_expire_timers();
+
+        } else {
+            ngx_current_msec += 1 + random() % 5000000;
+            ngx_event_expire_timers();
+        }
+    }
+
+    for (i = 0; i < NGX_TIMER_BENCH_EVENTS; i++) {
+        if (ev[i].timer_set) {
+            ngx_event_del_timer(&ev[i]);
+        }
+    }
+
+    free(ev);
+
+    return NGX_OK;
+}
+
+
+static ngx_msec_t
+ngx_timer_bench_nearest(void)
+{
+    ngx_uint_t      i;
+    ngx_msec_t      nearest;
+    ngx_msec_int_t  timer;
+
+    nearest = NGX_TIMER_INFINITE;
+
+    for (i = 0; i < NGX_TIMER_BENCH_EVENTS; i++) {
+
+        if (!ngx_timer_bench_events[i].timer_set) {
+            continue;
+        }
+
+        timer = (ngx_msec_int_t)
+                    (ngx_timer_bench_events[i].timer.key - ngx_current_msec);
+
+        if (timer < 0) {
+            timer = 0;
+        }
+
+        if ((ngx_msec_t) timer < nearest) {
+            nearest = timer;
+        }
+    }
+
+    return nearest;
+}
+
+
+static void
+ngx_timer_bench_handler(ngx_event_t *ev)
+{
+    uint64_t                 x;
+    ngx_timer_bench_stat_t  *st;
+
+    st = ngx_timer_bench_stat;
+
+    if (st == NULL) {
+        return;
+    }
+
+    st->fired++;
+
+    if ((ngx_msec_int_t) (ngx_current_msec - ev->timer.key) < 0) {
+        st->early++;
+    }
+
+    /* the order of the timers run at the same time does not matter */
+
+    x = (uint64_t) (ev - ngx_timer_bench_events) * 0x9e3779b97f4a7c15ULL
+        ^ (uint64_t) ngx_current_msec * 0xc2b2ae3d27d4eb4fULL;
+    x ^= x >> 29;
+
+    st->hash += x * 0xbf58476d1ce4e5b9ULL;
+}
+
+
+static double
+ngx_timer_bench_now(void)
+{
+    struct timespec  ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
@@ -62,7 +62,10 @@ struct ngx_listening_s {
     /* ngx_listening_t链表中前一个listening结构 */
     ngx_listening_t    *previous;
     /* 当前ngx_listening_t 对应的ngx_connection_t结构 */
-    ngx_connectio n_t   *connection;
+    ngx_connection_t   *connection;
+
+    /* reuseport 时该监听套接字所属的 worker 进程序号 */
+    ngx_uint_t          worker;
 
     /*
      * 标志位，为1则表示在当前监听句柄有效，且执行ngx_init_cycle时不关闭监听端口，为0时则正常关闭。
@@ -99,6 +102,10 @@ struct ngx_listening_s {
     /* ipv6 */
     unsigned            ipv6only:1;
 #endif
+    /* 是否设置 SO_REUSEPORT，为1则每个 worker 进程拥有一个独立的监听套接字 */
+    unsigned            reuseport:1;
+    /* 继承来的套接字需要补设 SO_REUSEPORT */
+    unsigned            add_reuseport:1;
     /* 长连接 */
     unsigned            keepalive:2;
 
@@ -147,6 +154,7 @@ typedef enum {
 #define NGX_LOWLEVEL_BUFFERED  0x0f
 #define NGX_SSL_BUFFERED       0x01
 #define NGX_SPDY_BUFFERED      0x02
+#define NGX_HTTP_V2_BUFFERED   0x04
 
 
 /*
@@ -237,6 +245,7 @@ struct ngx_connection_s {
 
 ngx_listening_t *ngx_create_listening(ngx_conf_t *cf, void *sockaddr,
     socklen_t socklen);
+ngx_int_t ngx_clone_listening(ngx_conf_t *cf, ngx_listening_t *ls);
 ngx_int_t ngx_set_inherited_sockets(ngx_cycle_t *cycle);
 ngx_int_t ngx_open_listening_sockets(ngx_cycle_t *cycle);
 void ngx_configure_listening_sockets(ngx_cycle_t *cycle);
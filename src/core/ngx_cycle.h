@@ -31,6 +31,8 @@ struct ngx_shm_zone_s {
     ngx_shm_t                 shm; /* 共享内存块 */
     ngx_shm_zone_init_pt      init;
     void                     *tag;
+    /* 为1则重载配置时不复用旧的共享内存 */
+    ngx_uint_t                noreuse;  /* unsigned  noreuse:1; */
 };
 
 
@@ -135,6 +137,8 @@ typedef struct {
      ngx_int_t                rlimit_sigpending;
      off_t                    rlimit_core;
 
+     size_t                   pool_cache;
+
      int                      priority;
 
      ngx_uint_t               cpu_affinity_n;
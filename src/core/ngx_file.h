@@ -27,6 +27,7 @@ struct ngx_file_s {
     ngx_int_t                (*thread_handler)(ngx_thread_task_t *task,
                                                ngx_file_t *file);
     void                      *thread_ctx;
+    ngx_thread_task_t         *thread_task;
 #endif
 
 #if (NGX_HAVE_FILE_AIO)
@@ -43,6 +44,7 @@ struct ngx_file_s {
 
 typedef time_t (*ngx_path_manager_pt) (void *data);
 typedef void (*ngx_path_loader_pt) (void *data);
+typedef void (*ngx_path_saver_pt) (void *data);
 
 
 typedef struct {
@@ -52,6 +54,7 @@ typedef struct {
 
     ngx_path_manager_pt        manager;
     ngx_path_loader_pt         loader;
+    ngx_path_saver_pt          saver;
     void                      *data;
 
     u_char                    *conf_file;
@@ -77,6 +80,7 @@ typedef struct {
     unsigned                   log_level:8;
     unsigned                   persistent:1;
     unsigned                   clean:1;
+    unsigned                   thread_write:1;
 } ngx_temp_file_t;
 
 
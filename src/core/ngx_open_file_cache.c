@@ -21,6 +21,22 @@
 #define NGX_MIN_READ_AHEAD  (128 * 1024)
 
 
+#if (NGX_THREADS)
+
+#include <ngx_thread_pool.h>
+
+typedef struct {
+    ngx_str_t                name;
+    ngx_fd_t                 fd;
+    ngx_file_uniq_t          uniq;
+
+    ngx_open_file_info_t     of;
+    ngx_int_t                rc;
+} ngx_open_file_thread_ctx_t;
+
+#endif
+
+
 static void ngx_open_file_cache_cleanup(void *data);
 #if (NGX_HAVE_OPENAT)
 static ngx_fd_t ngx_openat_file_owner(ngx_fd_t at_fd, const u_char *name,
@@ -37,6 +53,14 @@ static ngx_int_t ngx_file_info_wrapper(ngx_str_t *name,
     ngx_open_file_info_t *of, ngx_file_info_t *fi, ngx_log_t *log);
 static ngx_int_t ngx_open_and_stat_file(ngx_str_t *name,
     ngx_open_file_info_t *of, ngx_log_t *log);
+static ngx_int_t ngx_open_file_stat(ngx_str_t *name,
+    ngx_open_file_info_t *of, ngx_pool_t *pool);
+#if (NGX_THREADS)
+static void ngx_open_file_thread_handler(void *data, ngx_log_t *log);
+static void ngx_open_file_thread_close(ngx_open_file_thread_ctx_t *ctx,
+    ngx_log_t *log);
+static void ngx_open_file_thread_cleanup(void *data);
+#endif
 static void ngx_open_file_add_event(ngx_open_file_cache_t *cache,
     ngx_cached_open_file_t *file, ngx_open_file_info_t *of, ngx_log_t *log);
 static void ngx_open_file_cleanup(void *data);
@@ -183,7 +207,7 @@ ngx_open_cached_file(ngx_open_file_cache_t *cache, ngx_str_t *name,
             return NGX_ERROR;
         }
 
-        rc = ngx_open_and_stat_file(name, of, pool->log);
+        rc = ngx_open_file_stat(name, of, pool);
 
         if (rc == NGX_OK && !of->is_dir) {
             cln->handler = ngx_pool_cleanup_file;
@@ -218,7 +242,13 @@ ngx_open_cached_file(ngx_open_file_cache_t *cache, ngx_str_t *name,
 
             /* file was not used often enough to keep open */
 
-            rc = ngx_open_and_stat_file(name, of, pool->log);
+            rc = ngx_open_file_stat(name, of, pool);
+
+#if (NGX_THREADS)
+            if (rc == NGX_AGAIN) {
+                goto again;
+            }
+#endif
 
             if (rc != NGX_OK && (of->err == 0 || !of->errors)) {
                 goto failed;
@@ -286,7 +316,13 @@ ngx_open_cached_file(ngx_open_file_cache_t *cache, ngx_str_t *name,
         of->fd = file->fd;
         of->uniq = file->uniq;
 
-        rc = ngx_open_and_stat_file(name, of, pool->log);
+        rc = ngx_open_file_stat(name, of, pool);
+
+#if (NGX_THREADS)
+        if (rc == NGX_AGAIN) {
+            goto again;
+        }
+#endif
 
         if (rc != NGX_OK && (of->err == 0 || !of->errors)) {
             goto failed;
@@ -351,7 +387,13 @@ ngx_open_cached_file(ngx_open_file_cache_t *cache, ngx_str_t *name,
 
     /* not found */
 
-    rc = ngx_open_and_stat_file(name, of, pool->log);
+    rc = ngx_open_file_stat(name, of, pool);
+
+#if (NGX_THREADS)
+    if (rc == NGX_AGAIN) {
+        return NGX_AGAIN;
+    }
+#endif
 
     if (rc != NGX_OK && (of->err == 0 || !of->errors)) {
         goto failed;
@@ -483,6 +525,20 @@ failed:
     }
 
     return NGX_ERROR;
+
+#if (NGX_THREADS)
+
+again:
+
+    /* the file is looked up again when the thread is done */
+
+    file->uses--;
+
+    ngx_queue_insert_head(&cache->expire_queue, &file->queue);
+
+    return NGX_AGAIN;
+
+#endif
 }
 
 
@@ -945,6 +1001,146 @@ done:
 }
 
 
+static ngx_int_t
+ngx_open_file_stat(ngx_str_t *name, ngx_open_file_info_t *of,
+    ngx_pool_t *pool)
+{
+#if (NGX_THREADS)
+
+    ngx_int_t                    rc;
+    ngx_thread_task_t           *task;
+    ngx_pool_cleanup_t          *cln;
+    ngx_open_file_thread_ctx_t  *ctx;
+
+    if (of->thread_handler == NULL) {
+        return ngx_open_and_stat_file(name, of, pool->log);
+    }
+
+    task = of->thread_task;
+
+    if (task == NULL) {
+        task = ngx_thread_task_alloc(pool, sizeof(ngx_open_file_thread_ctx_t));
+        if (task == NULL) {
+            return NGX_ERROR;
+        }
+
+        cln = ngx_pool_cleanup_add(pool, 0);
+        if (cln == NULL) {
+            return NGX_ERROR;
+        }
+
+        cln->handler = ngx_open_file_thread_cleanup;
+        cln->data = task;
+
+        task->handler = ngx_open_file_thread_handler;
+
+        of->thread_task = task;
+    }
+
+    ctx = task->ctx;
+
+    if (task->event.complete) {
+        task->event.complete = 0;
+
+        /*
+         * the result is only used if the file is tested the same way,
+         * the cache may have been changed while the thread was running
+         */
+
+        if (ctx->name.len == name->len
+            && ngx_strncmp(ctx->name.data, name->data, name->len) == 0
+            && ctx->fd == of->fd
+            && ctx->uniq == of->uniq)
+        {
+            rc = ctx->rc;
+
+            of->fd = ctx->of.fd;
+            of->uniq = ctx->of.uniq;
+            of->mtime = ctx->of.mtime;
+            of->size = ctx->of.size;
+            of->fs_size = ctx->of.fs_size;
+            of->err = ctx->of.err;
+            of->failed = ctx->of.failed;
+            of->is_dir = ctx->of.is_dir;
+            of->is_file = ctx->of.is_file;
+            of->is_link = ctx->of.is_link;
+            of->is_exec = ctx->of.is_exec;
+            of->is_directio = ctx->of.is_directio;
+
+            ctx->of.fd = ctx->fd;
+
+            ngx_log_debug3(NGX_LOG_DEBUG_CORE, pool->log, 0,
+                           "thread open: \"%V\", fd:%d, e:%d",
+                           name, of->fd, of->err);
+
+            return rc;
+        }
+
+        ngx_open_file_thread_close(ctx, pool->log);
+    }
+
+    ctx->name = *name;
+    ctx->fd = of->fd;
+    ctx->uniq = of->uniq;
+    ctx->of = *of;
+
+    if (of->thread_handler(task, of) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    return NGX_AGAIN;
+
+#else
+
+    return ngx_open_and_stat_file(name, of, pool->log);
+
+#endif
+}
+
+
+#if (NGX_THREADS)
+
+static void
+ngx_open_file_thread_handler(void *data, ngx_log_t *log)
+{
+    ngx_open_file_thread_ctx_t *ctx = data;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_CORE, log, 0,
+                   "thread open handler: \"%V\"", &ctx->name);
+
+    ctx->rc = ngx_open_and_stat_file(&ctx->name, &ctx->of, log);
+}
+
+
+/* closes a descriptor opened by the thread but not used */
+
+static void
+ngx_open_file_thread_close(ngx_open_file_thread_ctx_t *ctx, ngx_log_t *log)
+{
+    if (ctx->of.fd != NGX_INVALID_FILE && ctx->of.fd != ctx->fd) {
+        if (ngx_close_file(ctx->of.fd) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                          ngx_close_file_n " \"%V\" failed", &ctx->name);
+        }
+    }
+
+    ctx->of.fd = ctx->fd;
+}
+
+
+static void
+ngx_open_file_thread_cleanup(void *data)
+{
+    ngx_thread_task_t  *task = data;
+
+    if (task->event.complete) {
+        ngx_open_file_thread_close(task->ctx, ngx_cycle->log);
+    }
+}
+
+#endif
+
+
 /*
  * we ignore any possible event setting error and
  * fallback to usual periodic file retests
@@ -16,7 +16,9 @@
 #define NGX_OPEN_FILE_DIRECTIO_OFF  NGX_MAX_OFF_T_VALUE
 
 
-typedef struct {
+typedef struct ngx_open_file_info_s  ngx_open_file_info_t;
+
+struct ngx_open_file_info_s {
     ngx_fd_t                 fd;
     ngx_file_uniq_t          uniq;
     time_t                   mtime;
@@ -48,7 +50,14 @@ typedef struct {
     unsigned                 is_link:1;
     unsigned                 is_exec:1;
     unsigned                 is_directio:1;
-} ngx_open_file_info_t;
+
+#if (NGX_THREADS)
+    ngx_int_t              (*thread_handler)(ngx_thread_task_t *task,
+                                             ngx_open_file_info_t *of);
+    void                    *thread_ctx;
+    ngx_thread_task_t       *thread_task;
+#endif
+};
 
 
 typedef struct ngx_cached_open_file_s  ngx_cached_open_file_t;
@@ -11,6 +11,37 @@
 
 static void *ngx_palloc_block(ngx_pool_t *pool, size_t size);
 static void *ngx_palloc_large(ngx_pool_t *pool, size_t size);
+static ngx_cached_block_slot_t *ngx_pool_cache_slot(size_t size);
+static void *ngx_get_cached_block(size_t size, ngx_log_t *log);
+static void ngx_free_cached_block(void *p, size_t size);
+
+
+/*
+ * The block cache is process-local and is only enabled in worker
+ * processes, the master process keeps on using the allocator directly.
+ * It is not locked: pools created or destroyed by thread pool tasks
+ * bypass the cache and use the allocator directly.
+ */
+
+static ngx_cached_block_slot_t  ngx_pool_cache[NGX_POOL_CACHE_SLOTS];
+static ngx_uint_t               ngx_pool_cache_nslots;
+static size_t                   ngx_pool_cache_size;
+static size_t                   ngx_pool_cache_max;
+
+#if (NGX_THREADS)
+
+static pthread_t                ngx_pool_cache_thread;
+
+#define ngx_pool_cache_enabled()                                              \
+    (ngx_pool_cache_max                                                       \
+     && pthread_equal(pthread_self(), ngx_pool_cache_thread))
+
+#else
+
+#define ngx_pool_cache_enabled()  (ngx_pool_cache_max != 0)
+
+#endif
+
 
 /*
  * 创建内存池。
@@ -25,7 +56,7 @@ ngx_create_pool(size_t size, ngx_log_t *log)
     ngx_pool_t  *p;
 
     /* 申请size大小内存，关于NGX_POOL_ALIGNMENT对齐 */
-    p = ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
+    p = ngx_get_cached_block(size, log);
     if (p == NULL) {
         return NULL;
     }
@@ -58,6 +89,7 @@ ngx_create_pool(size_t size, ngx_log_t *log)
 void
 ngx_destroy_pool(ngx_pool_t *pool)
 {
+    size_t               size;
     ngx_pool_t          *p, *n;
     ngx_pool_large_t    *l;
     ngx_pool_cleanup_t  *c;
@@ -98,9 +130,11 @@ ngx_destroy_pool(ngx_pool_t *pool)
     }
 
 #endif
-    /* 释放内存池 */
+    /* 释放内存池, 所有块大小相同 */
+    size = (size_t) (pool->d.end - (u_char *) pool);
+
     for (p = pool, n = pool->d.next; /* void */; p = n, n = n->d.next) {
-        ngx_free(p);
+        ngx_free_cached_block(p, size);
 
         if (n == NULL) {
             break;
@@ -216,7 +250,7 @@ ngx_palloc_block(ngx_pool_t *pool, size_t size)
     /* 计算内存池需要的内存空间 */
     psize = (size_t) (pool->d.end - (u_char *) pool);
 
-    m = ngx_memalign(NGX_POOL_ALIGNMENT, psize, pool->log);
+    m = ngx_get_cached_block(psize, pool->log);
     if (m == NULL) {
         return NULL;
     }
@@ -466,19 +500,78 @@ ngx_pool_delete_file(void *data)
 }
 
 
-#if 0
+void
+ngx_pool_cache_init(size_t size)
+{
+    ngx_pool_cache_max = size;
+
+#if (NGX_THREADS)
+    ngx_pool_cache_thread = pthread_self();
+#endif
+}
+
+
+void
+ngx_pool_cache_log(ngx_log_t *log)
+{
+    ngx_uint_t                i;
+    ngx_cached_block_slot_t  *slot;
+
+    for (i = 0; i < ngx_pool_cache_nslots; i++) {
+        slot = &ngx_pool_cache[i];
+
+        ngx_log_error(NGX_LOG_INFO, log, 0,
+                      "pool cache %uz: %ui blocks, %ui hits, %ui misses, "
+                      "%ui overflows",
+                      slot->size, slot->number, slot->hits,
+                      slot->tries - slot->hits, slot->overflows);
+    }
+}
+
+
+static ngx_cached_block_slot_t *
+ngx_pool_cache_slot(size_t size)
+{
+    ngx_uint_t                i;
+    ngx_cached_block_slot_t  *slot;
+
+    /*
+     * pools are created with a handful of distinct sizes,
+     * so slots are keyed by the exact size and scanned linearly
+     */
+
+    for (i = 0; i < ngx_pool_cache_nslots; i++) {
+        if (ngx_pool_cache[i].size == size) {
+            return &ngx_pool_cache[i];
+        }
+    }
+
+    if (ngx_pool_cache_nslots == NGX_POOL_CACHE_SLOTS) {
+        return NULL;
+    }
+
+    slot = &ngx_pool_cache[ngx_pool_cache_nslots++];
+    slot->size = size;
+
+    return slot;
+}
+
 
 static void *
-ngx_get_cached_block(size_t size)
+ngx_get_cached_block(size_t size, ngx_log_t *log)
 {
     void                     *p;
     ngx_cached_block_slot_t  *slot;
 
-    if (ngx_cycle->cache == NULL) {
-        return NULL;
+    if (!ngx_pool_cache_enabled() || size > NGX_POOL_CACHE_MAX_BLOCK) {
+        return ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
     }
 
-    slot = &ngx_cycle->cache[(size + ngx_pagesize - 1) / ngx_pagesize];
+    slot = ngx_pool_cache_slot(size);
+
+    if (slot == NULL) {
+        return ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
+    }
 
     slot->tries++;
 
@@ -486,10 +579,44 @@ ngx_get_cached_block(size_t size)
         p = slot->block;
         slot->block = slot->block->next;
         slot->number--;
+        slot->hits++;
+
+        ngx_pool_cache_size -= size;
+
+        ngx_log_debug2(NGX_LOG_DEBUG_ALLOC, log, 0,
+                       "cached block: %p:%uz", p, size);
+
         return p;
     }
 
-    return NULL;
+    return ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
 }
 
-#endif
+
+static void
+ngx_free_cached_block(void *p, size_t size)
+{
+    ngx_cached_block_t       *block;
+    ngx_cached_block_slot_t  *slot;
+
+    if (!ngx_pool_cache_enabled()
+        || size > NGX_POOL_CACHE_MAX_BLOCK
+        || (slot = ngx_pool_cache_slot(size)) == NULL)
+    {
+        ngx_free(p);
+        return;
+    }
+
+    if (ngx_pool_cache_size + size > ngx_pool_cache_max) {
+        slot->overflows++;
+        ngx_free(p);
+        return;
+    }
+
+    block = p;
+    block->next = slot->block;
+    slot->block = block;
+    slot->number++;
+
+    ngx_pool_cache_size += size;
+}
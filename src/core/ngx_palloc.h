@@ -72,6 +72,27 @@ typedef struct {
 } ngx_pool_cleanup_file_t;
 
 
+#define NGX_POOL_CACHE_SLOTS     8
+#define NGX_POOL_CACHE_MAX_BLOCK (64 * 1024)
+
+typedef struct ngx_cached_block_s  ngx_cached_block_t;
+/* 空闲块, 复用块本身的内存作为链表节点 */
+struct ngx_cached_block_s {
+    ngx_cached_block_t   *next;
+};
+
+/* 块缓存槽: 缓存同一大小的空闲内存池块 */
+typedef struct {
+    size_t                size;
+    ngx_cached_block_t   *block;
+    ngx_uint_t            number;
+
+    ngx_uint_t            tries;
+    ngx_uint_t            hits;
+    ngx_uint_t            overflows;
+} ngx_cached_block_slot_t;
+
+
 void *ngx_alloc(size_t size, ngx_log_t *log);
 void *ngx_calloc(size_t size, ngx_log_t *log);
 
@@ -79,6 +100,9 @@ ngx_pool_t *ngx_create_pool(size_t size, ngx_log_t *log);
 void ngx_destroy_pool(ngx_pool_t *pool);
 void ngx_reset_pool(ngx_pool_t *pool);
 
+void ngx_pool_cache_init(size_t size);
+void ngx_pool_cache_log(ngx_log_t *log);
+
 void *ngx_palloc(ngx_pool_t *pool, size_t size);
 void *ngx_pnalloc(ngx_pool_t *pool, size_t size);
 void *ngx_pcalloc(ngx_pool_t *pool, size_t size);
@@ -9,8 +9,13 @@
 #include <ngx_core.h>
 
 
+#define NGX_REGEX_JIT_STACK_START  (32 * 1024)
+
+
 typedef struct {
     ngx_flag_t  pcre_jit;
+    size_t      jit_stack_size;
+    ngx_flag_t  profile;
 } ngx_regex_conf_t;
 
 
@@ -18,9 +23,15 @@ static void * ngx_libc_cdecl ngx_regex_malloc(size_t size);
 static void ngx_libc_cdecl ngx_regex_free(void *p);
 #if (NGX_HAVE_PCRE_JIT)
 static void ngx_pcre_free_studies(void *data);
+static pcre_jit_stack *ngx_regex_jit_stack_callback(void *data);
+static void ngx_regex_free_jit_stack(void *data);
 #endif
+static uint64_t ngx_regex_profile_time(void);
+static int ngx_libc_cdecl ngx_regex_cmp_profiles(const void *one,
+    const void *two);
 
 static ngx_int_t ngx_regex_module_init(ngx_cycle_t *cycle);
+static void ngx_regex_exit_process(ngx_cycle_t *cycle);
 
 static void *ngx_regex_create_conf(ngx_cycle_t *cycle);
 static char *ngx_regex_init_conf(ngx_cycle_t *cycle, void *conf);
@@ -38,6 +49,20 @@ static ngx_command_t  ngx_regex_commands[] = {
       offsetof(ngx_regex_conf_t, pcre_jit),
       &ngx_regex_pcre_jit_post },
 
+    { ngx_string("pcre_jit_stack_size"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_size_slot,
+      0,
+      offsetof(ngx_regex_conf_t, jit_stack_size),
+      NULL },
+
+    { ngx_string("pcre_profile"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      0,
+      offsetof(ngx_regex_conf_t, profile),
+      NULL },
+
       ngx_null_command
 };
 
@@ -59,7 +84,7 @@ ngx_module_t  ngx_regex_module = {
     NULL,                                  /* init process */
     NULL,                                  /* init thread */
     NULL,                                  /* exit thread */
-    NULL,                                  /* exit process */
+    ngx_regex_exit_process,                /* exit process */
     NULL,                                  /* exit master */
     NGX_MODULE_V1_PADDING
 };
@@ -69,6 +94,27 @@ static ngx_pool_t  *ngx_pcre_pool;
 static ngx_list_t  *ngx_pcre_studies;
 
 
+/*
+ * The ovector is used for matches without captures, it is large enough
+ * for any regex compiled from configuration, so PCRE never has to
+ * allocate a vector for back references at run time, where there is
+ * no pool to allocate from.  The ovector and the JIT stack are process
+ * local and are only used by the main thread of a worker.
+ */
+
+static int         *ngx_regex_ovector;
+static ngx_uint_t   ngx_regex_ovector_size;
+static ngx_uint_t   ngx_regex_max_captures;
+
+#if (NGX_HAVE_PCRE_JIT)
+static pcre_jit_stack  *ngx_regex_jit_stack;
+static size_t           ngx_regex_jit_stack_size;
+#endif
+
+static ngx_uint_t   ngx_regex_profiling;
+static ngx_list_t  *ngx_regex_profiles;
+
+
 void
 ngx_regex_init(void)
 {
@@ -163,7 +209,18 @@ ngx_regex_compile(ngx_regex_compile_t *rc)
         }
 
         elt->regex = rc->regex;
-        elt->name = rc->pattern.data;
+
+        /*
+         * the name is used at run time by the profile log, while
+         * the pattern may live in a temporary configuration pool
+         */
+
+        elt->name = ngx_pnalloc(rc->pool, rc->pattern.len + 1);
+        if (elt->name == NULL) {
+            goto nomem;
+        }
+
+        ngx_cpystrn(elt->name, rc->pattern.data, rc->pattern.len + 1);
     }
 
     n = pcre_fullinfo(re, NULL, PCRE_INFO_CAPTURECOUNT, &rc->captures);
@@ -172,6 +229,12 @@ ngx_regex_compile(ngx_regex_compile_t *rc)
         goto failed;
     }
 
+    if (ngx_pcre_studies != NULL
+        && (ngx_uint_t) rc->captures > ngx_regex_max_captures)
+    {
+        ngx_regex_max_captures = rc->captures;
+    }
+
     if (rc->captures == 0) {
         return NGX_OK;
     }
@@ -216,6 +279,38 @@ nomem:
 }
 
 
+ngx_int_t
+ngx_regex_exec(ngx_regex_t *re, ngx_str_t *s, int *captures, ngx_uint_t size)
+{
+    int       rc;
+    uint64_t  start;
+
+    if (captures == NULL) {
+        captures = ngx_regex_ovector;
+        size = ngx_regex_ovector_size;
+    }
+
+    if (!ngx_regex_profiling) {
+        return pcre_exec(re->code, re->extra, (const char *) s->data, s->len,
+                         0, 0, captures, size);
+    }
+
+    start = ngx_regex_profile_time();
+
+    rc = pcre_exec(re->code, re->extra, (const char *) s->data, s->len,
+                   0, 0, captures, size);
+
+    re->time += ngx_regex_profile_time() - start;
+    re->execs++;
+
+    if (rc >= 0) {
+        re->matches++;
+    }
+
+    return rc;
+}
+
+
 ngx_int_t
 ngx_regex_exec_array(ngx_array_t *a, ngx_str_t *s, ngx_log_t *log)
 {
@@ -249,6 +344,95 @@ ngx_regex_exec_array(ngx_array_t *a, ngx_str_t *s, ngx_log_t *log)
 }
 
 
+void
+ngx_regex_profile_log(ngx_log_t *log)
+{
+    ngx_uint_t        i, n;
+    ngx_regex_elt_t  *elts, *profiles;
+    ngx_list_part_t  *part;
+
+    if (!ngx_regex_profiling) {
+        return;
+    }
+
+    n = 0;
+
+    for (part = &ngx_regex_profiles->part; part; part = part->next) {
+        n += part->nelts;
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    profiles = ngx_alloc(n * sizeof(ngx_regex_elt_t), log);
+    if (profiles == NULL) {
+        return;
+    }
+
+    n = 0;
+
+    for (part = &ngx_regex_profiles->part; part; part = part->next) {
+        elts = part->elts;
+
+        for (i = 0; i < part->nelts; i++) {
+            if (elts[i].regex->execs) {
+                profiles[n++] = elts[i];
+            }
+        }
+    }
+
+    ngx_qsort(profiles, n, sizeof(ngx_regex_elt_t), ngx_regex_cmp_profiles);
+
+    for (i = 0; i < n; i++) {
+        ngx_log_error(NGX_LOG_NOTICE, log, 0,
+                      "regex profile: %uL ns, %ui execs, %ui matches, "
+                      "%uL ns avg: \"%s\"",
+                      profiles[i].regex->time, profiles[i].regex->execs,
+                      profiles[i].regex->matches,
+                      profiles[i].regex->time / profiles[i].regex->execs,
+                      profiles[i].name);
+    }
+
+    ngx_free(profiles);
+}
+
+
+static int ngx_libc_cdecl
+ngx_regex_cmp_profiles(const void *one, const void *two)
+{
+    ngx_regex_elt_t  *first, *second;
+
+    first = (ngx_regex_elt_t *) one;
+    second = (ngx_regex_elt_t *) two;
+
+    if (first->regex->time == second->regex->time) {
+        return 0;
+    }
+
+    return (first->regex->time < second->regex->time) ? 1 : -1;
+}
+
+
+static uint64_t
+ngx_regex_profile_time(void)
+{
+#if (NGX_HAVE_CLOCK_MONOTONIC)
+    struct timespec  ts;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    struct timeval   tv;
+
+    ngx_gettimeofday(&tv);
+
+    return (uint64_t) tv.tv_sec * 1000000000 + tv.tv_usec * 1000;
+#endif
+}
+
+
 static void * ngx_libc_cdecl
 ngx_regex_malloc(size_t size)
 {
@@ -317,27 +501,84 @@ ngx_pcre_free_studies(void *data)
     }
 }
 
+
+/*
+ * The stack is allocated on the first match in a process that needs
+ * more than the default 32K machine stack and is reused afterwards.
+ */
+
+static pcre_jit_stack *
+ngx_regex_jit_stack_callback(void *data)
+{
+    ngx_pool_cleanup_t  *cln;
+
+    if (ngx_regex_jit_stack) {
+        return ngx_regex_jit_stack;
+    }
+
+    cln = ngx_pool_cleanup_add(ngx_cycle->pool, 0);
+    if (cln == NULL) {
+        return NULL;
+    }
+
+    ngx_regex_malloc_init(ngx_cycle->pool);
+
+    ngx_regex_jit_stack = pcre_jit_stack_alloc(NGX_REGEX_JIT_STACK_START,
+                                               (int) ngx_regex_jit_stack_size);
+
+    ngx_regex_malloc_done();
+
+    if (ngx_regex_jit_stack == NULL) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, 0,
+                      "pcre_jit_stack_alloc(%uz) failed",
+                      ngx_regex_jit_stack_size);
+
+        /* do not retry, the default machine stack is used */
+
+        ngx_regex_jit_stack_size = 0;
+        return NULL;
+    }
+
+    cln->handler = ngx_regex_free_jit_stack;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_CORE, ngx_cycle->log, 0,
+                   "pcre jit stack: %uz", ngx_regex_jit_stack_size);
+
+    return ngx_regex_jit_stack;
+}
+
+
+static void
+ngx_regex_free_jit_stack(void *data)
+{
+    pcre_jit_stack_free(ngx_regex_jit_stack);
+    ngx_regex_jit_stack = NULL;
+}
+
 #endif
 
 
 static ngx_int_t
 ngx_regex_module_init(ngx_cycle_t *cycle)
 {
-    int               opt;
-    const char       *errstr;
-    ngx_uint_t        i;
-    ngx_list_part_t  *part;
-    ngx_regex_elt_t  *elts;
+    int                opt, *ovector;
+    const char        *errstr;
+    ngx_uint_t         i, n;
+    ngx_list_part_t   *part;
+    ngx_regex_elt_t   *elts;
+    ngx_regex_conf_t  *rcf;
 
     opt = 0;
 
+    rcf = (ngx_regex_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_regex_module);
+
+    ngx_regex_profiling = rcf->profile;
+    ngx_regex_profiles = ngx_pcre_studies;
+
 #if (NGX_HAVE_PCRE_JIT)
     {
-    ngx_regex_conf_t    *rcf;
     ngx_pool_cleanup_t  *cln;
 
-    rcf = (ngx_regex_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_regex_module);
-
     if (rcf->pcre_jit) {
         opt = PCRE_STUDY_JIT_COMPILE;
 
@@ -360,6 +601,23 @@ ngx_regex_module_init(ngx_cycle_t *cycle)
 
     ngx_regex_malloc_init(cycle->pool);
 
+    n = (ngx_regex_max_captures + 1) * 3;
+
+    if (n > ngx_regex_ovector_size) {
+        ovector = ngx_alloc(n * sizeof(int), cycle->log);
+        if (ovector == NULL) {
+            ngx_regex_malloc_done();
+            return NGX_ERROR;
+        }
+
+        if (ngx_regex_ovector) {
+            ngx_free(ngx_regex_ovector);
+        }
+
+        ngx_regex_ovector = ovector;
+        ngx_regex_ovector_size = n;
+    }
+
     part = &ngx_pcre_studies->part;
     elts = part->elts;
 
@@ -395,6 +653,10 @@ ngx_regex_module_init(ngx_cycle_t *cycle)
                 ngx_log_error(NGX_LOG_INFO, cycle->log, 0,
                               "JIT compiler does not support pattern: \"%s\"",
                               elts[i].name);
+
+            } else if (rcf->jit_stack_size) {
+                pcre_assign_jit_stack(elts[i].regex->extra,
+                                      ngx_regex_jit_stack_callback, NULL);
             }
         }
 #endif
@@ -402,12 +664,23 @@ ngx_regex_module_init(ngx_cycle_t *cycle)
 
     ngx_regex_malloc_done();
 
+#if (NGX_HAVE_PCRE_JIT)
+    ngx_regex_jit_stack_size = rcf->jit_stack_size;
+#endif
+
     ngx_pcre_studies = NULL;
 
     return NGX_OK;
 }
 
 
+static void
+ngx_regex_exit_process(ngx_cycle_t *cycle)
+{
+    ngx_regex_profile_log(cycle->log);
+}
+
+
 static void *
 ngx_regex_create_conf(ngx_cycle_t *cycle)
 {
@@ -419,6 +692,10 @@ ngx_regex_create_conf(ngx_cycle_t *cycle)
     }
 
     rcf->pcre_jit = NGX_CONF_UNSET;
+    rcf->jit_stack_size = NGX_CONF_UNSET_SIZE;
+    rcf->profile = NGX_CONF_UNSET;
+
+    ngx_regex_max_captures = 0;
 
     ngx_pcre_studies = ngx_list_create(cycle->pool, 8, sizeof(ngx_regex_elt_t));
     if (ngx_pcre_studies == NULL) {
@@ -435,6 +712,14 @@ ngx_regex_init_conf(ngx_cycle_t *cycle, void *conf)
     ngx_regex_conf_t *rcf = conf;
 
     ngx_conf_init_value(rcf->pcre_jit, 0);
+    ngx_conf_init_size_value(rcf->jit_stack_size, 0);
+    ngx_conf_init_value(rcf->profile, 0);
+
+    if (rcf->jit_stack_size
+        && rcf->jit_stack_size < NGX_REGEX_JIT_STACK_START)
+    {
+        rcf->jit_stack_size = NGX_REGEX_JIT_STACK_START;
+    }
 
     return NGX_CONF_OK;
 }
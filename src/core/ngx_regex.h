@@ -23,6 +23,11 @@
 typedef struct {
     pcre        *code;
     pcre_extra  *extra;
+
+    /* per-process counters, updated if "pcre_profile" is enabled */
+    ngx_uint_t   execs;
+    ngx_uint_t   matches;
+    uint64_t     time;         /* in nanoseconds */
 } ngx_regex_t;
 
 
@@ -49,12 +54,12 @@ typedef struct {
 void ngx_regex_init(void);
 ngx_int_t ngx_regex_compile(ngx_regex_compile_t *rc);
 
-#define ngx_regex_exec(re, s, captures, size)                                \
-    pcre_exec(re->code, re->extra, (const char *) (s)->data, (s)->len, 0, 0, \
-              captures, size)
+ngx_int_t ngx_regex_exec(ngx_regex_t *re, ngx_str_t *s, int *captures,
+    ngx_uint_t size);
 #define ngx_regex_exec_n      "pcre_exec()"
 
 ngx_int_t ngx_regex_exec_array(ngx_array_t *a, ngx_str_t *s, ngx_log_t *log);
+void ngx_regex_profile_log(ngx_log_t *log);
 
 
 #endif /* _NGX_REGEX_H_INCLUDED_ */
@@ -518,6 +518,7 @@ ngx_resolve_name_locked(ngx_resolver_t *r, ngx_resolver_ctx_t *ctx)
 
                 do {
                     ctx->state = NGX_OK;
+                    ctx->valid = rn->valid;
                     ctx->naddrs = naddrs;
 
                     if (addrs == NULL) {
@@ -671,6 +672,7 @@ ngx_resolve_name_locked(ngx_resolver_t *r, ngx_resolver_ctx_t *ctx)
         ctx->event->handler = ngx_resolver_timeout_handler;
         ctx->event->data = rn;
         ctx->event->log = r->log;
+        ctx->event->cancelable = ctx->cancelable;
         rn->ident = -1;
 
         ngx_add_timer(ctx->event, ctx->timeout);
@@ -864,6 +866,7 @@ ngx_resolve_addr(ngx_resolver_ctx_t *ctx)
     ctx->event->handler = ngx_resolver_timeout_handler;
     ctx->event->data = rn;
     ctx->event->log = r->log;
+    ctx->event->cancelable = ctx->cancelable;
     rn->ident = -1;
 
     ngx_add_timer(ctx->event, ctx->timeout);
@@ -1892,6 +1895,7 @@ ngx_resolver_process_a(ngx_resolver_t *r, u_char *buf, size_t last,
         while (next) {
             ctx = next;
             ctx->state = NGX_OK;
+            ctx->valid = rn->valid;
             ctx->naddrs = naddrs;
 
             if (addrs == NULL) {
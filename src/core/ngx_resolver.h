@@ -158,8 +158,10 @@ struct ngx_resolver_ctx_s {
     ngx_resolver_handler_pt   handler;
     void                     *data;
     ngx_msec_t                timeout;
+    time_t                    valid;
 
     ngx_uint_t                quick;  /* unsigned  quick:1; */
+    ngx_uint_t                cancelable;  /* unsigned  cancelable:1; */
     ngx_uint_t                recursion;
     ngx_event_t              *event;
 };
@@ -164,6 +164,13 @@ static ngx_command_t  ngx_event_core_commands[] = {
       offsetof(ngx_event_conf_t, accept_mutex_delay),
       NULL },
 
+    { ngx_string("timer_wheel"),
+      NGX_EVENT_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      0,
+      offsetof(ngx_event_conf_t, timer_wheel),
+      NULL },
+
     { ngx_string("debug_connection"),
       NGX_EVENT_CONF|NGX_CONF_TAKE1,
       ngx_event_debug_connection,
@@ -644,6 +651,28 @@ ngx_event_process_init(ngx_cycle_t *cycle)
         ngx_use_accept_mutex = 0;
     }
 
+#if (NGX_HAVE_REUSEPORT)
+
+    /*
+     * if every listening socket is split per worker with SO_REUSEPORT
+     * the kernel balances new connections and the accept mutex is useless
+     */
+
+    if (ngx_use_accept_mutex) {
+        ls = cycle->listening.elts;
+        for (i = 0; i < cycle->listening.nelts; i++) {
+            if (!ls[i].reuseport) {
+                break;
+            }
+        }
+
+        if (cycle->listening.nelts && i == cycle->listening.nelts) {
+            ngx_use_accept_mutex = 0;
+        }
+    }
+
+#endif
+
 #if (NGX_WIN32)
 
     /*
@@ -659,7 +688,9 @@ ngx_event_process_init(ngx_cycle_t *cycle)
     ngx_queue_init(&ngx_posted_accept_events);
     ngx_queue_init(&ngx_posted_events);
 
-    /* 初始化 event timer （rb树） */
+    ngx_use_timer_wheel = ecf->timer_wheel;
+
+    /* 初始化 event timer （rb树或时间轮） */
     if (ngx_event_timer_init(cycle->log) == NGX_ERROR) {
         return NGX_ERROR;
     }
@@ -807,6 +838,16 @@ ngx_event_process_init(ngx_cycle_t *cycle)
     ls = cycle->listening.elts;
     for (i = 0; i < cycle->listening.nelts; i++) {
 
+#if (NGX_HAVE_REUSEPORT)
+        /* reuseport 套接字只由其所属的 worker 进程处理 */
+        if (ls[i].reuseport
+            && ls[i].worker != ngx_worker
+            && ngx_process == NGX_PROCESS_WORKER)
+        {
+            continue;
+        }
+#endif
+
         /* 依次取出每个空闲链接进行初始化 */
         c = ngx_get_connection(ls[i].fd, cycle->log);
 
@@ -890,7 +931,13 @@ ngx_event_process_init(ngx_cycle_t *cycle)
         /* 设置listening 数组的读事件句柄 ngx_event_accept */
         rev->handler = ngx_event_accept;
 
-        if (ngx_use_accept_mutex) {
+        /* 每个 worker 独占的 reuseport 套接字无需 accept 锁 */
+        if (ngx_use_accept_mutex
+#if (NGX_HAVE_REUSEPORT)
+            && !ls[i].reuseport
+#endif
+           )
+        {
             continue;
         }
 
@@ -1248,6 +1295,7 @@ ngx_event_core_create_conf(ngx_cycle_t *cycle)
     ecf->multi_accept = NGX_CONF_UNSET;
     ecf->accept_mutex = NGX_CONF_UNSET;
     ecf->accept_mutex_delay = NGX_CONF_UNSET_MSEC;
+    ecf->timer_wheel = NGX_CONF_UNSET;
     ecf->name = (void *) NGX_CONF_UNSET;
 
 #if (NGX_DEBUG)
@@ -1368,6 +1416,7 @@ ngx_event_core_init_conf(ngx_cycle_t *cycle, void *conf)
     ngx_conf_init_value(ecf->multi_accept, 0);
     ngx_conf_init_value(ecf->accept_mutex, 1);
     ngx_conf_init_msec_value(ecf->accept_mutex_delay, 500);
+    ngx_conf_init_value(ecf->timer_wheel, 0);
 
 
 #if (NGX_HAVE_RTSIG)
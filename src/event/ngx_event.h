@@ -479,6 +479,8 @@ typedef struct {
 
     ngx_msec_t    accept_mutex_delay;
 
+    ngx_flag_t    timer_wheel;
+
     u_char       *name;
 
 #if (NGX_DEBUG)
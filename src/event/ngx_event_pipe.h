@@ -34,6 +34,15 @@ struct ngx_event_pipe_s {
     ngx_chain_t       *free;
     ngx_chain_t       *busy;
 
+    /* the chain being written to the temp file by a thread */
+    ngx_chain_t       *writing;
+
+#if (NGX_THREADS)
+    ngx_int_t        (*thread_handler)(ngx_thread_task_t *task,
+                                       ngx_file_t *file);
+    void              *thread_ctx;
+#endif
+
     /*
      * the input filter i.e. that moves HTTP/1.1 chunks
      * from the raw bufs to an incoming chain
@@ -56,6 +65,7 @@ struct ngx_event_pipe_s {
     unsigned           downstream_done:1;
     unsigned           downstream_error:1;
     unsigned           cyclic_temp_file:1;
+    unsigned           aio:1;
 
     ngx_int_t          allocated;
     ngx_bufs_t         bufs;
@@ -10,9 +10,59 @@
 #include <ngx_event.h>
 
 
+/*
+ * the hierarchical timing wheel: the first level has 256 slots of 1ms,
+ * each of the next four levels has 64 slots covering 64 slots of the
+ * previous level, so the wheel spans 2^32 milliseconds; a slot is
+ * a circular list of the timer nodes linked through node->left (previous)
+ * and node->right (next)
+ */
+
+#define NGX_TIMER_WHEEL_ROOT_BITS  8
+#define NGX_TIMER_WHEEL_BITS       6
+#define NGX_TIMER_WHEEL_ROOT_SIZE  (1 << NGX_TIMER_WHEEL_ROOT_BITS)
+#define NGX_TIMER_WHEEL_SIZE       (1 << NGX_TIMER_WHEEL_BITS)
+#define NGX_TIMER_WHEEL_ROOT_MASK  (NGX_TIMER_WHEEL_ROOT_SIZE - 1)
+#define NGX_TIMER_WHEEL_MASK       (NGX_TIMER_WHEEL_SIZE - 1)
+#define NGX_TIMER_WHEEL_LEVELS     4
+
+#define NGX_TIMER_WHEEL_SLOTS                                                 \
+    (NGX_TIMER_WHEEL_ROOT_SIZE + NGX_TIMER_WHEEL_LEVELS * NGX_TIMER_WHEEL_SIZE)
+
+#define ngx_timer_wheel_shift(level)                                          \
+    (NGX_TIMER_WHEEL_ROOT_BITS + (level) * NGX_TIMER_WHEEL_BITS)
+
+#define ngx_timer_wheel_slot(level, n)                                        \
+    (NGX_TIMER_WHEEL_ROOT_SIZE + (level) * NGX_TIMER_WHEEL_SIZE              \
+     + ((n) & NGX_TIMER_WHEEL_MASK))
+
+/* timers beyond 63 slots of the last level are kept in its farthest slot */
+#define NGX_TIMER_WHEEL_MAX                                                   \
+    ((ngx_msec_t) NGX_TIMER_WHEEL_MASK << ngx_timer_wheel_shift(3))
+
+#define NGX_TIMER_WHEEL_WORD       (8 * sizeof(uintptr_t))
+
+
+static void ngx_event_timer_wheel_cascade(ngx_uint_t level);
+static ngx_uint_t ngx_event_timer_wheel_next(ngx_uint_t from, ngx_uint_t to);
+static ngx_msec_t ngx_event_find_timer_wheel(void);
+static void ngx_event_expire_timers_wheel(void);
+static void ngx_event_cancel_timers_wheel(void);
+
+
 ngx_rbtree_t              ngx_event_timer_rbtree;
 static ngx_rbtree_node_t  ngx_event_timer_sentinel;
 
+ngx_uint_t                ngx_use_timer_wheel;
+
+static ngx_rbtree_node_t  ngx_event_timer_wheel[NGX_TIMER_WHEEL_SLOTS];
+static uintptr_t          ngx_event_timer_wheel_bits[NGX_TIMER_WHEEL_SLOTS
+                                                     / NGX_TIMER_WHEEL_WORD];
+
+/* all timers earlier than ngx_event_timer_jiffies are already expired */
+static ngx_msec_t         ngx_event_timer_jiffies;
+static ngx_uint_t         ngx_event_timer_wheel_n;
+
 /*
  * the event timer rbtree may contain the duplicate keys, however,
  * it should not be a problem, because we use the rbtree to find
@@ -22,9 +72,27 @@ static ngx_rbtree_node_t  ngx_event_timer_sentinel;
 ngx_int_t
 ngx_event_timer_init(ngx_log_t *log)
 {
+    ngx_uint_t  i;
+
     ngx_rbtree_init(&ngx_event_timer_rbtree, &ngx_event_timer_sentinel,
                     ngx_rbtree_insert_timer_value);
 
+    if (ngx_use_timer_wheel) {
+
+        for (i = 0; i < NGX_TIMER_WHEEL_SLOTS; i++) {
+            ngx_event_timer_wheel[i].left = &ngx_event_timer_wheel[i];
+            ngx_event_timer_wheel[i].right = &ngx_event_timer_wheel[i];
+        }
+
+        ngx_memzero(ngx_event_timer_wheel_bits,
+                    sizeof(ngx_event_timer_wheel_bits));
+
+        ngx_event_timer_jiffies = ngx_current_msec;
+        ngx_event_timer_wheel_n = 0;
+
+        ngx_log_debug0(NGX_LOG_DEBUG_EVENT, log, 0, "event timer wheel");
+    }
+
     return NGX_OK;
 }
 
@@ -35,6 +103,10 @@ ngx_event_find_timer(void)
     ngx_msec_int_t      timer;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_use_timer_wheel) {
+        return ngx_event_find_timer_wheel();
+    }
+
     if (ngx_event_timer_rbtree.root == &ngx_event_timer_sentinel) {
         return NGX_TIMER_INFINITE;
     }
@@ -56,6 +128,11 @@ ngx_event_expire_timers(void)
     ngx_event_t        *ev;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_use_timer_wheel) {
+        ngx_event_expire_timers_wheel();
+        return;
+    }
+
     sentinel = ngx_event_timer_rbtree.sentinel;
 
     for ( ;; ) {
@@ -102,6 +179,11 @@ ngx_event_cancel_timers(void)
     ngx_event_t        *ev;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_use_timer_wheel) {
+        ngx_event_cancel_timers_wheel();
+        return;
+    }
+
     sentinel = ngx_event_timer_rbtree.sentinel;
 
     for ( ;; ) {
@@ -136,3 +218,380 @@ ngx_event_cancel_timers(void)
         ev->handler(ev);
     }
 }
+
+
+ngx_int_t
+ngx_event_no_timers_left(void)
+{
+    if (ngx_use_timer_wheel) {
+        return ngx_event_timer_wheel_n ? NGX_AGAIN : NGX_OK;
+    }
+
+    if (ngx_event_timer_rbtree.root == ngx_event_timer_rbtree.sentinel) {
+        return NGX_OK;
+    }
+
+    return NGX_AGAIN;
+}
+
+
+void
+ngx_event_timer_wheel_insert(ngx_rbtree_node_t *node)
+{
+    ngx_uint_t          i, level;
+    ngx_msec_t          key;
+    ngx_msec_int_t      diff;
+    ngx_rbtree_node_t  *head;
+
+    key = node->key;
+    diff = (ngx_msec_int_t) (key - ngx_event_timer_jiffies);
+
+    if (diff < 0) {
+
+        /* the timer has already expired, run it on the nearest tick */
+
+        i = ngx_event_timer_jiffies & NGX_TIMER_WHEEL_ROOT_MASK;
+
+    } else if (diff < NGX_TIMER_WHEEL_ROOT_SIZE) {
+        i = key & NGX_TIMER_WHEEL_ROOT_MASK;
+
+    } else {
+
+        if ((ngx_msec_t) diff > NGX_TIMER_WHEEL_MAX) {
+            key = ngx_event_timer_jiffies + NGX_TIMER_WHEEL_MAX;
+            diff = (ngx_msec_int_t) NGX_TIMER_WHEEL_MAX;
+        }
+
+        for (level = 0; level < NGX_TIMER_WHEEL_LEVELS - 1; level++) {
+            if ((ngx_msec_t) diff
+                < (ngx_msec_t) 1 << ngx_timer_wheel_shift(level + 1))
+            {
+                break;
+            }
+        }
+
+        i = ngx_timer_wheel_slot(level, key >> ngx_timer_wheel_shift(level));
+    }
+
+    head = &ngx_event_timer_wheel[i];
+
+    node->left = head->left;
+    node->right = head;
+    head->left->right = node;
+    head->left = node;
+
+    ngx_event_timer_wheel_bits[i / NGX_TIMER_WHEEL_WORD]
+                                   |= (uintptr_t) 1 << (i % NGX_TIMER_WHEEL_WORD);
+
+    ngx_event_timer_wheel_n++;
+}
+
+
+void
+ngx_event_timer_wheel_delete(ngx_rbtree_node_t *node)
+{
+    ngx_uint_t          i;
+    ngx_rbtree_node_t  *prev, *next;
+
+    prev = node->left;
+    next = node->right;
+
+    prev->right = next;
+    next->left = prev;
+
+    ngx_event_timer_wheel_n--;
+
+    /* the list became empty, so "prev" and "next" are both its head */
+
+    if (prev == next
+        && prev >= &ngx_event_timer_wheel[0]
+        && prev < &ngx_event_timer_wheel[NGX_TIMER_WHEEL_SLOTS])
+    {
+        i = prev - ngx_event_timer_wheel;
+
+        ngx_event_timer_wheel_bits[i / NGX_TIMER_WHEEL_WORD]
+                                  &= ~((uintptr_t) 1 << (i % NGX_TIMER_WHEEL_WORD));
+    }
+}
+
+
+static ngx_msec_t
+ngx_event_find_timer_wheel(void)
+{
+    ngx_uint_t      i, level, index, first, last, shift, d;
+    ngx_msec_t      jiffies, timer, next;
+    ngx_msec_int_t  diff;
+
+    if (ngx_event_timer_wheel_n == 0) {
+        return NGX_TIMER_INFINITE;
+    }
+
+    jiffies = ngx_event_timer_jiffies;
+    index = jiffies & NGX_TIMER_WHEEL_ROOT_MASK;
+
+    timer = NGX_TIMER_INFINITE;
+
+    i = ngx_event_timer_wheel_next(index, NGX_TIMER_WHEEL_ROOT_SIZE);
+
+    if (i < NGX_TIMER_WHEEL_ROOT_SIZE) {
+        timer = jiffies + (i - index);
+
+        /*
+         * the first level slots of the current round are exact unless
+         * the round has not started yet and its timers are still waiting
+         * to be cascaded from the upper levels
+         */
+
+        if (index) {
+            goto found;
+        }
+
+    } else {
+        i = ngx_event_timer_wheel_next(0, index);
+
+        if (i < index) {
+            timer = jiffies + (NGX_TIMER_WHEEL_ROOT_SIZE + i - index);
+        }
+    }
+
+    /*
+     * a slot of the upper levels gives a lower bound only, that is the time
+     * it will be cascaded at; an early wake up just cascades the slot and
+     * finds the exact value
+     */
+
+    for (level = 0; level < NGX_TIMER_WHEEL_LEVELS; level++) {
+
+        shift = ngx_timer_wheel_shift(level);
+        first = ngx_timer_wheel_slot(level, 0);
+        last = first + NGX_TIMER_WHEEL_SIZE;
+        index = ngx_timer_wheel_slot(level, jiffies >> shift);
+
+        /*
+         * the current slot is cascaded at the beginning of its block,
+         * after that it contains the timers of the next round only
+         */
+
+        if ((jiffies & (((ngx_msec_t) 1 << shift) - 1)) == 0
+            && ngx_event_timer_wheel_next(index, index + 1) == index)
+        {
+            timer = jiffies;
+            break;
+        }
+
+        i = ngx_event_timer_wheel_next(index + 1, last);
+
+        if (i == last) {
+            i = ngx_event_timer_wheel_next(first, index + 1);
+
+            if (i == index + 1) {
+                continue;
+            }
+        }
+
+        d = (i - index) & NGX_TIMER_WHEEL_MASK;
+
+        if (d == 0) {
+            d = NGX_TIMER_WHEEL_SIZE;
+        }
+
+        next = ((jiffies >> shift) + d) << shift;
+
+        if (timer == NGX_TIMER_INFINITE
+            || (ngx_msec_int_t) (next - timer) < 0)
+        {
+            timer = next;
+        }
+    }
+
+found:
+
+    diff = (ngx_msec_int_t) (timer - ngx_current_msec);
+
+    return (ngx_msec_t) (diff > 0 ? diff : 0);
+}
+
+
+static void
+ngx_event_expire_timers_wheel(void)
+{
+    ngx_uint_t          i, index, level;
+    ngx_msec_t          next;
+    ngx_event_t        *ev;
+    ngx_rbtree_node_t  *head, *node;
+
+    while ((ngx_msec_int_t) (ngx_current_msec - ngx_event_timer_jiffies) >= 0)
+    {
+        index = ngx_event_timer_jiffies & NGX_TIMER_WHEEL_ROOT_MASK;
+
+        if (index == 0) {
+
+            /* cascade the upper levels slots of the new round */
+
+            for (level = 0; level < NGX_TIMER_WHEEL_LEVELS; level++) {
+
+                ngx_event_timer_wheel_cascade(level);
+
+                if (((ngx_event_timer_jiffies
+                      >> ngx_timer_wheel_shift(level)) & NGX_TIMER_WHEEL_MASK)
+                    != 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        head = &ngx_event_timer_wheel[index];
+
+        while (head->right != head) {
+            node = head->right;
+
+            ev = (ngx_event_t *) ((char *) node - offsetof(ngx_event_t, timer));
+
+            ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                           "event timer del: %d: %M",
+                           ngx_event_ident(ev->data), ev->timer.key);
+
+            ngx_event_timer_wheel_delete(node);
+
+#if (NGX_DEBUG)
+            ev->timer.left = NULL;
+            ev->timer.right = NULL;
+            ev->timer.parent = NULL;
+#endif
+
+            ev->timer_set = 0;
+
+            ev->timedout = 1;
+
+            ev->handler(ev);
+        }
+
+        /* skip the empty slots up to the next round */
+
+        i = ngx_event_timer_wheel_next(index + 1, NGX_TIMER_WHEEL_ROOT_SIZE);
+
+        next = ngx_event_timer_jiffies + (i - index);
+
+        if ((ngx_msec_int_t) (next - ngx_current_msec) > 0) {
+            next = ngx_current_msec + 1;
+        }
+
+        ngx_event_timer_jiffies = next;
+    }
+}
+
+
+static void
+ngx_event_timer_wheel_cascade(ngx_uint_t level)
+{
+    ngx_uint_t          i;
+    ngx_rbtree_node_t  *head, *node;
+
+    i = ngx_timer_wheel_slot(level,
+                             ngx_event_timer_jiffies
+                             >> ngx_timer_wheel_shift(level));
+
+    head = &ngx_event_timer_wheel[i];
+
+    while (head->right != head) {
+        node = head->right;
+
+        ngx_event_timer_wheel_delete(node);
+        ngx_event_timer_wheel_insert(node);
+    }
+}
+
+
+static void
+ngx_event_cancel_timers_wheel(void)
+{
+    ngx_uint_t          i;
+    ngx_event_t        *ev;
+    ngx_rbtree_node_t   cancel, *head, *node, *next;
+
+    /*
+     * the cancelable timers are moved to a separate list first, as
+     * the handlers may add or delete other timers
+     */
+
+    cancel.left = &cancel;
+    cancel.right = &cancel;
+
+    for (i = 0; i < NGX_TIMER_WHEEL_SLOTS; i++) {
+
+        head = &ngx_event_timer_wheel[i];
+
+        for (node = head->right; node != head; node = next) {
+            next = node->right;
+
+            ev = (ngx_event_t *) ((char *) node - offsetof(ngx_event_t, timer));
+
+            if (!ev->cancelable) {
+                continue;
+            }
+
+            ngx_event_timer_wheel_delete(node);
+
+            node->left = cancel.left;
+            node->right = &cancel;
+            cancel.left->right = node;
+            cancel.left = node;
+
+            ngx_event_timer_wheel_n++;
+        }
+    }
+
+    while (cancel.right != &cancel) {
+        node = cancel.right;
+
+        ev = (ngx_event_t *) ((char *) node - offsetof(ngx_event_t, timer));
+
+        ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                       "event timer cancel: %d: %M",
+                       ngx_event_ident(ev->data), ev->timer.key);
+
+        ngx_event_timer_wheel_delete(node);
+
+#if (NGX_DEBUG)
+        ev->timer.left = NULL;
+        ev->timer.right = NULL;
+        ev->timer.parent = NULL;
+#endif
+
+        ev->timer_set = 0;
+
+        ev->handler(ev);
+    }
+}
+
+
+/* returns the first occupied slot in [from, to) or "to" if there is none */
+
+static ngx_uint_t
+ngx_event_timer_wheel_next(ngx_uint_t from, ngx_uint_t to)
+{
+    ngx_uint_t  i;
+    uintptr_t   word;
+
+    i = from;
+
+    while (i < to) {
+        word = ngx_event_timer_wheel_bits[i / NGX_TIMER_WHEEL_WORD]
+               >> (i % NGX_TIMER_WHEEL_WORD);
+
+        if (word == 0) {
+            i = (i / NGX_TIMER_WHEEL_WORD + 1) * NGX_TIMER_WHEEL_WORD;
+            continue;
+        }
+
+        while ((word & 1) == 0) {
+            word >>= 1;
+            i++;
+        }
+
+        return i < to ? i : to;
+    }
+
+    return to;
+}
@@ -38,6 +38,65 @@ typedef struct {
 } ngx_http_geo_variable_value_node_t;
 
 
+/*
+ * 预编译的二进制 geo 库, 只读映射到内存, 所有进程共享页缓存,
+ * 重新加载配置时不需要重建树.  文件由 contrib/geo2bin.pl 生成,
+ * 格式为 (主机字节序, IPv6 地址为网络字节序):
+ *
+ *     header   "NGXGEOB1", uint32_t 0x01020304, number of values,
+ *              default value index, number of IPv4 ranges,
+ *              number of IPv6 ranges, reserved
+ *     values   uint32_t offset, uint32_t length
+ *     IPv4     uint32_t starts[n], uint32_t ends[n], uint32_t values[n]
+ *     IPv6     u_char starts[n][16], u_char ends[n][16], uint32_t values[n]
+ *     strings
+ *
+ * 范围按起始地址排序且互不重叠, 查找时二分只访问连续的起始地址数组.
+ */
+
+#define NGX_HTTP_GEO_COMPILED_MAGIC    "NGXGEOB1"
+#define NGX_HTTP_GEO_COMPILED_ORDER    0x01020304
+#define NGX_HTTP_GEO_COMPILED_NONE     0xffffffff
+
+
+typedef struct {
+    u_char                           magic[8];
+    uint32_t                         order;
+    uint32_t                         nvalues;
+    uint32_t                         default_value;
+    uint32_t                         nranges;
+    uint32_t                         nranges6;
+    uint32_t                         reserved;
+} ngx_http_geo_compiled_header_t;
+
+
+typedef struct {
+    uint32_t                         offset;
+    uint32_t                         len;
+} ngx_http_geo_compiled_value_t;
+
+
+typedef struct {
+    u_char                          *start;
+    size_t                           size;
+    ngx_str_t                        name;
+
+    ngx_http_geo_compiled_value_t   *values;
+    uint32_t                         nvalues;
+    uint32_t                         default_value;
+
+    uint32_t                        *starts;
+    uint32_t                        *ends;
+    uint32_t                        *indexes;
+    ngx_uint_t                       nranges;
+
+    u_char                          *starts6;
+    u_char                          *ends6;
+    uint32_t                        *indexes6;
+    ngx_uint_t                       nranges6;
+} ngx_http_geo_compiled_t;
+
+
 typedef struct {
     ngx_http_variable_value_t       *value;
     ngx_str_t                       *net;
@@ -49,6 +108,7 @@ typedef struct {
     ngx_rbtree_t                     rbtree;
     ngx_rbtree_node_t                sentinel;
     ngx_array_t                     *proxies;
+    ngx_http_geo_compiled_t         *compiled;
     ngx_pool_t                      *pool;
     ngx_pool_t                      *temp_pool;
 
@@ -70,6 +130,7 @@ typedef struct {
     union {
         ngx_http_geo_trees_t         trees;
         ngx_http_geo_high_ranges_t   high;
+        ngx_http_geo_compiled_t     *compiled;
     } u;
 
     ngx_array_t                     *proxies;
@@ -79,6 +140,12 @@ typedef struct {
 } ngx_http_geo_ctx_t;
 
 
+static uint32_t ngx_http_geo_compiled_find(ngx_http_geo_compiled_t *geo,
+    in_addr_t addr);
+#if (NGX_HAVE_INET6)
+static uint32_t ngx_http_geo_compiled_find6(ngx_http_geo_compiled_t *geo,
+    u_char *addr);
+#endif
 static ngx_int_t ngx_http_geo_addr(ngx_http_request_t *r,
     ngx_http_geo_ctx_t *ctx, ngx_addr_t *addr);
 static ngx_int_t ngx_http_geo_real_addr(ngx_http_request_t *r,
@@ -108,6 +175,9 @@ static ngx_int_t ngx_http_geo_include_binary_base(ngx_conf_t *cf,
 static void ngx_http_geo_create_binary_base(ngx_http_geo_conf_ctx_t *ctx);
 static u_char *ngx_http_geo_copy_values(u_char *base, u_char *p,
     ngx_rbtree_node_t *node, ngx_rbtree_node_t *sentinel);
+static char *ngx_http_geo_include_compiled(ngx_conf_t *cf,
+    ngx_http_geo_conf_ctx_t *ctx, ngx_str_t *name);
+static void ngx_http_geo_compiled_cleanup(void *data);
 
 
 static ngx_command_t  ngx_http_geo_commands[] = {
@@ -310,6 +380,143 @@ ngx_http_geo_range_variable(ngx_http_request_t *r, ngx_http_variable_value_t *v,
 }
 
 
+static ngx_int_t
+ngx_http_geo_compiled_variable(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data)
+{
+    ngx_http_geo_ctx_t *ctx = (ngx_http_geo_ctx_t *) data;
+
+    uint32_t                        n;
+    in_addr_t                       inaddr;
+    ngx_addr_t                      addr;
+    struct sockaddr_in             *sin;
+    ngx_http_geo_compiled_t        *geo;
+    ngx_http_geo_compiled_value_t  *value;
+#if (NGX_HAVE_INET6)
+    u_char                         *p;
+    struct in6_addr                *inaddr6;
+#endif
+
+    geo = ctx->u.compiled;
+
+    if (ngx_http_geo_addr(r, ctx, &addr) == NGX_OK) {
+
+        switch (addr.sockaddr->sa_family) {
+
+#if (NGX_HAVE_INET6)
+        case AF_INET6:
+            inaddr6 = &((struct sockaddr_in6 *) addr.sockaddr)->sin6_addr;
+            p = inaddr6->s6_addr;
+
+            if (!IN6_IS_ADDR_V4MAPPED(inaddr6)) {
+                n = ngx_http_geo_compiled_find6(geo, p);
+                goto done;
+            }
+
+            inaddr = p[12] << 24;
+            inaddr += p[13] << 16;
+            inaddr += p[14] << 8;
+            inaddr += p[15];
+
+            break;
+#endif
+
+        default: /* AF_INET */
+            sin = (struct sockaddr_in *) addr.sockaddr;
+            inaddr = ntohl(sin->sin_addr.s_addr);
+            break;
+        }
+
+    } else {
+        inaddr = INADDR_NONE;
+    }
+
+    n = ngx_http_geo_compiled_find(geo, inaddr);
+
+#if (NGX_HAVE_INET6)
+done:
+#endif
+
+    if (n == NGX_HTTP_GEO_COMPILED_NONE) {
+        *v = ngx_http_variable_null_value;
+
+    } else {
+        value = &geo->values[n];
+
+        v->len = value->len;
+        v->valid = 1;
+        v->no_cacheable = 0;
+        v->not_found = 0;
+        v->data = geo->start + value->offset;
+    }
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                   "http geo compiled: %v", v);
+
+    return NGX_OK;
+}
+
+
+/* the ranges do not overlap, so only the last one starting below matters */
+
+static uint32_t
+ngx_http_geo_compiled_find(ngx_http_geo_compiled_t *geo, in_addr_t addr)
+{
+    ngx_uint_t  left, right, middle;
+
+    left = 0;
+    right = geo->nranges;
+
+    while (left < right) {
+        middle = left + (right - left) / 2;
+
+        if (geo->starts[middle] <= addr) {
+            left = middle + 1;
+
+        } else {
+            right = middle;
+        }
+    }
+
+    if (left == 0 || addr > geo->ends[left - 1]) {
+        return geo->default_value;
+    }
+
+    return geo->indexes[left - 1];
+}
+
+
+#if (NGX_HAVE_INET6)
+
+static uint32_t
+ngx_http_geo_compiled_find6(ngx_http_geo_compiled_t *geo, u_char *addr)
+{
+    ngx_uint_t  left, right, middle;
+
+    left = 0;
+    right = geo->nranges6;
+
+    while (left < right) {
+        middle = left + (right - left) / 2;
+
+        if (ngx_memcmp(geo->starts6 + middle * 16, addr, 16) <= 0) {
+            left = middle + 1;
+
+        } else {
+            right = middle;
+        }
+    }
+
+    if (left == 0 || ngx_memcmp(addr, geo->ends6 + (left - 1) * 16, 16) > 0) {
+        return geo->default_value;
+    }
+
+    return geo->indexes6[left - 1];
+}
+
+#endif
+
+
 static ngx_int_t
 ngx_http_geo_addr(ngx_http_request_t *r, ngx_http_geo_ctx_t *ctx,
     ngx_addr_t *addr)
@@ -463,7 +670,16 @@ ngx_http_geo_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     geo->proxies = ctx.proxies;
     geo->proxy_recursive = ctx.proxy_recursive;
 
-    if (ctx.ranges) {
+    if (ctx.compiled) {
+        geo->u.compiled = ctx.compiled;
+
+        var->get_handler = ngx_http_geo_compiled_variable;
+        var->data = (uintptr_t) geo;
+
+        ngx_destroy_pool(ctx.temp_pool);
+        ngx_destroy_pool(pool);
+
+    } else if (ctx.ranges) {
 
         if (ctx.high.low && !ctx.binary_include) {
             for (i = 0; i < 0x10000; i++) {
@@ -610,6 +826,12 @@ ngx_http_geo(ngx_conf_t *cf, ngx_command_t *dummy, void *conf)
 
         goto done;
 
+    } else if (ngx_strcmp(value[0].data, "include_binary") == 0) {
+
+        rv = ngx_http_geo_include_compiled(cf, ctx, &value[1]);
+
+        goto done;
+
     } else if (ngx_strcmp(value[0].data, "proxy") == 0) {
 
         if (ngx_http_geo_cidr_value(cf, &value[1], &cidr) != NGX_OK) {
@@ -621,6 +843,13 @@ ngx_http_geo(ngx_conf_t *cf, ngx_command_t *dummy, void *conf)
         goto done;
     }
 
+    if (ctx->compiled) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "compiled geo base \"%s\" cannot be mixed "
+                           "with usual entries", ctx->compiled->name.data);
+        goto failed;
+    }
+
     if (ctx->ranges) {
         rv = ngx_http_geo_range(cf, ctx, value);
 
@@ -1642,3 +1871,242 @@ ngx_http_geo_copy_values(u_char *base, u_char *p, ngx_rbtree_node_t *node,
 
     return ngx_http_geo_copy_values(base, p, node->right, sentinel);
 }
+
+
+static char *
+ngx_http_geo_include_compiled(ngx_conf_t *cf, ngx_http_geo_conf_ctx_t *ctx,
+    ngx_str_t *name)
+{
+    u_char                          *start, *p, *last;
+    size_t                           size;
+    ngx_fd_t                         fd;
+    ngx_uint_t                       i;
+    ngx_file_info_t                  fi;
+    ngx_pool_cleanup_t              *cln;
+    ngx_http_geo_compiled_t         *geo;
+    ngx_http_geo_compiled_value_t   *value;
+    ngx_http_geo_compiled_header_t  *h;
+
+    if (ctx->compiled) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "duplicate compiled geo base \"%V\"", name);
+        return NGX_CONF_ERROR;
+    }
+
+    if (ctx->entries || ctx->high.low || ctx->high.default_value
+        || ctx->tree
+#if (NGX_HAVE_INET6)
+        || ctx->tree6
+#endif
+       )
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "compiled geo base \"%V\" cannot be mixed "
+                           "with usual entries", name);
+        return NGX_CONF_ERROR;
+    }
+
+    /* the compiled base lives as long as the cycle */
+
+    geo = ngx_pcalloc(ctx->pool, sizeof(ngx_http_geo_compiled_t));
+    if (geo == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    geo->name.len = name->len;
+    geo->name.data = ngx_pnalloc(ctx->pool, name->len + 1);
+    if (geo->name.data == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    ngx_cpystrn(geo->name.data, name->data, name->len + 1);
+
+    if (ngx_conf_full_name(cf->cycle, &geo->name, 1) != NGX_OK) {
+        return NGX_CONF_ERROR;
+    }
+
+    fd = ngx_open_file(geo->name.data, NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           ngx_open_file_n " \"%s\" failed", geo->name.data);
+        return NGX_CONF_ERROR;
+    }
+
+    if (ngx_fd_info(fd, &fi) == NGX_FILE_ERROR) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           ngx_fd_info_n " \"%s\" failed", geo->name.data);
+        goto failed;
+    }
+
+    size = (size_t) ngx_file_size(&fi);
+
+    if (size < sizeof(ngx_http_geo_compiled_header_t)) {
+        goto invalid;
+    }
+
+    /*
+     * the file is used in place without any relocation, so all worker
+     * processes and configuration generations share the same pages;
+     * it must only be replaced atomically, with rename(): a file truncated
+     * or rewritten in place raises SIGBUS in the workers and voids the
+     * checks below
+     */
+
+    start = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (start == MAP_FAILED) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           "mmap(%uz) \"%s\" failed", size, geo->name.data);
+        goto failed;
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, cf->log, ngx_errno,
+                      ngx_close_file_n " \"%s\" failed", geo->name.data);
+    }
+
+    fd = NGX_INVALID_FILE;
+
+    cln = ngx_pool_cleanup_add(ctx->pool, 0);
+    if (cln == NULL) {
+        munmap(start, size);
+        return NGX_CONF_ERROR;
+    }
+
+    geo->start = start;
+    geo->size = size;
+
+    cln->handler = ngx_http_geo_compiled_cleanup;
+    cln->data = geo;
+
+    h = (ngx_http_geo_compiled_header_t *) start;
+
+    if (ngx_memcmp(h->magic, NGX_HTTP_GEO_COMPILED_MAGIC, 8) != 0) {
+        goto invalid;
+    }
+
+    if (h->order != NGX_HTTP_GEO_COMPILED_ORDER) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "compiled geo base \"%s\" has wrong byte order",
+                           geo->name.data);
+        return NGX_CONF_ERROR;
+    }
+
+    /* all sections are multiples of 4 bytes, so the arrays stay aligned */
+
+    p = start + sizeof(ngx_http_geo_compiled_header_t);
+    last = start + size;
+
+    if (h->nvalues > (size_t) (last - p)
+                     / sizeof(ngx_http_geo_compiled_value_t))
+    {
+        goto invalid;
+    }
+
+    geo->values = (ngx_http_geo_compiled_value_t *) p;
+    geo->nvalues = h->nvalues;
+    p += h->nvalues * sizeof(ngx_http_geo_compiled_value_t);
+
+    if (h->nranges > (size_t) (last - p) / (3 * sizeof(uint32_t))) {
+        goto invalid;
+    }
+
+    geo->starts = (uint32_t *) p;
+    geo->ends = geo->starts + h->nranges;
+    geo->indexes = geo->ends + h->nranges;
+    geo->nranges = h->nranges;
+    p += h->nranges * 3 * sizeof(uint32_t);
+
+    if (h->nranges6 > (size_t) (last - p) / (2 * 16 + sizeof(uint32_t))) {
+        goto invalid;
+    }
+
+    geo->starts6 = p;
+    geo->ends6 = geo->starts6 + h->nranges6 * 16;
+    geo->indexes6 = (uint32_t *) (geo->ends6 + h->nranges6 * 16);
+    geo->nranges6 = h->nranges6;
+
+    geo->default_value = h->default_value;
+
+    if (geo->default_value != NGX_HTTP_GEO_COMPILED_NONE
+        && geo->default_value >= geo->nvalues)
+    {
+        goto invalid;
+    }
+
+    /* the lookups rely on bounds and order, so both are checked once */
+
+    for (i = 0; i < geo->nvalues; i++) {
+        value = &geo->values[i];
+
+        if (value->offset > size || value->len > size - value->offset) {
+            goto invalid;
+        }
+    }
+
+    for (i = 0; i < geo->nranges; i++) {
+
+        if (geo->starts[i] > geo->ends[i]
+            || geo->indexes[i] >= geo->nvalues
+            || (i && geo->starts[i] <= geo->ends[i - 1]))
+        {
+            goto unsorted;
+        }
+    }
+
+    for (i = 0; i < geo->nranges6; i++) {
+
+        if (ngx_memcmp(geo->starts6 + i * 16, geo->ends6 + i * 16, 16) > 0
+            || geo->indexes6[i] >= geo->nvalues
+            || (i && ngx_memcmp(geo->starts6 + i * 16,
+                                geo->ends6 + (i - 1) * 16, 16) <= 0))
+        {
+            goto unsorted;
+        }
+    }
+
+    ctx->compiled = geo;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_HTTP, cf->log, 0,
+                   "geo compiled \"%s\": %ui IPv4 and %ui IPv6 ranges",
+                   geo->name.data, geo->nranges, geo->nranges6);
+
+    return NGX_CONF_OK;
+
+unsorted:
+
+    ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                       "compiled geo base \"%s\" has unsorted, overlapping "
+                       "or invalid range %ui", geo->name.data, i);
+    return NGX_CONF_ERROR;
+
+invalid:
+
+    ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                       "invalid compiled geo base \"%s\"", geo->name.data);
+
+failed:
+
+    if (fd != NGX_INVALID_FILE) {
+        if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_ALERT, cf->log, ngx_errno,
+                          ngx_close_file_n " \"%s\" failed", geo->name.data);
+        }
+    }
+
+    return NGX_CONF_ERROR;
+}
+
+
+static void
+ngx_http_geo_compiled_cleanup(void *data)
+{
+    ngx_http_geo_compiled_t  *geo = data;
+
+    if (munmap(geo->start, geo->size) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "munmap(%uz) \"%s\" failed",
+                      geo->size, geo->name.data);
+    }
+}
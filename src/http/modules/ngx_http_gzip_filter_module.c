@@ -26,6 +26,10 @@ typedef struct {
     size_t               memlevel;
     ssize_t              min_length;
 
+#if (NGX_THREADS)
+    ngx_thread_pool_t   *thread_pool;
+#endif
+
     ngx_array_t         *types_keys;
 } ngx_http_gzip_conf_t;
 
@@ -64,9 +68,24 @@ typedef struct {
     uint32_t             crc32;
     z_stream             zstream;
     ngx_http_request_t  *request;
+
+#if (NGX_THREADS)
+    ngx_thread_task_t   *thread_task;
+#endif
 } ngx_http_gzip_ctx_t;
 
 
+#if (NGX_THREADS)
+
+typedef struct {
+    z_stream            *zstream;
+    int                  flush;
+    int                  rc;
+} ngx_http_gzip_thread_ctx_t;
+
+#endif
+
+
 #if (NGX_HAVE_LITTLE_ENDIAN && NGX_HAVE_NONALIGNED)
 
 struct gztrailer {
@@ -100,6 +119,12 @@ static ngx_int_t ngx_http_gzip_filter_deflate(ngx_http_request_t *r,
     ngx_http_gzip_ctx_t *ctx);
 static ngx_int_t ngx_http_gzip_filter_deflate_end(ngx_http_request_t *r,
     ngx_http_gzip_ctx_t *ctx);
+#if (NGX_THREADS)
+static ngx_int_t ngx_http_gzip_filter_deflate_thread(ngx_http_request_t *r,
+    ngx_http_gzip_ctx_t *ctx);
+static void ngx_http_gzip_thread_handler(void *data, ngx_log_t *log);
+static void ngx_http_gzip_thread_event_handler(ngx_event_t *ev);
+#endif
 
 static void *ngx_http_gzip_filter_alloc(void *opaque, u_int items,
     u_int size);
@@ -117,6 +142,10 @@ static char *ngx_http_gzip_merge_conf(ngx_conf_t *cf,
     void *parent, void *child);
 static char *ngx_http_gzip_window(ngx_conf_t *cf, void *post, void *data);
 static char *ngx_http_gzip_hash(ngx_conf_t *cf, void *post, void *data);
+#if (NGX_THREADS)
+static char *ngx_http_gzip_thread_pool(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+#endif
 
 
 static ngx_conf_num_bounds_t  ngx_http_gzip_comp_level_bounds = {
@@ -193,6 +222,17 @@ static ngx_command_t  ngx_http_gzip_filter_commands[] = {
       offsetof(ngx_http_gzip_conf_t, min_length),
       NULL },
 
+#if (NGX_THREADS)
+
+    { ngx_string("gzip_thread_pool"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
+      ngx_http_gzip_thread_pool,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      0,
+      NULL },
+
+#endif
+
       ngx_null_command
 };
 
@@ -329,6 +369,24 @@ ngx_http_gzip_body_filter(ngx_http_request_t *r, ngx_chain_t *in)
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
                    "http gzip filter");
 
+#if (NGX_THREADS)
+
+    if (ctx->thread_task && ctx->thread_task->event.active) {
+
+        /*
+         * deflate() is running in a thread, the zlib stream must not be
+         * touched until the task completes, so just queue the new data
+         */
+
+        if (in && ngx_chain_add_copy(r->pool, &ctx->in, in) != NGX_OK) {
+            return NGX_ERROR;
+        }
+
+        return NGX_AGAIN;
+    }
+
+#endif
+
     if (ctx->buffering) {
 
         /*
@@ -426,7 +484,7 @@ ngx_http_gzip_body_filter(ngx_http_request_t *r, ngx_chain_t *in)
 
             rc = ngx_http_gzip_filter_deflate(r, ctx);
 
-            if (rc == NGX_OK) {
+            if (rc == NGX_OK || rc == NGX_BUSY) {
                 break;
             }
 
@@ -440,7 +498,7 @@ ngx_http_gzip_body_filter(ngx_http_request_t *r, ngx_chain_t *in)
         if (ctx->out == NULL && !flush) {
             ngx_http_gzip_filter_free_copy_buf(r, ctx);
 
-            return ctx->busy ? NGX_AGAIN : NGX_OK;
+            return (ctx->busy || rc == NGX_BUSY) ? NGX_AGAIN : NGX_OK;
         }
 
         if (!ctx->gzheader) {
@@ -467,6 +525,14 @@ ngx_http_gzip_body_filter(ngx_http_request_t *r, ngx_chain_t *in)
         if (ctx->done) {
             return rc;
         }
+
+#if (NGX_THREADS)
+
+        if (ctx->thread_task && ctx->thread_task->event.active) {
+            return NGX_AGAIN;
+        }
+
+#endif
     }
 
     /* unreachable */
@@ -671,6 +737,17 @@ ngx_http_gzip_filter_gzheader(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
 static ngx_int_t
 ngx_http_gzip_filter_add_data(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
 {
+#if (NGX_THREADS)
+
+    if (ctx->thread_task && ctx->thread_task->event.complete) {
+
+        /* the result of deflate() run in a thread is not processed yet */
+
+        return NGX_OK;
+    }
+
+#endif
+
     if (ctx->zstream.avail_in || ctx->flush != Z_NO_FLUSH || ctx->redo) {
         return NGX_OK;
     }
@@ -735,6 +812,14 @@ ngx_http_gzip_filter_get_buf(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
 {
     ngx_http_gzip_conf_t  *conf;
 
+#if (NGX_THREADS)
+
+    if (ctx->thread_task && ctx->thread_task->event.complete) {
+        return NGX_OK;
+    }
+
+#endif
+
     if (ctx->zstream.avail_out) {
         return NGX_OK;
     }
@@ -775,6 +860,25 @@ ngx_http_gzip_filter_deflate(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
     ngx_buf_t             *b;
     ngx_chain_t           *cl;
     ngx_http_gzip_conf_t  *conf;
+#if (NGX_THREADS)
+    ngx_thread_task_t     *task;
+#endif
+
+    conf = ngx_http_get_module_loc_conf(r, ngx_http_gzip_filter_module);
+
+#if (NGX_THREADS)
+
+    task = ctx->thread_task;
+
+    if (task && task->event.complete) {
+        task->event.complete = 0;
+
+        rc = ((ngx_http_gzip_thread_ctx_t *) task->ctx)->rc;
+
+        goto deflated;
+    }
+
+#endif
 
     ngx_log_debug6(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
                  "deflate in: ni:%p no:%p ai:%ud ao:%ud fl:%d redo:%d",
@@ -782,8 +886,31 @@ ngx_http_gzip_filter_deflate(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
                  ctx->zstream.avail_in, ctx->zstream.avail_out,
                  ctx->flush, ctx->redo);
 
+#if (NGX_THREADS)
+
+    if (conf->thread_pool) {
+
+        switch (ngx_http_gzip_filter_deflate_thread(r, ctx)) {
+
+        case NGX_OK:
+            return NGX_BUSY;
+
+        case NGX_DECLINED:
+            break;
+
+        default: /* NGX_ERROR */
+            return NGX_ERROR;
+        }
+    }
+
+#endif
+
     rc = deflate(&ctx->zstream, ctx->flush);
 
+#if (NGX_THREADS)
+deflated:
+#endif
+
     if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) {
         ngx_log_error(NGX_LOG_ALERT, r->connection->log, 0,
                       "deflate() failed: %d, %d", ctx->flush, rc);
@@ -874,8 +1001,6 @@ ngx_http_gzip_filter_deflate(ngx_http_request_t *r, ngx_http_gzip_ctx_t *ctx)
         return NGX_OK;
     }
 
-    conf = ngx_http_get_module_loc_conf(r, ngx_http_gzip_filter_module);
-
     if (conf->no_buffer && ctx->in == NULL) {
 
         cl = ngx_alloc_chain_link(r->pool);
@@ -983,6 +1108,84 @@ ngx_http_gzip_filter_deflate_end(ngx_http_request_t *r,
 }
 
 
+#if (NGX_THREADS)
+
+static ngx_int_t
+ngx_http_gzip_filter_deflate_thread(ngx_http_request_t *r,
+    ngx_http_gzip_ctx_t *ctx)
+{
+    ngx_thread_task_t           *task;
+    ngx_http_gzip_conf_t        *conf;
+    ngx_http_gzip_thread_ctx_t  *tctx;
+
+    task = ctx->thread_task;
+
+    if (task == NULL) {
+        task = ngx_thread_task_alloc(r->pool,
+                                     sizeof(ngx_http_gzip_thread_ctx_t));
+        if (task == NULL) {
+            return NGX_ERROR;
+        }
+
+        task->handler = ngx_http_gzip_thread_handler;
+        task->event.data = r;
+        task->event.handler = ngx_http_gzip_thread_event_handler;
+
+        ctx->thread_task = task;
+    }
+
+    tctx = task->ctx;
+
+    tctx->zstream = &ctx->zstream;
+    tctx->flush = ctx->flush;
+
+    conf = ngx_http_get_module_loc_conf(r, ngx_http_gzip_filter_module);
+
+    if (ngx_thread_task_post(conf->thread_pool, task) != NGX_OK) {
+
+        /* the queue is full, compress in the worker */
+
+        return NGX_DECLINED;
+    }
+
+    /* make the following flushes reach the filter to get the result */
+
+    r->connection->buffered |= NGX_HTTP_GZIP_BUFFERED;
+
+    r->main->blocked++;
+    r->aio = 1;
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_gzip_thread_handler(void *data, ngx_log_t *log)
+{
+    ngx_http_gzip_thread_ctx_t *ctx = data;
+
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, log, 0, "gzip thread handler");
+
+    ctx->rc = deflate(ctx->zstream, ctx->flush);
+}
+
+
+static void
+ngx_http_gzip_thread_event_handler(ngx_event_t *ev)
+{
+    ngx_http_request_t  *r;
+
+    r = ev->data;
+
+    r->main->blocked--;
+    r->aio = 0;
+
+    r->connection->write->handler(r->connection->write);
+}
+
+#endif
+
+
 static void *
 ngx_http_gzip_filter_alloc(void *opaque, u_int items, u_int size)
 {
@@ -1138,6 +1341,10 @@ ngx_http_gzip_create_conf(ngx_conf_t *cf)
     conf->memlevel = NGX_CONF_UNSET_SIZE;
     conf->min_length = NGX_CONF_UNSET;
 
+#if (NGX_THREADS)
+    conf->thread_pool = NGX_CONF_UNSET_PTR;
+#endif
+
     return conf;
 }
 
@@ -1162,6 +1369,10 @@ ngx_http_gzip_merge_conf(ngx_conf_t *cf, void *parent, void *child)
                               MAX_MEM_LEVEL - 1);
     ngx_conf_merge_value(conf->min_length, prev->min_length, 20);
 
+#if (NGX_THREADS)
+    ngx_conf_merge_ptr_value(conf->thread_pool, prev->thread_pool, NULL);
+#endif
+
     if (ngx_http_merge_types(cf, &conf->types_keys, &conf->types,
                              &prev->types_keys, &prev->types,
                              ngx_http_html_default_types)
@@ -1233,3 +1444,35 @@ ngx_http_gzip_hash(ngx_conf_t *cf, void *post, void *data)
 
     return "must be 512, 1k, 2k, 4k, 8k, 16k, 32k, 64k, or 128k";
 }
+
+
+#if (NGX_THREADS)
+
+static char *
+ngx_http_gzip_thread_pool(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_http_gzip_conf_t *gcf = conf;
+
+    ngx_str_t  *value;
+
+    if (gcf->thread_pool != NGX_CONF_UNSET_PTR) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "off") == 0) {
+        gcf->thread_pool = NULL;
+        return NGX_CONF_OK;
+    }
+
+    gcf->thread_pool = ngx_thread_pool_add(cf, &value[1]);
+
+    if (gcf->thread_pool == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    return NGX_CONF_OK;
+}
+
+#endif
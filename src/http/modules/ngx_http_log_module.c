@@ -52,9 +52,47 @@ typedef struct {
     ngx_event_t                *event;
     ngx_msec_t                  flush;
     ngx_int_t                   gzip;
+
+#if (NGX_THREADS)
+    ngx_thread_pool_t          *thread_pool;
+    ngx_thread_task_t         **tasks;      /* queue + 1 buffers */
+    ngx_uint_t                  queue;
+    ngx_uint_t                  head;
+    ngx_uint_t                  pending;
+    ngx_uint_t                  overflow;
+    size_t                      dropped;
+    time_t                      error_log_time;
+#endif
 } ngx_http_log_buf_t;
 
 
+#if (NGX_THREADS)
+
+/*
+ * when all "queue" buffers wait for the thread pool, the full buffer is
+ * either written by the worker itself with "overflow=block", stalling it
+ * and writing its lines before the queued ones, or it is discarded with
+ * "overflow=drop", so the newest lines are lost while the queued ones
+ * are kept
+ */
+
+#define NGX_HTTP_LOG_OVERFLOW_BLOCK  0
+#define NGX_HTTP_LOG_OVERFLOW_DROP   1
+
+
+typedef struct {
+    ngx_fd_t                    fd;
+    u_char                     *start;
+    size_t                      len;
+    ngx_int_t                   gzip;
+    ssize_t                     n;
+    ngx_err_t                   err;
+    ngx_atomic_t                done;
+} ngx_http_log_thread_ctx_t;
+
+#endif
+
+
 typedef struct {
     ngx_array_t                *lengths;
     ngx_array_t                *values;
@@ -104,8 +142,20 @@ static void ngx_http_log_gzip_free(void *opaque, void *address);
 #endif
 
 static void ngx_http_log_flush(ngx_open_file_t *file, ngx_log_t *log);
+static void ngx_http_log_flush_buf(ngx_open_file_t *file, ngx_fd_t fd,
+    u_char *buf, size_t len, ngx_log_t *log);
+static void ngx_http_log_flush_result(ngx_open_file_t *file, ssize_t n,
+    size_t len, ngx_err_t err, ngx_log_t *log);
 static void ngx_http_log_flush_handler(ngx_event_t *ev);
 
+#if (NGX_THREADS)
+static void ngx_http_log_thread_flush(ngx_open_file_t *file, ngx_log_t *log);
+static void ngx_http_log_thread_drain(ngx_open_file_t *file, ngx_log_t *log);
+static void ngx_http_log_thread_post(ngx_open_file_t *file, ngx_log_t *log);
+static void ngx_http_log_thread_handler(void *data, ngx_log_t *log);
+static void ngx_http_log_thread_event_handler(ngx_event_t *ev);
+#endif
+
 static u_char *ngx_http_log_pipe(ngx_http_request_t *r, u_char *buf,
     ngx_http_log_op_t *op);
 static u_char *ngx_http_log_time(ngx_http_request_t *r, u_char *buf,
@@ -314,10 +364,19 @@ ngx_http_log_handler(ngx_http_request_t *r)
 
             if (len > (size_t) (buffer->last - buffer->pos)) {
 
-                ngx_http_log_write(r, &log[l], buffer->start,
-                                   buffer->pos - buffer->start);
+#if (NGX_THREADS)
+                if (buffer->thread_pool) {
+                    ngx_http_log_thread_flush(log[l].file,
+                                              r->connection->log);
+
+                } else
+#endif
+                {
+                    ngx_http_log_write(r, &log[l], buffer->start,
+                                       buffer->pos - buffer->start);
 
-                buffer->pos = buffer->start;
+                    buffer->pos = buffer->start;
+                }
             }
 
             if (len <= (size_t) (buffer->last - buffer->pos)) {
@@ -575,7 +634,6 @@ ngx_http_log_gzip(ngx_fd_t fd, u_char *buf, size_t len, ngx_int_t level,
     ssize_t      n;
     z_stream     zstream;
     ngx_err_t    err;
-    ngx_pool_t  *pool;
 
     wbits = MAX_WBITS;
     memlevel = MAX_MEM_LEVEL - 1;
@@ -594,22 +652,20 @@ ngx_http_log_gzip(ngx_fd_t fd, u_char *buf, size_t len, ngx_int_t level,
 
     ngx_memzero(&zstream, sizeof(z_stream));
 
-    pool = ngx_create_pool(256, log);
-    if (pool == NULL) {
+    /*
+     * this may run in a thread pool task, so memory is allocated directly
+     * rather than from a pool: the pool block cache is not thread-safe
+     */
+
+    out = ngx_alloc(size, log);
+    if (out == NULL) {
         /* simulate successful logging */
         return len;
     }
 
-    pool->log = log;
-
     zstream.zalloc = ngx_http_log_gzip_alloc;
     zstream.zfree = ngx_http_log_gzip_free;
-    zstream.opaque = pool;
-
-    out = ngx_pnalloc(pool, size);
-    if (out == NULL) {
-        goto done;
-    }
+    zstream.opaque = log;
 
     zstream.next_in = buf;
     zstream.avail_in = len;
@@ -634,6 +690,7 @@ ngx_http_log_gzip(ngx_fd_t fd, u_char *buf, size_t len, ngx_int_t level,
     if (rc != Z_STREAM_END) {
         ngx_log_error(NGX_LOG_ALERT, log, 0,
                       "deflate(Z_FINISH) failed: %d", rc);
+        (void) deflateEnd(&zstream);
         goto done;
     }
 
@@ -657,7 +714,7 @@ ngx_http_log_gzip(ngx_fd_t fd, u_char *buf, size_t len, ngx_int_t level,
     if (n != (ssize_t) size) {
         err = (n == -1) ? ngx_errno : 0;
 
-        ngx_destroy_pool(pool);
+        ngx_free(out);
 
         ngx_set_errno(err);
         return -1;
@@ -665,7 +722,7 @@ ngx_http_log_gzip(ngx_fd_t fd, u_char *buf, size_t len, ngx_int_t level,
 
 done:
 
-    ngx_destroy_pool(pool);
+    ngx_free(out);
 
     /* simulate successful logging */
     return len;
@@ -675,12 +732,12 @@ done:
 static void *
 ngx_http_log_gzip_alloc(void *opaque, u_int items, u_int size)
 {
-    ngx_pool_t *pool = opaque;
+    ngx_log_t *log = opaque;
 
-    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, pool->log, 0,
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
                    "gzip alloc: n:%ud s:%ud", items, size);
 
-    return ngx_palloc(pool, items * size);
+    return ngx_alloc(items * size, log);
 }
 
 
@@ -688,10 +745,12 @@ static void
 ngx_http_log_gzip_free(void *opaque, void *address)
 {
 #if 0
-    ngx_pool_t *pool = opaque;
+    ngx_log_t *log = opaque;
 
-    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pool->log, 0, "gzip free: %p", address);
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, log, 0, "gzip free: %p", address);
 #endif
+
+    ngx_free(address);
 }
 
 #endif
@@ -701,29 +760,71 @@ static void
 ngx_http_log_flush(ngx_open_file_t *file, ngx_log_t *log)
 {
     size_t               len;
-    ssize_t              n;
     ngx_http_log_buf_t  *buffer;
 
     buffer = file->data;
 
+#if (NGX_THREADS)
+
+    if (buffer->thread_pool) {
+
+        if (!ngx_exiting && !ngx_terminate) {
+            ngx_http_log_thread_flush(file, log);
+            return;
+        }
+
+        /* the worker is going away, the queued buffers are written here */
+
+        ngx_http_log_thread_drain(file, log);
+    }
+
+#endif
+
     len = buffer->pos - buffer->start;
 
     if (len == 0) {
         return;
     }
 
+    ngx_http_log_flush_buf(file, file->fd, buffer->start, len, log);
+
+    buffer->pos = buffer->start;
+
+    if (buffer->event && buffer->event->timer_set) {
+        ngx_del_timer(buffer->event);
+    }
+}
+
+
+static void
+ngx_http_log_flush_buf(ngx_open_file_t *file, ngx_fd_t fd, u_char *buf,
+    size_t len, ngx_log_t *log)
+{
+    ssize_t  n;
 #if (NGX_ZLIB)
+    ngx_http_log_buf_t  *buffer;
+
+    buffer = file->data;
+
     if (buffer->gzip) {
-        n = ngx_http_log_gzip(file->fd, buffer->start, len, buffer->gzip, log);
+        n = ngx_http_log_gzip(fd, buf, len, buffer->gzip, log);
     } else {
-        n = ngx_write_fd(file->fd, buffer->start, len);
+        n = ngx_write_fd(fd, buf, len);
     }
 #else
-    n = ngx_write_fd(file->fd, buffer->start, len);
+    n = ngx_write_fd(fd, buf, len);
 #endif
 
+    ngx_http_log_flush_result(file, n, len, (n == -1) ? ngx_errno : 0, log);
+}
+
+
+static void
+ngx_http_log_flush_result(ngx_open_file_t *file, ssize_t n, size_t len,
+    ngx_err_t err, ngx_log_t *log)
+{
     if (n == -1) {
-        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+        ngx_log_error(NGX_LOG_ALERT, log, err,
                       ngx_write_fd_n " to \"%s\" failed",
                       file->name.data);
 
@@ -732,12 +833,6 @@ ngx_http_log_flush(ngx_open_file_t *file, ngx_log_t *log)
                       ngx_write_fd_n " to \"%s\" was incomplete: %z of %uz",
                       file->name.data, n, len);
     }
-
-    buffer->pos = buffer->start;
-
-    if (buffer->event && buffer->event->timer_set) {
-        ngx_del_timer(buffer->event);
-    }
 }
 
 
@@ -764,6 +859,215 @@ ngx_http_log_flush_handler(ngx_event_t *ev)
 }
 
 
+#if (NGX_THREADS)
+
+static void
+ngx_http_log_thread_flush(ngx_open_file_t *file, ngx_log_t *log)
+{
+    size_t                      len, size;
+    ngx_uint_t                  n;
+    ngx_http_log_buf_t         *buffer;
+    ngx_http_log_thread_ctx_t  *ctx;
+
+    buffer = file->data;
+
+    len = buffer->pos - buffer->start;
+
+    if (len == 0) {
+        return;
+    }
+
+    if (buffer->event && buffer->event->timer_set) {
+        ngx_del_timer(buffer->event);
+    }
+
+    if (buffer->pending == buffer->queue) {
+
+        if (buffer->overflow == NGX_HTTP_LOG_OVERFLOW_DROP) {
+            buffer->dropped += len;
+
+            if (ngx_time() - buffer->error_log_time > 59) {
+                ngx_log_error(NGX_LOG_WARN, log, 0,
+                              "access log \"%s\" queue is full, "
+                              "%uz bytes dropped",
+                              file->name.data, buffer->dropped);
+
+                buffer->error_log_time = ngx_time();
+                buffer->dropped = 0;
+            }
+
+        } else {
+
+            /* the lines written here may precede the queued ones */
+
+            ngx_http_log_flush_buf(file, file->fd, buffer->start, len, log);
+        }
+
+        buffer->pos = buffer->start;
+        return;
+    }
+
+    n = buffer->queue + 1;
+    size = buffer->last - buffer->start;
+
+    ctx = buffer->tasks[(buffer->head + buffer->pending) % n]->ctx;
+
+    /*
+     * the descriptor is duplicated, so the file may be reopened
+     * while the buffer is still waiting in the queue
+     */
+
+    ctx->fd = dup(file->fd);
+
+    if (ctx->fd == NGX_INVALID_FILE) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "dup() of \"%s\" failed", file->name.data);
+
+        ngx_http_log_flush_buf(file, file->fd, buffer->start, len, log);
+
+        buffer->pos = buffer->start;
+        return;
+    }
+
+    ctx->len = len;
+    ctx->gzip = buffer->gzip;
+    ctx->done = 0;
+
+    if (buffer->pending++ == 0) {
+        ngx_http_log_thread_post(file, log);
+    }
+
+    ctx = buffer->tasks[(buffer->head + buffer->pending) % n]->ctx;
+
+    buffer->start = ctx->start;
+    buffer->pos = ctx->start;
+    buffer->last = ctx->start + size;
+}
+
+
+static void
+ngx_http_log_thread_drain(ngx_open_file_t *file, ngx_log_t *log)
+{
+    ngx_uint_t                  i, n;
+    ngx_http_log_buf_t         *buffer;
+    ngx_http_log_thread_ctx_t  *ctx;
+
+    buffer = file->data;
+
+    if (buffer->pending == 0) {
+        return;
+    }
+
+    /*
+     * the head buffer is being written by a thread, the others are
+     * written after it to keep the order of lines; the thread pool
+     * runs all tasks posted before it exits, so the wait is finite
+     */
+
+    ctx = buffer->tasks[buffer->head]->ctx;
+
+    while (!ctx->done) {
+        ngx_msleep(1);
+    }
+
+    n = buffer->queue + 1;
+
+    for (i = 1; i < buffer->pending; i++) {
+        ctx = buffer->tasks[(buffer->head + i) % n]->ctx;
+
+        ngx_http_log_flush_buf(file, ctx->fd, ctx->start, ctx->len, log);
+
+        (void) ngx_close_file(ctx->fd);
+    }
+
+    buffer->pending = 1;
+}
+
+
+static void
+ngx_http_log_thread_post(ngx_open_file_t *file, ngx_log_t *log)
+{
+    ngx_thread_task_t          *task;
+    ngx_http_log_buf_t         *buffer;
+    ngx_http_log_thread_ctx_t  *ctx;
+
+    buffer = file->data;
+
+    while (buffer->pending) {
+        task = buffer->tasks[buffer->head];
+
+        if (ngx_thread_task_post(buffer->thread_pool, task) == NGX_OK) {
+            return;
+        }
+
+        /* the thread pool queue is full, write in the worker */
+
+        ctx = task->ctx;
+
+        ngx_http_log_flush_buf(file, ctx->fd, ctx->start, ctx->len, log);
+
+        (void) ngx_close_file(ctx->fd);
+
+        buffer->head = (buffer->head + 1) % (buffer->queue + 1);
+        buffer->pending--;
+    }
+}
+
+
+static void
+ngx_http_log_thread_handler(void *data, ngx_log_t *log)
+{
+    ngx_http_log_thread_ctx_t *ctx = data;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, log, 0,
+                   "http log thread handler: %uz", ctx->len);
+
+#if (NGX_ZLIB)
+    if (ctx->gzip) {
+        ctx->n = ngx_http_log_gzip(ctx->fd, ctx->start, ctx->len, ctx->gzip,
+                                   log);
+    } else {
+        ctx->n = ngx_write_fd(ctx->fd, ctx->start, ctx->len);
+    }
+#else
+    ctx->n = ngx_write_fd(ctx->fd, ctx->start, ctx->len);
+#endif
+
+    ctx->err = (ctx->n == -1) ? ngx_errno : 0;
+
+    (void) ngx_close_file(ctx->fd);
+
+    /* the worker may be waiting in ngx_http_log_thread_drain() */
+
+    ngx_memory_barrier();
+
+    ctx->done = 1;
+}
+
+
+static void
+ngx_http_log_thread_event_handler(ngx_event_t *ev)
+{
+    ngx_open_file_t            *file;
+    ngx_http_log_buf_t         *buffer;
+    ngx_http_log_thread_ctx_t  *ctx;
+
+    file = ev->data;
+    buffer = file->data;
+
+    ctx = buffer->tasks[buffer->head]->ctx;
+
+    ngx_http_log_flush_result(file, ctx->n, ctx->len, ctx->err, ev->log);
+
+    buffer->head = (buffer->head + 1) % (buffer->queue + 1);
+    buffer->pending--;
+
+    ngx_http_log_thread_post(file, ev->log);
+}
+
+#endif
+
+
 static u_char *
 ngx_http_log_copy_short(ngx_http_request_t *r, u_char *buf,
     ngx_http_log_op_t *op)
@@ -1157,6 +1461,12 @@ ngx_http_log_set_log(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     ngx_http_log_main_conf_t          *lmcf;
     ngx_http_script_compile_t          sc;
     ngx_http_compile_complex_value_t   ccv;
+#if (NGX_THREADS)
+    ngx_uint_t                         queue, overflow;
+    ngx_thread_task_t                 *task;
+    ngx_thread_pool_t                 *tp;
+    ngx_http_log_thread_ctx_t         *ctx;
+#endif
 
     value = cf->args->elts;
 
@@ -1270,6 +1580,11 @@ process_formats:
     size = 0;
     flush = 0;
     gzip = 0;
+#if (NGX_THREADS)
+    tp = NULL;
+    queue = 0;
+    overflow = NGX_CONF_UNSET_UINT;
+#endif
 
     for (i = 3; i < cf->args->nelts; i++) {
 
@@ -1336,6 +1651,63 @@ process_formats:
 #endif
         }
 
+        if (ngx_strncmp(value[i].data, "threads", 7) == 0
+            && (value[i].len == 7 || value[i].data[7] == '='))
+        {
+#if (NGX_THREADS)
+            if (size == 0) {
+                size = 64 * 1024;
+            }
+
+            if (value[i].len == 7) {
+                tp = ngx_thread_pool_add(cf, NULL);
+
+            } else {
+                s.len = value[i].len - 8;
+                s.data = value[i].data + 8;
+
+                tp = ngx_thread_pool_add(cf, &s);
+            }
+
+            if (tp == NULL) {
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "nginx was built without threads support");
+            return NGX_CONF_ERROR;
+#endif
+        }
+
+#if (NGX_THREADS)
+
+        if (ngx_strncmp(value[i].data, "queue=", 6) == 0) {
+            queue = ngx_atoi(value[i].data + 6, value[i].len - 6);
+
+            if (queue == (ngx_uint_t) NGX_ERROR || queue == 0) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "invalid queue size \"%V\"", &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
+        if (ngx_strcmp(value[i].data, "overflow=drop") == 0) {
+            overflow = NGX_HTTP_LOG_OVERFLOW_DROP;
+            continue;
+        }
+
+        if (ngx_strcmp(value[i].data, "overflow=block") == 0) {
+            overflow = NGX_HTTP_LOG_OVERFLOW_BLOCK;
+            continue;
+        }
+
+#endif
+
         if (ngx_strncmp(value[i].data, "if=", 3) == 0) {
             s.len = value[i].len - 3;
             s.data = value[i].data + 3;
@@ -1371,6 +1743,25 @@ process_formats:
         return NGX_CONF_ERROR;
     }
 
+#if (NGX_THREADS)
+
+    if (tp == NULL && (queue || overflow != NGX_CONF_UNSET_UINT)) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "\"queue\" and \"overflow\" require \"threads\" "
+                           "for access_log \"%V\"", &value[1]);
+        return NGX_CONF_ERROR;
+    }
+
+    if (tp && queue == 0) {
+        queue = 4;
+    }
+
+    if (overflow == NGX_CONF_UNSET_UINT) {
+        overflow = NGX_HTTP_LOG_OVERFLOW_BLOCK;
+    }
+
+#endif
+
     if (size) {
 
         if (log->script) {
@@ -1389,6 +1780,11 @@ process_formats:
             buffer = log->file->data;
 
             if (buffer->last - buffer->start != size
+#if (NGX_THREADS)
+                || buffer->thread_pool != tp
+                || buffer->queue != queue
+                || buffer->overflow != overflow
+#endif
                 || buffer->flush != flush
                 || buffer->gzip != gzip)
             {
@@ -1431,6 +1827,49 @@ process_formats:
 
         buffer->gzip = gzip;
 
+#if (NGX_THREADS)
+
+        if (tp) {
+            buffer->tasks = ngx_palloc(cf->pool,
+                                   (queue + 1) * sizeof(ngx_thread_task_t *));
+            if (buffer->tasks == NULL) {
+                return NGX_CONF_ERROR;
+            }
+
+            for (n = 0; n < queue + 1; n++) {
+                task = ngx_thread_task_alloc(cf->pool,
+                                             sizeof(ngx_http_log_thread_ctx_t));
+                if (task == NULL) {
+                    return NGX_CONF_ERROR;
+                }
+
+                ctx = task->ctx;
+
+                if (n == 0) {
+                    ctx->start = buffer->start;
+
+                } else {
+                    ctx->start = ngx_pnalloc(cf->pool, size);
+                    if (ctx->start == NULL) {
+                        return NGX_CONF_ERROR;
+                    }
+                }
+
+                task->handler = ngx_http_log_thread_handler;
+                task->event.data = log->file;
+                task->event.handler = ngx_http_log_thread_event_handler;
+                task->event.log = &cf->cycle->new_log;
+
+                buffer->tasks[n] = task;
+            }
+
+            buffer->thread_pool = tp;
+            buffer->queue = queue;
+            buffer->overflow = overflow;
+        }
+
+#endif
+
         log->file->flush = ngx_http_log_flush;
         log->file->data = buffer;
     }
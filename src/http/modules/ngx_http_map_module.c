@@ -16,6 +16,45 @@ typedef struct {
 } ngx_http_map_conf_t;
 
 
+/*
+ * 预编译的二进制 map 文件, 只读映射到内存, 所有进程共享页缓存.
+ * 文件由 contrib/map2bin.pl 生成, 格式为 (主机字节序):
+ *
+ *     header   "NGXMAPB1", uint32_t 0x01020304, uint32_t number of entries
+ *     entries  uint32_t key offset, key length, value offset, value length
+ *     strings
+ *
+ * 条目按键的字节序排序, 键为小写.
+ */
+
+#define NGX_HTTP_MAP_BINARY_MAGIC      "NGXMAPB1"
+#define NGX_HTTP_MAP_BINARY_ORDER      0x01020304
+
+
+typedef struct {
+    u_char                      magic[8];
+    uint32_t                    order;
+    uint32_t                    nentries;
+} ngx_http_map_binary_header_t;
+
+
+typedef struct {
+    uint32_t                    key;
+    uint32_t                    key_len;
+    uint32_t                    value;
+    uint32_t                    value_len;
+} ngx_http_map_binary_entry_t;
+
+
+typedef struct {
+    u_char                       *start;
+    size_t                        size;
+    ngx_http_map_binary_entry_t  *entries;
+    ngx_uint_t                    nentries;
+    ngx_str_t                     name;
+} ngx_http_map_binary_t;
+
+
 typedef struct {
     ngx_hash_keys_arrays_t      keys;
 
@@ -26,6 +65,7 @@ typedef struct {
 #endif
 
     ngx_http_variable_value_t  *default_value;
+    ngx_http_map_binary_t      *binary;
     ngx_conf_t                 *cf;
     ngx_uint_t                  hostnames;      /* unsigned  hostnames:1 */
 } ngx_http_map_conf_ctx_t;
@@ -35,15 +75,22 @@ typedef struct {
     ngx_http_map_t              map;
     ngx_http_complex_value_t    value;
     ngx_http_variable_value_t  *default_value;
+    ngx_http_map_binary_t      *binary;
     ngx_uint_t                  hostnames;      /* unsigned  hostnames:1 */
 } ngx_http_map_ctx_t;
 
 
+static ngx_int_t ngx_http_map_binary_find(ngx_http_request_t *r,
+    ngx_http_map_binary_t *binary, ngx_str_t *match,
+    ngx_http_variable_value_t *v);
 static int ngx_libc_cdecl ngx_http_map_cmp_dns_wildcards(const void *one,
     const void *two);
 static void *ngx_http_map_create_conf(ngx_conf_t *cf);
 static char *ngx_http_map_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 static char *ngx_http_map(ngx_conf_t *cf, ngx_command_t *dummy, void *conf);
+static char *ngx_http_map_include_binary(ngx_conf_t *cf,
+    ngx_http_map_conf_ctx_t *ctx, ngx_str_t *name);
+static void ngx_http_map_binary_cleanup(void *data);
 
 
 static ngx_command_t  ngx_http_map_commands[] = {
@@ -124,6 +171,22 @@ ngx_http_map_variable(ngx_http_request_t *r, ngx_http_variable_value_t *v,
         val.len--;
     }
 
+    if (map->binary) {
+        switch (ngx_http_map_binary_find(r, map->binary, &val, v)) {
+
+        case NGX_OK:
+            ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                           "http map binary: \"%v\" \"%v\"", &val, v);
+            return NGX_OK;
+
+        case NGX_ERROR:
+            return NGX_ERROR;
+
+        default: /* NGX_DECLINED */
+            break;
+        }
+    }
+
     value = ngx_http_map_find(r, &map->map, &val);
 
     if (value == NULL) {
@@ -147,6 +210,62 @@ ngx_http_map_variable(ngx_http_request_t *r, ngx_http_variable_value_t *v,
 }
 
 
+static ngx_int_t
+ngx_http_map_binary_find(ngx_http_request_t *r, ngx_http_map_binary_t *binary,
+    ngx_str_t *match, ngx_http_variable_value_t *v)
+{
+    u_char                       *low;
+    size_t                        len;
+    ngx_int_t                     rc;
+    ngx_uint_t                    left, right, middle;
+    ngx_http_map_binary_entry_t  *e;
+
+    len = match->len;
+
+    if (len) {
+        low = ngx_pnalloc(r->pool, len);
+        if (low == NULL) {
+            return NGX_ERROR;
+        }
+
+        ngx_strlow(low, match->data, len);
+
+    } else {
+        low = NULL;
+    }
+
+    left = 0;
+    right = binary->nentries;
+
+    while (left < right) {
+        middle = left + (right - left) / 2;
+
+        e = &binary->entries[middle];
+
+        rc = ngx_memn2cmp(low, binary->start + e->key, len, e->key_len);
+
+        if (rc == 0) {
+            v->len = e->value_len;
+            v->valid = 1;
+            v->no_cacheable = 0;
+            v->not_found = 0;
+            v->data = binary->start + e->value;
+
+            return NGX_OK;
+        }
+
+        if (rc < 0) {
+            right = middle;
+
+        } else {
+            left = middle + 1;
+        }
+    }
+
+    return NGX_DECLINED;
+}
+
+
 static void *
 ngx_http_map_create_conf(ngx_conf_t *cf)
 {
@@ -264,6 +383,7 @@ ngx_http_map_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 #endif
 
     ctx.default_value = NULL;
+    ctx.binary = NULL;
     ctx.cf = &save;
     ctx.hostnames = 0;
 
@@ -286,6 +406,7 @@ ngx_http_map_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
                                              &ngx_http_variable_null_value;
 
     map->hostnames = ctx.hostnames;
+    map->binary = ctx.binary;
 
     hash.key = ngx_hash_key_lc;
     hash.max_size = mcf->hash_max_size;
@@ -401,6 +522,10 @@ ngx_http_map(ngx_conf_t *cf, ngx_command_t *dummy, void *conf)
         return ngx_conf_include(cf, dummy, conf);
     }
 
+    if (ngx_strcmp(value[0].data, "include_binary") == 0) {
+        return ngx_http_map_include_binary(cf, ctx, &value[1]);
+    }
+
     if (value[1].data[0] == '$') {
         name = value[1];
         name.len--;
@@ -565,3 +690,189 @@ found:
 
     return NGX_CONF_ERROR;
 }
+
+
+static char *
+ngx_http_map_include_binary(ngx_conf_t *cf, ngx_http_map_conf_ctx_t *ctx,
+    ngx_str_t *name)
+{
+    u_char                        *start, *prev;
+    size_t                         size, n, prev_len;
+    ngx_fd_t                       fd;
+    ngx_uint_t                     i;
+    ngx_file_info_t                fi;
+    ngx_pool_cleanup_t            *cln;
+    ngx_http_map_binary_t         *binary;
+    ngx_http_map_binary_entry_t   *e;
+    ngx_http_map_binary_header_t  *h;
+
+    if (ctx->binary) {
+        return "is duplicate";
+    }
+
+    /* the binary map lives as long as the cycle */
+
+    binary = ngx_pcalloc(ctx->cf->pool, sizeof(ngx_http_map_binary_t));
+    if (binary == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    binary->name.len = name->len;
+    binary->name.data = ngx_pnalloc(ctx->cf->pool, name->len + 1);
+    if (binary->name.data == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    ngx_cpystrn(binary->name.data, name->data, name->len + 1);
+
+    if (ngx_conf_full_name(cf->cycle, &binary->name, 1) != NGX_OK) {
+        return NGX_CONF_ERROR;
+    }
+
+    fd = ngx_open_file(binary->name.data, NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           ngx_open_file_n " \"%s\" failed",
+                           binary->name.data);
+        return NGX_CONF_ERROR;
+    }
+
+    if (ngx_fd_info(fd, &fi) == NGX_FILE_ERROR) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           ngx_fd_info_n " \"%s\" failed", binary->name.data);
+        goto failed;
+    }
+
+    size = (size_t) ngx_file_size(&fi);
+
+    if (size < sizeof(ngx_http_map_binary_header_t)) {
+        goto invalid;
+    }
+
+    /*
+     * the file is mapped shared and read-only, so all worker processes
+     * and configuration generations use the same pages of the page cache;
+     * it must only be replaced atomically, with rename(): a file truncated
+     * or rewritten in place raises SIGBUS in the workers and voids the
+     * checks below
+     */
+
+    start = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (start == MAP_FAILED) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, ngx_errno,
+                           "mmap(%uz) \"%s\" failed",
+                           size, binary->name.data);
+        goto failed;
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, cf->log, ngx_errno,
+                      ngx_close_file_n " \"%s\" failed", binary->name.data);
+    }
+
+    fd = NGX_INVALID_FILE;
+
+    cln = ngx_pool_cleanup_add(ctx->cf->pool, 0);
+    if (cln == NULL) {
+        munmap(start, size);
+        return NGX_CONF_ERROR;
+    }
+
+    binary->start = start;
+    binary->size = size;
+
+    cln->handler = ngx_http_map_binary_cleanup;
+    cln->data = binary;
+
+    h = (ngx_http_map_binary_header_t *) start;
+
+    if (ngx_memcmp(h->magic, NGX_HTTP_MAP_BINARY_MAGIC, 8) != 0) {
+        goto invalid;
+    }
+
+    if (h->order != NGX_HTTP_MAP_BINARY_ORDER) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "binary map \"%s\" has wrong byte order",
+                           binary->name.data);
+        return NGX_CONF_ERROR;
+    }
+
+    n = (size - sizeof(ngx_http_map_binary_header_t))
+        / sizeof(ngx_http_map_binary_entry_t);
+
+    if (h->nentries > n) {
+        goto invalid;
+    }
+
+    binary->entries = (ngx_http_map_binary_entry_t *)
+                          (start + sizeof(ngx_http_map_binary_header_t));
+    binary->nentries = h->nentries;
+
+    /* the lookup relies on bounds and order, so both are checked once */
+
+    prev = NULL;
+    prev_len = 0;
+
+    for (i = 0; i < binary->nentries; i++) {
+        e = &binary->entries[i];
+
+        if (e->key > size || e->key_len > size - e->key
+            || e->value > size || e->value_len > size - e->value)
+        {
+            goto invalid;
+        }
+
+        if (prev
+            && ngx_memn2cmp(prev, start + e->key, prev_len, e->key_len) >= 0)
+        {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "binary map \"%s\" is not sorted or has "
+                               "duplicate keys at entry %ui",
+                               binary->name.data, i);
+            return NGX_CONF_ERROR;
+        }
+
+        prev = start + e->key;
+        prev_len = e->key_len;
+    }
+
+    ctx->binary = binary;
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, cf->log, 0,
+                   "map binary \"%s\": %ui entries",
+                   binary->name.data, binary->nentries);
+
+    return NGX_CONF_OK;
+
+invalid:
+
+    ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                       "invalid binary map \"%s\"", binary->name.data);
+
+failed:
+
+    if (fd != NGX_INVALID_FILE) {
+        if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_ALERT, cf->log, ngx_errno,
+                          ngx_close_file_n " \"%s\" failed",
+                          binary->name.data);
+        }
+    }
+
+    return NGX_CONF_ERROR;
+}
+
+
+static void
+ngx_http_map_binary_cleanup(void *data)
+{
+    ngx_http_map_binary_t  *binary = data;
+
+    if (munmap(binary->start, binary->size) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "munmap(%uz) \"%s\" failed",
+                      binary->size, binary->name.data);
+    }
+}
@@ -11,6 +11,11 @@
 
 
 static ngx_int_t ngx_http_static_handler(ngx_http_request_t *r);
+#if (NGX_THREADS)
+static ngx_int_t ngx_http_static_thread_handler(ngx_thread_task_t *task,
+    ngx_open_file_info_t *of);
+static void ngx_http_static_thread_event_handler(ngx_event_t *ev);
+#endif
 static ngx_int_t ngx_http_static_init(ngx_conf_t *cf);
 
 
@@ -99,9 +104,38 @@ ngx_http_static_handler(ngx_http_request_t *r)
         return NGX_HTTP_INTERNAL_SERVER_ERROR;
     }
 
-    if (ngx_open_cached_file(clcf->open_file_cache, &path, &of, r->pool)
-        != NGX_OK)
-    {
+#if (NGX_THREADS)
+
+    if (clcf->aio == NGX_HTTP_AIO_THREADS && clcf->aio_open) {
+        of.thread_handler = ngx_http_static_thread_handler;
+        of.thread_ctx = r;
+        of.thread_task = ngx_http_get_module_ctx(r, ngx_http_static_module);
+    }
+
+#endif
+
+    rc = ngx_open_cached_file(clcf->open_file_cache, &path, &of, r->pool);
+
+#if (NGX_THREADS)
+
+    if (rc == NGX_AGAIN) {
+
+        /*
+         * the task is kept as the module context, the handler is called
+         * again when the thread is done and gets the result from it
+         */
+
+        ngx_http_set_ctx(r, of.thread_task, ngx_http_static_module);
+
+        r->main->count++;
+        r->write_event_handler = ngx_http_core_run_phases;
+
+        return NGX_DONE;
+    }
+
+#endif
+
+    if (rc != NGX_OK) {
         switch (of.err) {
 
         case 0:
@@ -271,6 +305,75 @@ ngx_http_static_handler(ngx_http_request_t *r)
 }
 
 
+#if (NGX_THREADS)
+
+static ngx_int_t
+ngx_http_static_thread_handler(ngx_thread_task_t *task,
+    ngx_open_file_info_t *of)
+{
+    ngx_str_t                  name;
+    ngx_thread_pool_t         *tp;
+    ngx_http_request_t        *r;
+    ngx_http_core_loc_conf_t  *clcf;
+
+    r = of->thread_ctx;
+
+    clcf = ngx_http_get_module_loc_conf(r, ngx_http_core_module);
+    tp = clcf->thread_pool;
+
+    if (tp == NULL) {
+        if (ngx_http_complex_value(r, clcf->thread_pool_value, &name)
+            != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
+
+        tp = ngx_thread_pool_get((ngx_cycle_t *) ngx_cycle, &name);
+
+        if (tp == NULL) {
+            ngx_log_error(NGX_LOG_ERR, r->connection->log, 0,
+                          "thread pool \"%V\" not found", &name);
+            return NGX_ERROR;
+        }
+    }
+
+    task->event.data = r;
+    task->event.handler = ngx_http_static_thread_event_handler;
+
+    if (ngx_thread_task_post(tp, task) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    r->main->blocked++;
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_static_thread_event_handler(ngx_event_t *ev)
+{
+    ngx_connection_t    *c;
+    ngx_http_request_t  *r;
+
+    r = ev->data;
+    c = r->connection;
+
+    ngx_http_set_log_request(c->log, r);
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, c->log, 0,
+                   "http static thread: \"%V?%V\"", &r->uri, &r->args);
+
+    r->main->blocked--;
+
+    r->write_event_handler(r);
+
+    ngx_http_run_posted_requests(c);
+}
+
+#endif
+
+
 static ngx_int_t
 ngx_http_static_init(ngx_conf_t *cf)
 {
@@ -0,0 +1,1138 @@
+
+/*
+ * Copyright (C) Igor Sysoev
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+#include <nginx.h>
+
+
+/*
+ * latency histograms are log-linear: values below 32ms are counted
+ * exactly, every following power of two is split into 16 buckets,
+ * so the relative error of a reported percentile is at most 1/16;
+ * everything above 2^24ms falls into the last bucket
+ */
+
+#define NGX_HTTP_STATUS_SUB_BITS     4
+#define NGX_HTTP_STATUS_SUB          (1 << NGX_HTTP_STATUS_SUB_BITS)
+#define NGX_HTTP_STATUS_OCTAVES      20
+#define NGX_HTTP_STATUS_BUCKETS                                               \
+    (NGX_HTTP_STATUS_SUB + NGX_HTTP_STATUS_OCTAVES * NGX_HTTP_STATUS_SUB)
+
+
+#define NGX_HTTP_STATUS_SERVER       0
+#define NGX_HTTP_STATUS_LOCATION     1
+#define NGX_HTTP_STATUS_PEER         2
+
+
+typedef struct {
+    uint64_t                         requests;
+    uint64_t                         responses[5];
+    uint64_t                         received;
+    uint64_t                         sent;
+    uint64_t                         cached;      /* keepalive hits */
+    uint64_t                         latency_sum;
+    uint64_t                         latency_max;
+    uint64_t                         histogram[NGX_HTTP_STATUS_BUCKETS];
+} ngx_http_status_counters_t;
+
+
+/*
+ * 每个配置周期单独一块共享内存, 旧 worker 继续写旧的那块;
+ * 第一个槽位保存上一周期的累计值, 其后每个 worker 一个槽位
+ */
+
+typedef struct {
+    ngx_uint_t                       workers;
+    u_char                          *counters;
+    ngx_shm_t                        shm;
+} ngx_http_status_sh_t;
+
+
+typedef struct {
+    ngx_str_t                        name;
+    ngx_uint_t                       type;
+} ngx_http_status_zone_t;
+
+
+typedef struct {
+    ngx_http_upstream_srv_conf_t    *upstream;
+    ngx_uint_t                       index;
+    ngx_uint_t                       npeers;
+} ngx_http_status_upstream_t;
+
+
+typedef struct {
+    ngx_array_t                      zones;     /* ngx_http_status_zone_t */
+    ngx_array_t                      upstreams;
+                                             /* ngx_http_status_upstream_t */
+    ngx_uint_t                       nentries;
+    size_t                           stride;
+    uint32_t                         signature;
+
+    ngx_flag_t                       enable;
+    ngx_http_status_sh_t            *sh;
+
+    /* this worker's slot */
+    ngx_http_status_counters_t      *counters;
+} ngx_http_status_main_conf_t;
+
+
+typedef struct {
+    ngx_uint_t                       zone;
+} ngx_http_status_srv_conf_t;
+
+
+typedef struct {
+    ngx_uint_t                       zone;
+} ngx_http_status_loc_conf_t;
+
+
+static ngx_int_t ngx_http_status_handler(ngx_http_request_t *r);
+static ngx_int_t ngx_http_status_log_handler(ngx_http_request_t *r);
+static void ngx_http_status_log_upstream(ngx_http_request_t *r,
+    ngx_http_status_main_conf_t *smcf);
+static ngx_int_t ngx_http_status_peer_index(
+    ngx_http_status_main_conf_t *smcf, ngx_str_t *name);
+static void ngx_http_status_count(ngx_http_status_counters_t *c,
+    ngx_uint_t status, off_t received, off_t sent, ngx_msec_int_t ms);
+static ngx_uint_t ngx_http_status_bucket(ngx_msec_int_t ms);
+static uint64_t ngx_http_status_bucket_value(ngx_uint_t n);
+static void ngx_http_status_sum(ngx_http_status_main_conf_t *smcf,
+    ngx_uint_t n, ngx_http_status_counters_t *c);
+static u_char *ngx_http_status_write_counters(u_char *p,
+    ngx_http_status_counters_t *c, ngx_uint_t type);
+static u_char *ngx_http_status_write_zones(u_char *p,
+    ngx_http_status_main_conf_t *smcf, ngx_uint_t type);
+static u_char *ngx_http_status_write_upstreams(u_char *p,
+    ngx_http_status_main_conf_t *smcf);
+static size_t ngx_http_status_upstreams_size(
+    ngx_http_status_main_conf_t *smcf);
+
+static void ngx_http_status_cleanup(void *data);
+static void *ngx_http_status_create_main_conf(ngx_conf_t *cf);
+static void *ngx_http_status_create_srv_conf(ngx_conf_t *cf);
+static void *ngx_http_status_create_loc_conf(ngx_conf_t *cf);
+static char *ngx_http_status_merge_loc_conf(ngx_conf_t *cf, void *parent,
+    void *child);
+static char *ngx_http_status(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+static char *ngx_http_status_zone(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+static ngx_int_t ngx_http_status_init(ngx_conf_t *cf);
+static ngx_int_t ngx_http_status_init_module(ngx_cycle_t *cycle);
+static ngx_int_t ngx_http_status_init_process(ngx_cycle_t *cycle);
+
+
+static ngx_command_t  ngx_http_status_commands[] = {
+
+    { ngx_string("status"),
+      NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_NOARGS,
+      ngx_http_status,
+      0,
+      0,
+      NULL },
+
+    { ngx_string("status_zone"),
+      NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
+      ngx_http_status_zone,
+      0,
+      0,
+      NULL },
+
+      ngx_null_command
+};
+
+
+static ngx_http_module_t  ngx_http_status_module_ctx = {
+    NULL,                                  /* preconfiguration */
+    ngx_http_status_init,                  /* postconfiguration */
+
+    ngx_http_status_create_main_conf,      /* create main configuration */
+    NULL,                                  /* init main configuration */
+
+    ngx_http_status_create_srv_conf,       /* create server configuration */
+    NULL,                                  /* merge server configuration */
+
+    ngx_http_status_create_loc_conf,       /* create location configuration */
+    ngx_http_status_merge_loc_conf         /* merge location configuration */
+};
+
+
+ngx_module_t  ngx_http_status_module = {
+    NGX_MODULE_V1,
+    &ngx_http_status_module_ctx,           /* module context */
+    ngx_http_status_commands,              /* module directives */
+    NGX_HTTP_MODULE,                       /* module type */
+    NULL,                                  /* init master */
+    ngx_http_status_init_module,           /* init module */
+    ngx_http_status_init_process,          /* init process */
+    NULL,                                  /* init thread */
+    NULL,                                  /* exit thread */
+    NULL,                                  /* exit process */
+    NULL,                                  /* exit master */
+    NGX_MODULE_V1_PADDING
+};
+
+
+#define NGX_HTTP_STATUS_COUNTERS_FORMAT                                       \
+    "\"requests\":%uL,"                                                       \
+    "\"responses\":{\"1xx\":%uL,\"2xx\":%uL,\"3xx\":%uL,"                     \
+    "\"4xx\":%uL,\"5xx\":%uL},"                                               \
+    "\"received\":%uL,\"sent\":%uL,"                                          \
+    "\"latency\":{\"sum\":%uL,\"max\":%uL,\"p50\":%uL,\"p75\":%uL,"           \
+    "\"p90\":%uL,\"p99\":%uL,\"p999\":%uL}"
+
+#define NGX_HTTP_STATUS_COUNTERS_LEN                                          \
+    (sizeof(NGX_HTTP_STATUS_COUNTERS_FORMAT) + 15 * NGX_INT64_LEN)
+
+
+static ngx_int_t
+ngx_http_status_handler(ngx_http_request_t *r)
+{
+    size_t                        size;
+    u_char                       *p;
+    ngx_int_t                     rc;
+    ngx_buf_t                    *b;
+    ngx_uint_t                    i;
+    ngx_chain_t                   out;
+    ngx_http_status_zone_t       *zone;
+    ngx_http_status_main_conf_t  *smcf;
+
+    if (r->method != NGX_HTTP_GET && r->method != NGX_HTTP_HEAD) {
+        return NGX_HTTP_NOT_ALLOWED;
+    }
+
+    rc = ngx_http_discard_request_body(r);
+
+    if (rc != NGX_OK) {
+        return rc;
+    }
+
+    smcf = ngx_http_get_module_main_conf(r, ngx_http_status_module);
+
+    if (smcf->sh == NULL) {
+        return NGX_HTTP_SERVICE_UNAVAILABLE;
+    }
+
+    r->headers_out.content_type_len = sizeof("application/json") - 1;
+    ngx_str_set(&r->headers_out.content_type, "application/json");
+    r->headers_out.content_type_lowcase = NULL;
+
+    if (r->method == NGX_HTTP_HEAD) {
+        r->headers_out.status = NGX_HTTP_OK;
+
+        rc = ngx_http_send_header(r);
+
+        if (rc == NGX_ERROR || rc > NGX_OK || r->header_only) {
+            return rc;
+        }
+    }
+
+    size = sizeof("{\"nginx_version\":\"" NGINX_VERSION "\",") - 1
+           + sizeof("\"pid\":,\"timestamp\":,\"workers\":,") - 1
+           + NGX_INT64_LEN + NGX_INT64_LEN + NGX_INT_T_LEN
+#if (NGX_STAT_STUB)
+           + sizeof("\"connections\":{\"accepted\":,\"handled\":,\"active\":,"
+                    "\"reading\":,\"writing\":,\"waiting\":},"
+                    "\"requests\":,") - 1
+           + 7 * NGX_ATOMIC_T_LEN
+#endif
+           + sizeof("\"server_zones\":{},\"location_zones\":{},"
+                    "\"upstreams\":{}}\n") - 1;
+
+    zone = smcf->zones.elts;
+
+    for (i = 0; i < smcf->zones.nelts; i++) {
+        size += sizeof("\"\":{},") - 1 + zone[i].name.len
+                + ngx_escape_json(NULL, zone[i].name.data, zone[i].name.len)
+                + NGX_HTTP_STATUS_COUNTERS_LEN;
+    }
+
+    size += ngx_http_status_upstreams_size(smcf);
+
+    b = ngx_create_temp_buf(r->pool, size);
+    if (b == NULL) {
+        return NGX_HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    out.buf = b;
+    out.next = NULL;
+
+    p = b->last;
+
+    p = ngx_cpymem(p, "{\"nginx_version\":\"" NGINX_VERSION "\",",
+                   sizeof("{\"nginx_version\":\"" NGINX_VERSION "\",") - 1);
+
+    p = ngx_sprintf(p, "\"pid\":%P,\"timestamp\":%M,\"workers\":%ui,",
+                    ngx_pid, ngx_current_msec, smcf->sh->workers);
+
+#if (NGX_STAT_STUB)
+    p = ngx_sprintf(p, "\"connections\":{\"accepted\":%uA,\"handled\":%uA,"
+                    "\"active\":%uA,\"reading\":%uA,\"writing\":%uA,"
+                    "\"waiting\":%uA},\"requests\":%uA,",
+                    *ngx_stat_accepted, *ngx_stat_handled, *ngx_stat_active,
+                    *ngx_stat_reading, *ngx_stat_writing, *ngx_stat_waiting,
+                    *ngx_stat_requests);
+#endif
+
+    p = ngx_cpymem(p, "\"server_zones\":{", sizeof("\"server_zones\":{") - 1);
+    p = ngx_http_status_write_zones(p, smcf, NGX_HTTP_STATUS_SERVER);
+
+    p = ngx_cpymem(p, "},\"location_zones\":{",
+                   sizeof("},\"location_zones\":{") - 1);
+    p = ngx_http_status_write_zones(p, smcf, NGX_HTTP_STATUS_LOCATION);
+
+    p = ngx_cpymem(p, "},\"upstreams\":{", sizeof("},\"upstreams\":{") - 1);
+    p = ngx_http_status_write_upstreams(p, smcf);
+
+    *p++ = '}'; *p++ = '}'; *p++ = LF;
+
+    b->last = p;
+
+    r->headers_out.status = NGX_HTTP_OK;
+    r->headers_out.content_length_n = b->last - b->pos;
+
+    b->last_buf = (r == r->main) ? 1 : 0;
+    b->last_in_chain = 1;
+
+    rc = ngx_http_send_header(r);
+
+    if (rc == NGX_ERROR || rc > NGX_OK || r->header_only) {
+        return rc;
+    }
+
+    return ngx_http_output_filter(r, &out);
+}
+
+
+static u_char *
+ngx_http_status_write_zones(u_char *p, ngx_http_status_main_conf_t *smcf,
+    ngx_uint_t type)
+{
+    u_char                      *start;
+    ngx_uint_t                   i;
+    ngx_http_status_zone_t      *zone;
+    ngx_http_status_counters_t   c;
+
+    start = p;
+    zone = smcf->zones.elts;
+
+    for (i = 0; i < smcf->zones.nelts; i++) {
+
+        if (zone[i].type != type) {
+            continue;
+        }
+
+        if (p != start) {
+            *p++ = ',';
+        }
+
+        *p++ = '"';
+        p = (u_char *) ngx_escape_json(p, zone[i].name.data,
+                                       zone[i].name.len);
+        *p++ = '"'; *p++ = ':'; *p++ = '{';
+
+        ngx_http_status_sum(smcf, i, &c);
+        p = ngx_http_status_write_counters(p, &c, type);
+
+        *p++ = '}';
+    }
+
+    return p;
+}
+
+
+static size_t
+ngx_http_status_upstreams_size(ngx_http_status_main_conf_t *smcf)
+{
+    size_t                         size;
+    ngx_uint_t                     i, n;
+    ngx_http_upstream_rr_peer_t   *peer;
+    ngx_http_upstream_rr_peers_t  *peers, *backup;
+    ngx_http_status_upstream_t    *su;
+    ngx_http_upstream_srv_conf_t  *uscf;
+
+    size = 0;
+    su = smcf->upstreams.elts;
+
+    for (i = 0; i < smcf->upstreams.nelts; i++) {
+        uscf = su[i].upstream;
+
+        size += sizeof("\"\":{\"peers\":[],\"keepalive\":{\"hits\":,"
+                       "\"misses\":}},") - 1
+                + 2 * NGX_INT64_LEN + uscf->host.len
+                + ngx_escape_json(NULL, uscf->host.data, uscf->host.len);
+
+        peers = uscf->peer.data;
+
+        ngx_http_upstream_rr_peers_rlock(peers);
+
+        for (backup = peers; backup; backup = backup->next) {
+            for (n = 0; n < backup->number; n++) {
+                peer = &backup->peer[n];
+
+                size += sizeof("{\"server\":\"\",\"name\":\"\","
+                               "\"backup\":false,\"state\":\"unhealthy\","
+                               "},") - 1
+                        + peer->server.len
+                        + ngx_escape_json(NULL, peer->server.data,
+                                          peer->server.len)
+                        + NGX_SOCKADDR_STRLEN
+                        + NGX_HTTP_STATUS_COUNTERS_LEN;
+            }
+        }
+
+        ngx_http_upstream_rr_peers_unlock(peers);
+    }
+
+    return size;
+}
+
+
+static u_char *
+ngx_http_status_write_upstreams(u_char *p, ngx_http_status_main_conf_t *smcf)
+{
+    u_char                        *start;
+    uint64_t                       tries, hits;
+    ngx_str_t                      state;
+    ngx_uint_t                     i, n, index;
+    ngx_http_upstream_rr_peer_t   *peer;
+    ngx_http_upstream_rr_peers_t  *peers, *backup;
+    ngx_http_status_upstream_t    *su;
+    ngx_http_status_counters_t     c;
+    ngx_http_upstream_srv_conf_t  *uscf;
+
+    su = smcf->upstreams.elts;
+
+    for (i = 0; i < smcf->upstreams.nelts; i++) {
+        uscf = su[i].upstream;
+
+        if (i) {
+            *p++ = ',';
+        }
+
+        *p++ = '"';
+        p = (u_char *) ngx_escape_json(p, uscf->host.data, uscf->host.len);
+        p = ngx_cpymem(p, "\":{\"peers\":[", sizeof("\":{\"peers\":[") - 1);
+
+        start = p;
+        index = su[i].index;
+        peers = uscf->peer.data;
+
+        tries = 0;
+        hits = 0;
+
+        ngx_http_upstream_rr_peers_rlock(peers);
+
+        for (backup = peers; backup; backup = backup->next) {
+            for (n = 0; n < backup->number; n++, index++) {
+                peer = &backup->peer[n];
+
+                if (peer->vacant
+                    || index >= su[i].index + su[i].npeers)
+                {
+                    continue;
+                }
+
+                if (peer->down) {
+                    ngx_str_set(&state, "down");
+
+#if (NGX_HTTP_UPSTREAM_CHECK)
+                } else if (peer->check_down) {
+                    ngx_str_set(&state, "unhealthy");
+#endif
+
+                } else {
+                    ngx_str_set(&state, "up");
+                }
+
+                if (p != start) {
+                    *p++ = ',';
+                }
+
+                p = ngx_cpymem(p, "{\"server\":\"",
+                               sizeof("{\"server\":\"") - 1);
+                p = (u_char *) ngx_escape_json(p, peer->server.data,
+                                               peer->server.len);
+
+                p = ngx_cpymem(p, "\",\"name\":\"",
+                               sizeof("\",\"name\":\"") - 1);
+                p = ngx_cpymem(p, peer->name.data,
+                               ngx_min(peer->name.len, NGX_SOCKADDR_STRLEN));
+
+                p = ngx_sprintf(p, "\",\"backup\":%s,\"state\":\"%V\",",
+                                backup == peers ? "false" : "true", &state);
+
+                ngx_http_status_sum(smcf, index, &c);
+                p = ngx_http_status_write_counters(p, &c,
+                                                   NGX_HTTP_STATUS_PEER);
+
+                tries += c.requests;
+                hits += c.cached;
+
+                *p++ = '}';
+            }
+        }
+
+        ngx_http_upstream_rr_peers_unlock(peers);
+
+        /*
+         * every connection to a peer is either taken from
+         * the keepalive cache or is a new one
+         */
+
+        p = ngx_sprintf(p, "],\"keepalive\":{\"hits\":%uL,"
+                        "\"misses\":%uL}}", hits, tries - hits);
+    }
+
+    return p;
+}
+
+
+static u_char *
+ngx_http_status_write_counters(u_char *p, ngx_http_status_counters_t *c,
+    ngx_uint_t type)
+{
+    uint64_t    total, count, v[5];
+    ngx_uint_t  i, n;
+
+    static ngx_uint_t  permille[] = { 500, 750, 900, 990, 999 };
+
+    total = 0;
+
+    for (i = 0; i < NGX_HTTP_STATUS_BUCKETS; i++) {
+        total += c->histogram[i];
+    }
+
+    count = 0;
+    i = 0;
+
+    for (n = 0; n < 5; n++) {
+
+        if (total == 0) {
+            v[n] = 0;
+            continue;
+        }
+
+        while (i < NGX_HTTP_STATUS_BUCKETS - 1
+               && (count + c->histogram[i]) * 1000 < total * permille[n])
+        {
+            count += c->histogram[i++];
+        }
+
+        v[n] = ngx_min(ngx_http_status_bucket_value(i), c->latency_max);
+    }
+
+    /* "sent" is not known for upstream peers */
+
+    return ngx_sprintf(p, NGX_HTTP_STATUS_COUNTERS_FORMAT,
+                       c->requests,
+                       c->responses[0], c->responses[1], c->responses[2],
+                       c->responses[3], c->responses[4],
+                       c->received,
+                       type == NGX_HTTP_STATUS_PEER ? (uint64_t) 0 : c->sent,
+                       c->latency_sum, c->latency_max,
+                       v[0], v[1], v[2], v[3], v[4]);
+}
+
+
+static void
+ngx_http_status_sum(ngx_http_status_main_conf_t *smcf, ngx_uint_t n,
+    ngx_http_status_counters_t *c)
+{
+    ngx_uint_t                   w, i;
+    ngx_http_status_counters_t  *wc;
+
+    ngx_memzero(c, sizeof(ngx_http_status_counters_t));
+
+    /*
+     * the counters are updated by their workers without any locking,
+     * so a snapshot may be slightly inconsistent across the fields
+     */
+
+    for (w = 0; w <= smcf->sh->workers; w++) {
+        wc = (ngx_http_status_counters_t *)
+                 (smcf->sh->counters + w * smcf->stride) + n;
+
+        c->requests += wc->requests;
+
+        for (i = 0; i < 5; i++) {
+            c->responses[i] += wc->responses[i];
+        }
+
+        c->received += wc->received;
+        c->sent += wc->sent;
+        c->cached += wc->cached;
+        c->latency_sum += wc->latency_sum;
+
+        if (wc->latency_max > c->latency_max) {
+            c->latency_max = wc->latency_max;
+        }
+
+        for (i = 0; i < NGX_HTTP_STATUS_BUCKETS; i++) {
+            c->histogram[i] += wc->histogram[i];
+        }
+    }
+}
+
+
+static ngx_int_t
+ngx_http_status_log_handler(ngx_http_request_t *r)
+{
+    ngx_uint_t                    status;
+    ngx_time_t                   *tp;
+    ngx_msec_int_t                ms;
+    ngx_http_status_srv_conf_t   *sscf;
+    ngx_http_status_loc_conf_t   *slcf;
+    ngx_http_status_main_conf_t  *smcf;
+
+    smcf = ngx_http_get_module_main_conf(r, ngx_http_status_module);
+
+    if (smcf->counters == NULL) {
+        return NGX_OK;
+    }
+
+    if (r->err_status) {
+        status = r->err_status;
+
+    } else {
+        status = r->headers_out.status;
+    }
+
+    tp = ngx_timeofday();
+
+    ms = (ngx_msec_int_t)
+             ((tp->sec - r->start_sec) * 1000 + (tp->msec - r->start_msec));
+    ms = ngx_max(ms, 0);
+
+    sscf = ngx_http_get_module_srv_conf(r, ngx_http_status_module);
+
+    if (sscf->zone != NGX_CONF_UNSET_UINT) {
+        ngx_http_status_count(&smcf->counters[sscf->zone], status,
+                              r->request_length, r->connection->sent, ms);
+    }
+
+    slcf = ngx_http_get_module_loc_conf(r, ngx_http_status_module);
+
+    if (slcf->zone != NGX_CONF_UNSET_UINT) {
+        ngx_http_status_count(&smcf->counters[slcf->zone], status,
+                              r->request_length, r->connection->sent, ms);
+    }
+
+    if (r->upstream_states && smcf->upstreams.nelts) {
+        ngx_http_status_log_upstream(r, smcf);
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_status_log_upstream(ngx_http_request_t *r,
+    ngx_http_status_main_conf_t *smcf)
+{
+    ngx_int_t                   index;
+    ngx_uint_t                  i;
+    ngx_msec_int_t              ms;
+    ngx_http_upstream_state_t  *state;
+
+    state = r->upstream_states->elts;
+
+    for (i = 0; i < r->upstream_states->nelts; i++) {
+
+        /* a separator between the upstreams after internal redirects */
+
+        if (state[i].peer == NULL) {
+            continue;
+        }
+
+        index = ngx_http_status_peer_index(smcf, state[i].peer);
+
+        if (index == NGX_ERROR) {
+            continue;
+        }
+
+        ms = (ngx_msec_int_t) (state[i].response_sec * 1000
+                               + state[i].response_msec);
+        ms = ngx_max(ms, 0);
+
+        ngx_http_status_count(&smcf->counters[index], state[i].status,
+                              state[i].response_length, 0, ms);
+
+        smcf->counters[index].cached += state[i].cached;
+    }
+}
+
+
+static ngx_int_t
+ngx_http_status_peer_index(ngx_http_status_main_conf_t *smcf,
+    ngx_str_t *name)
+{
+    u_char                        *first;
+    size_t                         offset;
+    ngx_uint_t                     i, index;
+    ngx_http_status_upstream_t    *su;
+    ngx_http_upstream_rr_peers_t  *peers;
+
+    /*
+     * the peer name in the upstream state points to the name of
+     * a round-robin peer, so its slot is found by the address alone;
+     * peers created for "proxy_pass" with variables are not tracked
+     */
+
+    su = smcf->upstreams.elts;
+
+    for (i = 0; i < smcf->upstreams.nelts; i++) {
+
+        index = su[i].index;
+
+        for (peers = su[i].upstream->peer.data; peers; peers = peers->next) {
+            first = (u_char *) &peers->peer[0].name;
+            offset = (u_char *) name - first;
+
+            if ((u_char *) name >= first
+                && offset < peers->number * sizeof(ngx_http_upstream_rr_peer_t)
+                && offset % sizeof(ngx_http_upstream_rr_peer_t) == 0)
+            {
+                index += offset / sizeof(ngx_http_upstream_rr_peer_t);
+
+                if (index >= su[i].index + su[i].npeers) {
+                    return NGX_ERROR;
+                }
+
+                return index;
+            }
+
+            index += peers->number;
+        }
+    }
+
+    return NGX_ERROR;
+}
+
+
+static void
+ngx_http_status_count(ngx_http_status_counters_t *c, ngx_uint_t status,
+    off_t received, off_t sent, ngx_msec_int_t ms)
+{
+    c->requests++;
+
+    if (status >= 100 && status < 600) {
+        c->responses[status / 100 - 1]++;
+    }
+
+    c->received += received;
+    c->sent += sent;
+
+    c->latency_sum += ms;
+
+    if ((uint64_t) ms > c->latency_max) {
+        c->latency_max = ms;
+    }
+
+    c->histogram[ngx_http_status_bucket(ms)]++;
+}
+
+
+static ngx_uint_t
+ngx_http_status_bucket(ngx_msec_int_t ms)
+{
+    ngx_uint_t  v, shift;
+
+    v = (ngx_uint_t) ms;
+
+    for (shift = 0; (v >> shift) >= 2 * NGX_HTTP_STATUS_SUB; shift++) {
+        /* void */
+    }
+
+    if (shift >= NGX_HTTP_STATUS_OCTAVES) {
+        return NGX_HTTP_STATUS_BUCKETS - 1;
+    }
+
+    return shift * NGX_HTTP_STATUS_SUB + (v >> shift);
+}
+
+
+static uint64_t
+ngx_http_status_bucket_value(ngx_uint_t n)
+{
+    ngx_uint_t  shift;
+
+    if (n < 2 * NGX_HTTP_STATUS_SUB) {
+        return n;
+    }
+
+    shift = n / NGX_HTTP_STATUS_SUB - 1;
+    n -= shift * NGX_HTTP_STATUS_SUB;
+
+    /* the upper bound of the bucket */
+
+    return ((uint64_t) (n + 1) << shift) - 1;
+}
+
+
+static ngx_int_t
+ngx_http_status_init_module(ngx_cycle_t *cycle)
+{
+    size_t                        size;
+    ngx_uint_t                    n;
+    ngx_shm_t                     shm;
+    ngx_core_conf_t              *ccf;
+    ngx_pool_cleanup_t           *cln;
+    ngx_http_status_sh_t         *sh;
+    ngx_http_status_counters_t   *c;
+    ngx_http_status_main_conf_t  *smcf, *osmcf;
+
+    smcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_status_module);
+
+    if (smcf == NULL || (!smcf->enable && smcf->zones.nelts == 0)) {
+        return NGX_OK;
+    }
+
+    /*
+     * the number of workers is only known once the whole configuration
+     * is parsed; the memory is allocated anew for every cycle, so the
+     * workers of the previous one keep updating their own slots
+     */
+
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    size = ngx_align(sizeof(ngx_http_status_sh_t), NGX_CPU_CACHE_LINE)
+           + (ccf->worker_processes + 1) * smcf->stride;
+
+    shm.size = size;
+    shm.name.len = sizeof("nginx_http_status") - 1;
+    shm.name.data = (u_char *) "nginx_http_status";
+    shm.log = cycle->log;
+
+    if (ngx_shm_alloc(&shm) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    sh = (ngx_http_status_sh_t *) shm.addr;
+
+    sh->workers = ccf->worker_processes;
+    sh->counters = shm.addr + size - (sh->workers + 1) * smcf->stride;
+    sh->shm = shm;
+
+    cln = ngx_pool_cleanup_add(cycle->pool, 0);
+    if (cln == NULL) {
+        ngx_shm_free(&shm);
+        return NGX_ERROR;
+    }
+
+    cln->handler = ngx_http_status_cleanup;
+    cln->data = sh;
+
+    smcf->sh = sh;
+
+    /* the totals are carried over if the set of zones is the same */
+
+    if (ngx_is_init_cycle(cycle->old_cycle)) {
+        return NGX_OK;
+    }
+
+    osmcf = ngx_http_cycle_get_module_main_conf(cycle->old_cycle,
+                                                ngx_http_status_module);
+
+    if (osmcf == NULL || osmcf->sh == NULL
+        || osmcf->signature != smcf->signature)
+    {
+        return NGX_OK;
+    }
+
+    c = (ngx_http_status_counters_t *) sh->counters;
+
+    for (n = 0; n < smcf->nentries; n++) {
+        ngx_http_status_sum(osmcf, n, &c[n]);
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_status_cleanup(void *data)
+{
+    ngx_http_status_sh_t  *sh = data;
+
+    ngx_shm_t  shm;
+
+    /* the structure itself is in the memory being freed */
+
+    shm = sh->shm;
+
+    ngx_shm_free(&shm);
+}
+
+
+static ngx_int_t
+ngx_http_status_init_process(ngx_cycle_t *cycle)
+{
+    ngx_http_status_main_conf_t  *smcf;
+
+    smcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_status_module);
+
+    if (smcf == NULL || smcf->sh == NULL || ngx_worker >= smcf->sh->workers) {
+        return NGX_OK;
+    }
+
+    smcf->counters = (ngx_http_status_counters_t *)
+                         (smcf->sh->counters + (ngx_worker + 1) * smcf->stride);
+
+    return NGX_OK;
+}
+
+
+static void *
+ngx_http_status_create_main_conf(ngx_conf_t *cf)
+{
+    ngx_http_status_main_conf_t  *smcf;
+
+    smcf = ngx_pcalloc(cf->pool, sizeof(ngx_http_status_main_conf_t));
+    if (smcf == NULL) {
+        return NULL;
+    }
+
+    /*
+     * set by ngx_pcalloc():
+     *
+     *     smcf->nentries = 0;
+     *     smcf->enable = 0;
+     *     smcf->sh = NULL;
+     *     smcf->counters = NULL;
+     */
+
+    if (ngx_array_init(&smcf->zones, cf->pool, 4,
+                       sizeof(ngx_http_status_zone_t))
+        != NGX_OK)
+    {
+        return NULL;
+    }
+
+    if (ngx_array_init(&smcf->upstreams, cf->pool, 4,
+                       sizeof(ngx_http_status_upstream_t))
+        != NGX_OK)
+    {
+        return NULL;
+    }
+
+    return smcf;
+}
+
+
+static void *
+ngx_http_status_create_srv_conf(ngx_conf_t *cf)
+{
+    ngx_http_status_srv_conf_t  *sscf;
+
+    sscf = ngx_palloc(cf->pool, sizeof(ngx_http_status_srv_conf_t));
+    if (sscf == NULL) {
+        return NULL;
+    }
+
+    sscf->zone = NGX_CONF_UNSET_UINT;
+
+    return sscf;
+}
+
+
+static void *
+ngx_http_status_create_loc_conf(ngx_conf_t *cf)
+{
+    ngx_http_status_loc_conf_t  *slcf;
+
+    slcf = ngx_palloc(cf->pool, sizeof(ngx_http_status_loc_conf_t));
+    if (slcf == NULL) {
+        return NULL;
+    }
+
+    slcf->zone = NGX_CONF_UNSET_UINT;
+
+    return slcf;
+}
+
+
+static char *
+ngx_http_status_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
+{
+    ngx_http_status_loc_conf_t *prev = parent;
+    ngx_http_status_loc_conf_t *conf = child;
+
+    ngx_conf_merge_uint_value(conf->zone, prev->zone, NGX_CONF_UNSET_UINT);
+
+    return NGX_CONF_OK;
+}
+
+
+static char *
+ngx_http_status(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_http_core_loc_conf_t     *clcf;
+    ngx_http_status_main_conf_t  *smcf;
+
+    clcf = ngx_http_conf_get_module_loc_conf(cf, ngx_http_core_module);
+    clcf->handler = ngx_http_status_handler;
+
+    smcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_status_module);
+    smcf->enable = 1;
+
+    return NGX_CONF_OK;
+}
+
+
+static char *
+ngx_http_status_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_str_t                    *value;
+    ngx_uint_t                    i, type, *zonep;
+    ngx_http_status_zone_t       *zone;
+    ngx_http_status_srv_conf_t   *sscf;
+    ngx_http_status_loc_conf_t   *slcf;
+    ngx_http_status_main_conf_t  *smcf;
+
+    if (cf->cmd_type == NGX_HTTP_SRV_CONF) {
+        sscf = ngx_http_conf_get_module_srv_conf(cf, ngx_http_status_module);
+        zonep = &sscf->zone;
+        type = NGX_HTTP_STATUS_SERVER;
+
+    } else {
+        slcf = ngx_http_conf_get_module_loc_conf(cf, ngx_http_status_module);
+        zonep = &slcf->zone;
+        type = NGX_HTTP_STATUS_LOCATION;
+    }
+
+    if (*zonep != NGX_CONF_UNSET_UINT) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (value[1].len == 0) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid zone name \"%V\"", &value[1]);
+        return NGX_CONF_ERROR;
+    }
+
+    smcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_status_module);
+
+    /* several servers or locations may share a zone */
+
+    zone = smcf->zones.elts;
+
+    for (i = 0; i < smcf->zones.nelts; i++) {
+        if (zone[i].type == type
+            && zone[i].name.len == value[1].len
+            && ngx_strncmp(zone[i].name.data, value[1].data, value[1].len)
+               == 0)
+        {
+            *zonep = i;
+            return NGX_CONF_OK;
+        }
+    }
+
+    zone = ngx_array_push(&smcf->zones);
+    if (zone == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    zone->name = value[1];
+    zone->type = type;
+
+    *zonep = i;
+
+    return NGX_CONF_OK;
+}
+
+
+static ngx_int_t
+ngx_http_status_init(ngx_conf_t *cf)
+{
+    u_char                         type;
+    uint32_t                       crc;
+    ngx_uint_t                     i;
+    ngx_http_handler_pt           *h;
+    ngx_http_status_zone_t        *zone;
+    ngx_http_status_upstream_t    *su;
+    ngx_http_core_main_conf_t     *cmcf;
+    ngx_http_upstream_rr_peers_t  *peers;
+    ngx_http_status_main_conf_t   *smcf;
+    ngx_http_upstream_srv_conf_t **uscfp;
+    ngx_http_upstream_main_conf_t *umcf;
+
+    smcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_status_module);
+
+    if (!smcf->enable && smcf->zones.nelts == 0) {
+        return NGX_OK;
+    }
+
+    ngx_crc32_init(crc);
+
+    zone = smcf->zones.elts;
+
+    for (i = 0; i < smcf->zones.nelts; i++) {
+        type = (u_char) zone[i].type;
+        ngx_crc32_update(&crc, &type, 1);
+        ngx_crc32_update(&crc, zone[i].name.data, zone[i].name.len);
+    }
+
+    smcf->nentries = smcf->zones.nelts;
+
+    /* the peers of the "upstream" blocks are tracked */
+
+    umcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_upstream_module);
+    uscfp = umcf->upstreams.elts;
+
+    for (i = 0; i < umcf->upstreams.nelts; i++) {
+
+        if (uscfp[i]->srv_conf == NULL || uscfp[i]->peer.data == NULL) {
+            continue;
+        }
+
+        su = ngx_array_push(&smcf->upstreams);
+        if (su == NULL) {
+            return NGX_ERROR;
+        }
+
+        su->upstream = uscfp[i];
+        su->index = smcf->nentries;
+        su->npeers = 0;
+
+        for (peers = uscfp[i]->peer.data; peers; peers = peers->next) {
+            su->npeers += peers->number;
+        }
+
+        smcf->nentries += su->npeers;
+
+        type = NGX_HTTP_STATUS_PEER;
+        ngx_crc32_update(&crc, &type, 1);
+        ngx_crc32_update(&crc, uscfp[i]->host.data, uscfp[i]->host.len);
+        ngx_crc32_update(&crc, (u_char *) &su->npeers, sizeof(ngx_uint_t));
+    }
+
+    /* every worker owns a cache line aligned slot */
+
+    smcf->stride = ngx_align(smcf->nentries
+                             * sizeof(ngx_http_status_counters_t),
+                             NGX_CPU_CACHE_LINE);
+
+    ngx_crc32_final(crc);
+
+    smcf->signature = crc;
+
+    cmcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_core_module);
+
+    h = ngx_array_push(&cmcf->phases[NGX_HTTP_LOG_PHASE].handlers);
+    if (h == NULL) {
+        return NGX_ERROR;
+    }
+
+    *h = ngx_http_status_log_handler;
+
+    return NGX_OK;
+}
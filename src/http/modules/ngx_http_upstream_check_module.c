@@ -0,0 +1,821 @@
+
+/*
+ * Copyright (C) Igor Sysoev
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+#define NGX_HTTP_UPSTREAM_CHECK_BUFFER  256
+
+
+typedef struct {
+    ngx_uint_t                         low;
+    ngx_uint_t                         high;
+} ngx_http_upstream_check_status_t;
+
+
+typedef struct {
+    ngx_flag_t                         enable;
+
+    ngx_msec_t                         interval;
+    ngx_msec_t                         timeout;
+    ngx_uint_t                         fails;
+    ngx_uint_t                         passes;
+
+    ngx_str_t                          uri;
+    ngx_str_t                          request;
+
+    ngx_array_t                       *status;
+} ngx_http_upstream_check_srv_conf_t;
+
+
+typedef struct {
+    ngx_http_upstream_check_srv_conf_t  *conf;
+    ngx_http_upstream_srv_conf_t      *upstream;
+
+    ngx_http_upstream_rr_peers_t      *peers;
+    ngx_http_upstream_rr_peer_t       *peer;
+
+    ngx_event_t                        event;
+    ngx_peer_connection_t              pc;
+    ngx_log_t                         *log;
+
+    size_t                             sent;
+    u_char                            *last;
+    u_char                             buffer[NGX_HTTP_UPSTREAM_CHECK_BUFFER];
+} ngx_http_upstream_check_peer_t;
+
+
+static ngx_int_t ngx_http_upstream_check_init_process(ngx_cycle_t *cycle);
+static ngx_int_t ngx_http_upstream_check_init_peers(ngx_cycle_t *cycle,
+    ngx_http_upstream_srv_conf_t *uscf,
+    ngx_http_upstream_check_srv_conf_t *ucf,
+    ngx_http_upstream_rr_peers_t *peers);
+static void ngx_http_upstream_check_handler(ngx_event_t *ev);
+static void ngx_http_upstream_check_write_handler(ngx_event_t *wev);
+static void ngx_http_upstream_check_read_handler(ngx_event_t *rev);
+static void ngx_http_upstream_check_dummy_handler(ngx_event_t *ev);
+static ngx_int_t ngx_http_upstream_check_parse_status(
+    ngx_http_upstream_check_peer_t *cp, ngx_uint_t *status);
+static void ngx_http_upstream_check_finalize(ngx_http_upstream_check_peer_t *cp,
+    ngx_uint_t status);
+
+static void *ngx_http_upstream_check_create_conf(ngx_conf_t *cf);
+static char *ngx_http_upstream_check(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+static char *ngx_http_upstream_check_parse_statuses(ngx_conf_t *cf,
+    ngx_http_upstream_check_srv_conf_t *ucf, ngx_str_t *value);
+
+
+static ngx_command_t  ngx_http_upstream_check_commands[] = {
+
+    { ngx_string("health_check"),
+      NGX_HTTP_UPS_CONF|NGX_CONF_ANY,
+      ngx_http_upstream_check,
+      NGX_HTTP_SRV_CONF_OFFSET,
+      0,
+      NULL },
+
+    { ngx_string("health_check_request"),
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_str_slot,
+      NGX_HTTP_SRV_CONF_OFFSET,
+      offsetof(ngx_http_upstream_check_srv_conf_t, request),
+      NULL },
+
+      ngx_null_command
+};
+
+
+static ngx_http_module_t  ngx_http_upstream_check_module_ctx = {
+    NULL,                                  /* preconfiguration */
+    NULL,                                  /* postconfiguration */
+
+    NULL,                                  /* create main configuration */
+    NULL,                                  /* init main configuration */
+
+    ngx_http_upstream_check_create_conf,   /* create server configuration */
+    NULL,                                  /* merge server configuration */
+
+    NULL,                                  /* create location configuration */
+    NULL                                   /* merge location configuration */
+};
+
+
+ngx_module_t  ngx_http_upstream_check_module = {
+    NGX_MODULE_V1,
+    &ngx_http_upstream_check_module_ctx,   /* module context */
+    ngx_http_upstream_check_commands,      /* module directives */
+    NGX_HTTP_MODULE,                       /* module type */
+    NULL,                                  /* init master */
+    NULL,                                  /* init module */
+    ngx_http_upstream_check_init_process,  /* init process */
+    NULL,                                  /* init thread */
+    NULL,                                  /* exit thread */
+    NULL,                                  /* exit process */
+    NULL,                                  /* exit master */
+    NGX_MODULE_V1_PADDING
+};
+
+
+/*
+ * every worker process arms a timer for each checked peer; if the upstream
+ * is placed in a shared memory zone, the peer's check_next field is used
+ * to elect a single worker to run each probe, so a peer is probed once per
+ * interval regardless of the number of workers
+ */
+
+static ngx_int_t
+ngx_http_upstream_check_init_process(ngx_cycle_t *cycle)
+{
+    u_char                              *p;
+    size_t                               len;
+    ngx_uint_t                           i;
+    ngx_http_upstream_rr_peers_t        *peers;
+    ngx_http_upstream_srv_conf_t       **uscfp;
+    ngx_http_upstream_main_conf_t       *umcf;
+    ngx_http_upstream_check_srv_conf_t  *ucf;
+
+    if (ngx_process != NGX_PROCESS_WORKER
+        && ngx_process != NGX_PROCESS_SINGLE)
+    {
+        return NGX_OK;
+    }
+
+    umcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_upstream_module);
+
+    if (umcf == NULL) {
+        return NGX_OK;
+    }
+
+    uscfp = umcf->upstreams.elts;
+
+    for (i = 0; i < umcf->upstreams.nelts; i++) {
+
+        if (uscfp[i]->srv_conf == NULL) {
+            continue;
+        }
+
+        ucf = ngx_http_conf_upstream_srv_conf(uscfp[i],
+                                              ngx_http_upstream_check_module);
+
+        if (!ucf->enable || uscfp[i]->peer.data == NULL) {
+            continue;
+        }
+
+        if (ucf->request.len == 0) {
+            len = sizeof("GET  HTTP/1.0" CRLF "Host: " CRLF
+                         "Connection: close" CRLF CRLF) - 1
+                  + ucf->uri.len + uscfp[i]->host.len;
+
+            p = ngx_pnalloc(cycle->pool, len);
+            if (p == NULL) {
+                return NGX_ERROR;
+            }
+
+            ucf->request.data = p;
+            ucf->request.len = ngx_sprintf(p, "GET %V HTTP/1.0" CRLF
+                                              "Host: %V" CRLF
+                                              "Connection: close" CRLF CRLF,
+                                           &ucf->uri, &uscfp[i]->host)
+                               - p;
+        }
+
+        for (peers = uscfp[i]->peer.data; peers; peers = peers->next) {
+            if (ngx_http_upstream_check_init_peers(cycle, uscfp[i], ucf, peers)
+                != NGX_OK)
+            {
+                return NGX_ERROR;
+            }
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_upstream_check_init_peers(ngx_cycle_t *cycle,
+    ngx_http_upstream_srv_conf_t *uscf,
+    ngx_http_upstream_check_srv_conf_t *ucf,
+    ngx_http_upstream_rr_peers_t *peers)
+{
+    ngx_uint_t                       i;
+    ngx_http_upstream_rr_peer_t     *peer;
+    ngx_http_upstream_check_peer_t  *cp;
+
+    for (i = 0; i < peers->number; i++) {
+        peer = &peers->peer[i];
+
+        if (peer->host ? peer->host->down : peer->down) {
+            /* marked as permanently unavailable in the configuration */
+            continue;
+        }
+
+        cp = ngx_pcalloc(cycle->pool, sizeof(ngx_http_upstream_check_peer_t));
+        if (cp == NULL) {
+            return NGX_ERROR;
+        }
+
+        cp->conf = ucf;
+        cp->upstream = uscf;
+        cp->peers = peers;
+        cp->peer = peer;
+        cp->log = cycle->log;
+
+        cp->event.handler = ngx_http_upstream_check_handler;
+        cp->event.data = cp;
+        cp->event.log = cycle->log;
+        cp->event.cancelable = 1;
+
+        /* spread the first probes over the interval */
+
+        ngx_add_timer(&cp->event, ngx_random() % ucf->interval + 1);
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_upstream_check_handler(ngx_event_t *ev)
+{
+    ngx_int_t                        rc;
+    ngx_msec_int_t                   delta;
+    ngx_connection_t                *c;
+    ngx_http_upstream_rr_peer_t     *peer;
+    ngx_http_upstream_rr_peers_t    *peers;
+    ngx_http_upstream_check_peer_t  *cp;
+
+    if (ngx_exiting) {
+        return;
+    }
+
+    cp = ev->data;
+    peers = cp->peers;
+    peer = cp->peer;
+
+    ngx_http_upstream_rr_peer_lock(peers, peer);
+
+    if (peer->vacant) {
+
+        /* the slot of a resolvable server without an address */
+
+        ngx_http_upstream_rr_peer_unlock(peers, peer);
+
+        ngx_add_timer(ev, cp->conf->interval);
+        return;
+    }
+
+    delta = (ngx_msec_int_t) (peer->check_next - ngx_current_msec);
+
+    if (delta > 0 && delta <= (ngx_msec_int_t) cp->conf->interval) {
+
+        /* the peer was probed by another worker process */
+
+        ngx_http_upstream_rr_peer_unlock(peers, peer);
+
+        ngx_add_timer(ev, (ngx_msec_t) delta + 1);
+        return;
+    }
+
+    peer->check_next = ngx_current_msec + cp->conf->interval;
+
+    ngx_http_upstream_rr_peer_unlock(peers, peer);
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, ev->log, 0,
+                   "http upstream check \"%V\" peer %V",
+                   &cp->upstream->host, &peer->name);
+
+    ngx_memzero(&cp->pc, sizeof(ngx_peer_connection_t));
+
+    cp->pc.sockaddr = peer->sockaddr;
+    cp->pc.socklen = peer->socklen;
+    cp->pc.name = &peer->name;
+    cp->pc.get = ngx_event_get_peer;
+    cp->pc.log = cp->log;
+    cp->pc.log_error = NGX_ERROR_ERR;
+
+    rc = ngx_event_connect_peer(&cp->pc);
+
+    if (rc == NGX_ERROR || rc == NGX_BUSY || rc == NGX_DECLINED) {
+        ngx_http_upstream_check_finalize(cp, 0);
+        return;
+    }
+
+    /* rc == NGX_OK || rc == NGX_AGAIN */
+
+    c = cp->pc.connection;
+
+    c->data = cp;
+    c->pool = NULL;
+
+    c->write->handler = ngx_http_upstream_check_write_handler;
+    c->read->handler = ngx_http_upstream_check_read_handler;
+
+    cp->sent = 0;
+    cp->last = cp->buffer;
+
+    ngx_add_timer(c->write, cp->conf->timeout);
+
+    if (rc == NGX_OK) {
+        ngx_http_upstream_check_write_handler(c->write);
+    }
+}
+
+
+static void
+ngx_http_upstream_check_write_handler(ngx_event_t *wev)
+{
+    ssize_t                          n;
+    ngx_str_t                       *request;
+    ngx_connection_t                *c;
+    ngx_http_upstream_check_peer_t  *cp;
+
+    c = wev->data;
+    cp = c->data;
+
+    if (wev->timedout) {
+        ngx_log_error(NGX_LOG_ERR, c->log, NGX_ETIMEDOUT,
+                      "upstream health check timed out while connecting "
+                      "to %V", cp->pc.name);
+        ngx_http_upstream_check_finalize(cp, 0);
+        return;
+    }
+
+    request = &cp->conf->request;
+
+    while (cp->sent < request->len) {
+        n = c->send(c, request->data + cp->sent, request->len - cp->sent);
+
+        if (n == NGX_ERROR) {
+            ngx_http_upstream_check_finalize(cp, 0);
+            return;
+        }
+
+        if (n == NGX_AGAIN) {
+            if (ngx_handle_write_event(wev, 0) != NGX_OK) {
+                ngx_http_upstream_check_finalize(cp, 0);
+            }
+
+            return;
+        }
+
+        cp->sent += n;
+    }
+
+    if (wev->timer_set) {
+        ngx_del_timer(wev);
+    }
+
+    wev->handler = ngx_http_upstream_check_dummy_handler;
+
+    ngx_add_timer(c->read, cp->conf->timeout);
+
+    if (c->read->ready) {
+        ngx_http_upstream_check_read_handler(c->read);
+    }
+}
+
+
+static void
+ngx_http_upstream_check_read_handler(ngx_event_t *rev)
+{
+    ssize_t                          n;
+    ngx_int_t                        rc;
+    ngx_uint_t                       status;
+    ngx_connection_t                *c;
+    ngx_http_upstream_check_peer_t  *cp;
+
+    c = rev->data;
+    cp = c->data;
+
+    if (rev->timedout) {
+        ngx_log_error(NGX_LOG_ERR, c->log, NGX_ETIMEDOUT,
+                      "upstream health check timed out while reading "
+                      "response from %V", cp->pc.name);
+        ngx_http_upstream_check_finalize(cp, 0);
+        return;
+    }
+
+    for ( ;; ) {
+        n = c->recv(c, cp->last, cp->buffer + NGX_HTTP_UPSTREAM_CHECK_BUFFER
+                                 - cp->last);
+
+        if (n == NGX_AGAIN) {
+            if (ngx_handle_read_event(rev, 0) != NGX_OK) {
+                ngx_http_upstream_check_finalize(cp, 0);
+            }
+
+            return;
+        }
+
+        if (n > 0) {
+            cp->last += n;
+        }
+
+        rc = ngx_http_upstream_check_parse_status(cp, &status);
+
+        if (rc == NGX_OK) {
+            ngx_http_upstream_check_finalize(cp, status);
+            return;
+        }
+
+        if (n == NGX_ERROR) {
+            ngx_http_upstream_check_finalize(cp, 0);
+            return;
+        }
+
+        if (n == 0) {
+            ngx_log_error(NGX_LOG_ERR, c->log, 0,
+                          "upstream health check connection to %V "
+                          "prematurely closed", cp->pc.name);
+            ngx_http_upstream_check_finalize(cp, 0);
+            return;
+        }
+
+        if (rc == NGX_ERROR
+            || cp->last == cp->buffer + NGX_HTTP_UPSTREAM_CHECK_BUFFER)
+        {
+            ngx_log_error(NGX_LOG_ERR, c->log, 0,
+                          "upstream health check got invalid response "
+                          "from %V", cp->pc.name);
+            ngx_http_upstream_check_finalize(cp, 0);
+            return;
+        }
+    }
+}
+
+
+static void
+ngx_http_upstream_check_dummy_handler(ngx_event_t *ev)
+{
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ev->log, 0,
+                   "http upstream check dummy handler");
+}
+
+
+/* the "HTTP/x.y NNN" part of the status line is all we are interested in */
+
+static ngx_int_t
+ngx_http_upstream_check_parse_status(ngx_http_upstream_check_peer_t *cp,
+    ngx_uint_t *status)
+{
+    u_char  *p, *last;
+
+    p = cp->buffer;
+    last = ngx_strlchr(p, cp->last, LF);
+
+    if (last == NULL) {
+        return NGX_AGAIN;
+    }
+
+    if (last - p < 12 || ngx_strncmp(p, "HTTP/", 5) != 0) {
+        return NGX_ERROR;
+    }
+
+    p = ngx_strlchr(p + 5, last, ' ');
+
+    if (p == NULL || last - p < 4) {
+        return NGX_ERROR;
+    }
+
+    p++;
+
+    if (p[0] < '1' || p[0] > '9'
+        || p[1] < '0' || p[1] > '9'
+        || p[2] < '0' || p[2] > '9')
+    {
+        return NGX_ERROR;
+    }
+
+    *status = (p[0] - '0') * 100 + (p[1] - '0') * 10 + (p[2] - '0');
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_upstream_check_finalize(ngx_http_upstream_check_peer_t *cp,
+    ngx_uint_t status)
+{
+    ngx_uint_t                           i, ok;
+    ngx_http_upstream_rr_peer_t         *peer;
+    ngx_http_upstream_rr_peers_t        *peers;
+    ngx_http_upstream_check_status_t    *range;
+    ngx_http_upstream_check_srv_conf_t  *ucf;
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, cp->log, 0,
+                   "http upstream check %V status: %ui",
+                   &cp->peer->name, status);
+
+    if (cp->pc.connection) {
+        ngx_close_connection(cp->pc.connection);
+        cp->pc.connection = NULL;
+    }
+
+    ucf = cp->conf;
+    peers = cp->peers;
+    peer = cp->peer;
+
+    ok = 0;
+
+    if (status) {
+        range = ucf->status->elts;
+
+        for (i = 0; i < ucf->status->nelts; i++) {
+            if (status >= range[i].low && status <= range[i].high) {
+                ok = 1;
+                break;
+            }
+        }
+
+        if (!ok) {
+            ngx_log_error(NGX_LOG_ERR, cp->log, 0,
+                          "upstream health check got unexpected status %ui "
+                          "from %V", status, &peer->name);
+        }
+    }
+
+    ngx_http_upstream_rr_peer_lock(peers, peer);
+
+    if (peer->vacant) {
+
+        /* the address was removed by the resolver while being probed */
+
+        ngx_http_upstream_rr_peer_unlock(peers, peer);
+        goto next;
+    }
+
+    if (ok) {
+        peer->check_fails = 0;
+
+        if (peer->check_down) {
+            if (++peer->check_passes >= ucf->passes) {
+                peer->check_down = 0;
+                peer->check_passes = 0;
+                peer->down = 0;
+                peer->fails = 0;
+
+                ngx_log_error(NGX_LOG_WARN, cp->log, 0,
+                              "upstream server %V in upstream \"%V\" "
+                              "passed health check, marked as up",
+                              &peer->name, &cp->upstream->host);
+            }
+
+        } else if (peer->max_fails && peer->fails >= peer->max_fails) {
+
+            /* the peer is alive, do not wait out fail_timeout */
+
+            peer->fails = 0;
+        }
+
+    } else {
+        peer->check_passes = 0;
+
+        if (!peer->check_down && ++peer->check_fails >= ucf->fails) {
+            peer->check_down = 1;
+            peer->check_fails = 0;
+            peer->down = 1;
+
+            ngx_log_error(NGX_LOG_WARN, cp->log, 0,
+                          "upstream server %V in upstream \"%V\" "
+                          "failed health check, marked as down",
+                          &peer->name, &cp->upstream->host);
+        }
+    }
+
+    ngx_http_upstream_rr_peer_unlock(peers, peer);
+
+next:
+
+    if (!ngx_exiting) {
+        ngx_add_timer(&cp->event, ucf->interval);
+    }
+}
+
+
+static void *
+ngx_http_upstream_check_create_conf(ngx_conf_t *cf)
+{
+    ngx_http_upstream_check_srv_conf_t  *conf;
+
+    conf = ngx_pcalloc(cf->pool, sizeof(ngx_http_upstream_check_srv_conf_t));
+    if (conf == NULL) {
+        return NULL;
+    }
+
+    /*
+     * set by ngx_pcalloc():
+     *
+     *     conf->enable = 0;
+     *     conf->uri = { 0, NULL };
+     *     conf->request = { 0, NULL };
+     *     conf->status = NULL;
+     */
+
+    return conf;
+}
+
+
+static char *
+ngx_http_upstream_check(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_http_upstream_check_srv_conf_t  *ucf = conf;
+
+    ngx_int_t                          n;
+    ngx_str_t                         *value, s;
+    ngx_uint_t                         i;
+    ngx_http_upstream_check_status_t  *range;
+
+    if (ucf->enable) {
+        return "is duplicate";
+    }
+
+    ucf->enable = 1;
+    ucf->interval = 5000;
+    ucf->timeout = 1000;
+    ucf->fails = 1;
+    ucf->passes = 1;
+    ngx_str_set(&ucf->uri, "/");
+
+    value = cf->args->elts;
+
+    for (i = 1; i < cf->args->nelts; i++) {
+
+        if (ngx_strncmp(value[i].data, "interval=", 9) == 0) {
+
+            s.len = value[i].len - 9;
+            s.data = &value[i].data[9];
+
+            ucf->interval = ngx_parse_time(&s, 0);
+
+            if (ucf->interval == (ngx_msec_t) NGX_ERROR
+                || ucf->interval == 0)
+            {
+                goto invalid;
+            }
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "timeout=", 8) == 0) {
+
+            s.len = value[i].len - 8;
+            s.data = &value[i].data[8];
+
+            ucf->timeout = ngx_parse_time(&s, 0);
+
+            if (ucf->timeout == (ngx_msec_t) NGX_ERROR || ucf->timeout == 0) {
+                goto invalid;
+            }
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "fails=", 6) == 0) {
+
+            n = ngx_atoi(&value[i].data[6], value[i].len - 6);
+
+            if (n == NGX_ERROR || n == 0) {
+                goto invalid;
+            }
+
+            ucf->fails = n;
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "passes=", 7) == 0) {
+
+            n = ngx_atoi(&value[i].data[7], value[i].len - 7);
+
+            if (n == NGX_ERROR || n == 0) {
+                goto invalid;
+            }
+
+            ucf->passes = n;
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "uri=", 4) == 0) {
+
+            ucf->uri.len = value[i].len - 4;
+            ucf->uri.data = &value[i].data[4];
+
+            if (ucf->uri.len == 0 || ucf->uri.data[0] != '/') {
+                goto invalid;
+            }
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "status=", 7) == 0) {
+
+            s.len = value[i].len - 7;
+            s.data = &value[i].data[7];
+
+            if (ngx_http_upstream_check_parse_statuses(cf, ucf, &s)
+                != NGX_CONF_OK)
+            {
+                goto invalid;
+            }
+
+            continue;
+        }
+
+        goto invalid;
+    }
+
+    if (ucf->status == NULL) {
+        ucf->status = ngx_array_create(cf->pool, 1,
+                                       sizeof(ngx_http_upstream_check_status_t));
+        if (ucf->status == NULL) {
+            return NGX_CONF_ERROR;
+        }
+
+        range = ngx_array_push(ucf->status);
+        if (range == NULL) {
+            return NGX_CONF_ERROR;
+        }
+
+        range->low = 200;
+        range->high = 399;
+    }
+
+    return NGX_CONF_OK;
+
+invalid:
+
+    ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                       "invalid parameter \"%V\"", &value[i]);
+
+    return NGX_CONF_ERROR;
+}
+
+
+/* "status=200,204,300-399" */
+
+static char *
+ngx_http_upstream_check_parse_statuses(ngx_conf_t *cf,
+    ngx_http_upstream_check_srv_conf_t *ucf, ngx_str_t *value)
+{
+    u_char                            *p, *last, *dash, *comma;
+    ngx_int_t                          low, high;
+    ngx_http_upstream_check_status_t  *range;
+
+    if (ucf->status == NULL) {
+        ucf->status = ngx_array_create(cf->pool, 2,
+                                       sizeof(ngx_http_upstream_check_status_t));
+        if (ucf->status == NULL) {
+            return NGX_CONF_ERROR;
+        }
+    }
+
+    p = value->data;
+    last = value->data + value->len;
+
+    while (p < last) {
+        comma = ngx_strlchr(p, last, ',');
+        if (comma == NULL) {
+            comma = last;
+        }
+
+        dash = ngx_strlchr(p, comma, '-');
+
+        if (dash) {
+            low = ngx_atoi(p, dash - p);
+            high = ngx_atoi(dash + 1, comma - dash - 1);
+
+        } else {
+            low = ngx_atoi(p, comma - p);
+            high = low;
+        }
+
+        if (low < 100 || high > 599 || low > high) {
+            return NGX_CONF_ERROR;
+        }
+
+        range = ngx_array_push(ucf->status);
+        if (range == NULL) {
+            return NGX_CONF_ERROR;
+        }
+
+        range->low = low;
+        range->high = high;
+
+        p = comma + 1;
+    }
+
+    if (ucf->status->nelts == 0) {
+        return NGX_CONF_ERROR;
+    }
+
+    return NGX_CONF_OK;
+}
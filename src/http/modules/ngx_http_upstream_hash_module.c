@@ -176,7 +176,10 @@ ngx_http_upstream_get_hash_peer(ngx_peer_connection_t *pc, void *data)
     ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
                    "get hash peer, try: %ui", pc->tries);
 
+    ngx_http_upstream_rr_peers_rlock(hp->rrp.peers);
+
     if (hp->tries > 20 || hp->rrp.peers->single) {
+        ngx_http_upstream_rr_peers_unlock(hp->rrp.peers);
         return hp->get_rr_peer(pc, &hp->rrp);
     }
 
@@ -236,7 +239,10 @@ ngx_http_upstream_get_hash_peer(ngx_peer_connection_t *pc, void *data)
 
         peer = &hp->rrp.peers->peer[p];
 
+        ngx_http_upstream_rr_peer_lock(hp->rrp.peers, peer);
+
         if (peer->down) {
+            ngx_http_upstream_rr_peer_unlock(hp->rrp.peers, peer);
             goto next;
         }
 
@@ -244,6 +250,7 @@ ngx_http_upstream_get_hash_peer(ngx_peer_connection_t *pc, void *data)
             && peer->fails >= peer->max_fails
             && now - peer->checked <= peer->fail_timeout)
         {
+            ngx_http_upstream_rr_peer_unlock(hp->rrp.peers, peer);
             goto next;
         }
 
@@ -252,6 +259,7 @@ ngx_http_upstream_get_hash_peer(ngx_peer_connection_t *pc, void *data)
     next:
 
         if (++hp->tries > 20) {
+            ngx_http_upstream_rr_peers_unlock(hp->rrp.peers);
             return hp->get_rr_peer(pc, &hp->rrp);
         }
     }
@@ -262,10 +270,15 @@ ngx_http_upstream_get_hash_peer(ngx_peer_connection_t *pc, void *data)
     pc->socklen = peer->socklen;
     pc->name = &peer->name;
 
+    peer->conns++;
+
     if (now - peer->checked > peer->fail_timeout) {
         peer->checked = now;
     }
 
+    ngx_http_upstream_rr_peer_unlock(hp->rrp.peers, peer);
+    ngx_http_upstream_rr_peers_unlock(hp->rrp.peers);
+
     hp->rrp.tried[n] |= m;
 
     return NGX_OK;
@@ -491,6 +504,8 @@ ngx_http_upstream_get_chash_peer(ngx_peer_connection_t *pc, void *data)
     points = hcf->points;
     point = &points->point[0];
 
+    ngx_http_upstream_rr_peers_wlock(hp->rrp.peers);
+
     for ( ;; ) {
         server = point[hp->hash % points->number].server;
 
@@ -562,6 +577,10 @@ ngx_http_upstream_get_chash_peer(ngx_peer_connection_t *pc, void *data)
             pc->socklen = best->socklen;
             pc->name = &best->name;
 
+            best->conns++;
+
+            ngx_http_upstream_rr_peers_unlock(hp->rrp.peers);
+
             return NGX_OK;
         }
 
@@ -569,6 +588,7 @@ ngx_http_upstream_get_chash_peer(ngx_peer_connection_t *pc, void *data)
         hp->tries++;
 
         if (hp->tries >= points->number) {
+            ngx_http_upstream_rr_peers_unlock(hp->rrp.peers);
             return NGX_BUSY;
         }
     }
@@ -12,9 +12,16 @@
 
 typedef struct {
     ngx_uint_t                         max_cached;
+    ngx_uint_t                         max_per_peer;
+    ngx_uint_t                         requests;
+    ngx_msec_t                         timeout;
 
     ngx_queue_t                        cache;
     ngx_queue_t                        free;
+    ngx_queue_t                        buckets;
+
+    ngx_rbtree_t                       peers;
+    ngx_rbtree_node_t                  sentinel;
 
     ngx_http_upstream_init_pt          original_init_upstream;
     ngx_http_upstream_init_peer_pt     original_init_peer;
@@ -37,18 +44,38 @@ typedef struct {
     ngx_event_save_peer_session_pt     original_save_session;
 #endif
 
+    /* 每次尝试是否复用了缓存连接, 供 $upstream_keepalive 使用 */
+    ngx_array_t                        tries;
+
 } ngx_http_upstream_keepalive_peer_data_t;
 
 
-typedef struct {
-    ngx_http_upstream_keepalive_srv_conf_t  *conf;
+/*
+ * 每个后端地址一个桶, 桶内按最近使用排序, 使热点后端只淘汰自己的连接;
+ * 桶在最后一个连接离开时归还空闲队列, 供其他地址复用
+ */
 
+typedef struct {
+    ngx_rbtree_node_t                  node;
     ngx_queue_t                        queue;
-    ngx_connection_t                  *connection;
+
+    ngx_queue_t                        cache;
+    ngx_uint_t                         cached;
 
     socklen_t                          socklen;
     u_char                             sockaddr[NGX_SOCKADDRLEN];
 
+} ngx_http_upstream_keepalive_bucket_t;
+
+
+typedef struct {
+    ngx_http_upstream_keepalive_srv_conf_t  *conf;
+    ngx_http_upstream_keepalive_bucket_t    *bucket;
+
+    ngx_queue_t                        queue;
+    ngx_queue_t                        peer_queue;
+    ngx_connection_t                  *connection;
+
 } ngx_http_upstream_keepalive_cache_t;
 
 
@@ -62,6 +89,16 @@ static void ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc,
 static void ngx_http_upstream_keepalive_dummy_handler(ngx_event_t *ev);
 static void ngx_http_upstream_keepalive_close_handler(ngx_event_t *ev);
 static void ngx_http_upstream_keepalive_close(ngx_connection_t *c);
+static ngx_http_upstream_keepalive_bucket_t *
+    ngx_http_upstream_keepalive_lookup(ngx_http_upstream_keepalive_srv_conf_t
+    *kcf, struct sockaddr *sockaddr, socklen_t socklen, ngx_uint_t create);
+static void ngx_http_upstream_keepalive_rbtree_insert_value(
+    ngx_rbtree_node_t *temp, ngx_rbtree_node_t *node,
+    ngx_rbtree_node_t *sentinel);
+static void ngx_http_upstream_keepalive_evict(
+    ngx_http_upstream_keepalive_cache_t *item);
+static void ngx_http_upstream_keepalive_release(
+    ngx_http_upstream_keepalive_cache_t *item);
 
 
 #if (NGX_HTTP_SSL)
@@ -71,6 +108,9 @@ static void ngx_http_upstream_keepalive_save_session(ngx_peer_connection_t *pc,
     void *data);
 #endif
 
+static ngx_int_t ngx_http_upstream_keepalive_variable(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data);
+static ngx_int_t ngx_http_upstream_keepalive_add_variables(ngx_conf_t *cf);
 static void *ngx_http_upstream_keepalive_create_conf(ngx_conf_t *cf);
 static char *ngx_http_upstream_keepalive(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
@@ -79,18 +119,32 @@ static char *ngx_http_upstream_keepalive(ngx_conf_t *cf, ngx_command_t *cmd,
 static ngx_command_t  ngx_http_upstream_keepalive_commands[] = {
 
     { ngx_string("keepalive"),
-      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE1,
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE12,
       ngx_http_upstream_keepalive,
       NGX_HTTP_SRV_CONF_OFFSET,
       0,
       NULL },
 
+    { ngx_string("keepalive_timeout"),
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_msec_slot,
+      NGX_HTTP_SRV_CONF_OFFSET,
+      offsetof(ngx_http_upstream_keepalive_srv_conf_t, timeout),
+      NULL },
+
+    { ngx_string("keepalive_requests"),
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_num_slot,
+      NGX_HTTP_SRV_CONF_OFFSET,
+      offsetof(ngx_http_upstream_keepalive_srv_conf_t, requests),
+      NULL },
+
       ngx_null_command
 };
 
 
 static ngx_http_module_t  ngx_http_upstream_keepalive_module_ctx = {
-    NULL,                                  /* preconfiguration */
+    ngx_http_upstream_keepalive_add_variables, /* preconfiguration */
     NULL,                                  /* postconfiguration */
 
     NULL,                                  /* create main configuration */
@@ -120,6 +174,16 @@ ngx_module_t  ngx_http_upstream_keepalive_module = {
 };
 
 
+static ngx_http_variable_t  ngx_http_upstream_keepalive_vars[] = {
+
+    { ngx_string("upstream_keepalive"), NULL,
+      ngx_http_upstream_keepalive_variable, 0,
+      NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_null_string, NULL, NULL, 0, 0, 0 }
+};
+
+
 static ngx_int_t
 ngx_http_upstream_init_keepalive(ngx_conf_t *cf,
     ngx_http_upstream_srv_conf_t *us)
@@ -127,6 +191,7 @@ ngx_http_upstream_init_keepalive(ngx_conf_t *cf,
     ngx_uint_t                               i;
     ngx_http_upstream_keepalive_srv_conf_t  *kcf;
     ngx_http_upstream_keepalive_cache_t     *cached;
+    ngx_http_upstream_keepalive_bucket_t    *buckets;
 
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, cf->log, 0,
                    "init keepalive");
@@ -142,6 +207,12 @@ ngx_http_upstream_init_keepalive(ngx_conf_t *cf,
 
     us->peer.init = ngx_http_upstream_init_keepalive_peer;
 
+    ngx_conf_init_msec_value(kcf->timeout, 60000);
+    ngx_conf_init_uint_value(kcf->requests, 100);
+
+    ngx_rbtree_init(&kcf->peers, &kcf->sentinel,
+                    ngx_http_upstream_keepalive_rbtree_insert_value);
+
     /* allocate cache items and add to free queue */
 
     cached = ngx_pcalloc(cf->pool,
@@ -158,6 +229,25 @@ ngx_http_upstream_init_keepalive(ngx_conf_t *cf,
         cached[i].conf = kcf;
     }
 
+    /*
+     * a bucket is only kept while it holds connections, so there are
+     * never more buckets in use than cache items; the peers may change
+     * with re-resolving, a bucket of a gone peer is freed once its
+     * connections expire or are evicted, and is reused for another peer
+     */
+
+    buckets = ngx_palloc(cf->pool,
+               sizeof(ngx_http_upstream_keepalive_bucket_t) * kcf->max_cached);
+    if (buckets == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_queue_init(&kcf->buckets);
+
+    for (i = 0; i < kcf->max_cached; i++) {
+        ngx_queue_insert_head(&kcf->buckets, &buckets[i].queue);
+    }
+
     return NGX_OK;
 }
 
@@ -184,6 +274,12 @@ ngx_http_upstream_init_keepalive_peer(ngx_http_request_t *r,
         return NGX_ERROR;
     }
 
+    if (ngx_array_init(&kp->tries, r->pool, 1, sizeof(ngx_uint_t)) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    ngx_http_set_ctx(r, kp, ngx_http_upstream_keepalive_module);
+
     kp->conf = kcf;
     kp->upstream = r->upstream;
     kp->data = r->upstream->peer.data;
@@ -210,9 +306,11 @@ ngx_http_upstream_get_keepalive_peer(ngx_peer_connection_t *pc, void *data)
 {
     ngx_http_upstream_keepalive_peer_data_t  *kp = data;
     ngx_http_upstream_keepalive_cache_t      *item;
+    ngx_http_upstream_keepalive_bucket_t     *bucket;
 
     ngx_int_t          rc;
-    ngx_queue_t       *q, *cache;
+    ngx_uint_t        *hit;
+    ngx_queue_t       *q;
     ngx_connection_t  *c;
 
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, pc->log, 0,
@@ -226,42 +324,51 @@ ngx_http_upstream_get_keepalive_peer(ngx_peer_connection_t *pc, void *data)
         return rc;
     }
 
-    /* search cache for suitable connection */
+    hit = ngx_array_push(&kp->tries);
+    if (hit == NULL) {
+        return NGX_ERROR;
+    }
 
-    cache = &kp->conf->cache;
+    *hit = 0;
 
-    for (q = ngx_queue_head(cache);
-         q != ngx_queue_sentinel(cache);
-         q = ngx_queue_next(q))
-    {
-        item = ngx_queue_data(q, ngx_http_upstream_keepalive_cache_t, queue);
-        c = item->connection;
+    /* search cache of the peer for suitable connection */
 
-        if (ngx_memn2cmp((u_char *) &item->sockaddr, (u_char *) pc->sockaddr,
-                         item->socklen, pc->socklen)
-            == 0)
-        {
-            ngx_queue_remove(q);
-            ngx_queue_insert_head(&kp->conf->free, q);
+    bucket = ngx_http_upstream_keepalive_lookup(kp->conf, pc->sockaddr,
+                                                pc->socklen, 0);
 
-            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
-                           "get keepalive peer: using connection %p", c);
+    if (bucket == NULL || ngx_queue_empty(&bucket->cache)) {
+        return NGX_OK;
+    }
 
-            c->idle = 0;
-            c->sent = 0;
-            c->log = pc->log;
-            c->read->log = pc->log;
-            c->write->log = pc->log;
-            c->pool->log = pc->log;
+    q = ngx_queue_head(&bucket->cache);
+    item = ngx_queue_data(q, ngx_http_upstream_keepalive_cache_t, peer_queue);
+    c = item->connection;
 
-            pc->connection = c;
-            pc->cached = 1;
+    ngx_http_upstream_keepalive_release(item);
 
-            return NGX_DONE;
-        }
+    ngx_queue_remove(&item->queue);
+    ngx_queue_insert_head(&kp->conf->free, &item->queue);
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
+                   "get keepalive peer: using connection %p", c);
+
+    if (c->read->timer_set) {
+        ngx_del_timer(c->read);
     }
 
-    return NGX_OK;
+    c->idle = 0;
+    c->sent = 0;
+    c->log = pc->log;
+    c->read->log = pc->log;
+    c->write->log = pc->log;
+    c->pool->log = pc->log;
+
+    pc->connection = c;
+    pc->cached = 1;
+
+    *hit = 1;
+
+    return NGX_DONE;
 }
 
 
@@ -271,6 +378,7 @@ ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
 {
     ngx_http_upstream_keepalive_peer_data_t  *kp = data;
     ngx_http_upstream_keepalive_cache_t      *item;
+    ngx_http_upstream_keepalive_bucket_t     *bucket;
 
     ngx_queue_t          *q;
     ngx_connection_t     *c;
@@ -299,6 +407,10 @@ ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
         goto invalid;
     }
 
+    if (c->requests >= kp->conf->requests) {
+        goto invalid;
+    }
+
     if (ngx_handle_read_event(c->read, 0) != NGX_OK) {
         goto invalid;
     }
@@ -306,24 +418,46 @@ ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
     ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
                    "free keepalive peer: saving connection %p", c);
 
-    if (ngx_queue_empty(&kp->conf->free)) {
+    bucket = ngx_http_upstream_keepalive_lookup(kp->conf, pc->sockaddr,
+                                                pc->socklen, 0);
 
-        q = ngx_queue_last(&kp->conf->cache);
-        ngx_queue_remove(q);
+    if (bucket && kp->conf->max_per_peer
+        && bucket->cached >= kp->conf->max_per_peer)
+    {
+
+        /* the peer used up its share, reuse its least recently used item */
+
+        q = ngx_queue_last(&bucket->cache);
+        item = ngx_queue_data(q, ngx_http_upstream_keepalive_cache_t,
+                              peer_queue);
+
+        ngx_http_upstream_keepalive_evict(item);
+
+    } else if (ngx_queue_empty(&kp->conf->free)) {
 
+        q = ngx_queue_last(&kp->conf->cache);
         item = ngx_queue_data(q, ngx_http_upstream_keepalive_cache_t, queue);
 
-        ngx_http_upstream_keepalive_close(item->connection);
+        ngx_http_upstream_keepalive_evict(item);
 
     } else {
         q = ngx_queue_head(&kp->conf->free);
-        ngx_queue_remove(q);
-
         item = ngx_queue_data(q, ngx_http_upstream_keepalive_cache_t, queue);
     }
 
+    /* the eviction may have released the bucket */
+
+    bucket = ngx_http_upstream_keepalive_lookup(kp->conf, pc->sockaddr,
+                                                pc->socklen, 1);
+
+    ngx_queue_remove(&item->queue);
+
     item->connection = c;
-    ngx_queue_insert_head(&kp->conf->cache, q);
+    item->bucket = bucket;
+
+    ngx_queue_insert_head(&kp->conf->cache, &item->queue);
+    ngx_queue_insert_head(&bucket->cache, &item->peer_queue);
+    bucket->cached++;
 
     pc->connection = NULL;
 
@@ -334,6 +468,8 @@ ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
         ngx_del_timer(c->write);
     }
 
+    ngx_add_timer(c->read, kp->conf->timeout);
+
     c->write->handler = ngx_http_upstream_keepalive_dummy_handler;
     c->read->handler = ngx_http_upstream_keepalive_close_handler;
 
@@ -344,9 +480,6 @@ ngx_http_upstream_free_keepalive_peer(ngx_peer_connection_t *pc, void *data,
     c->write->log = ngx_cycle->log;
     c->pool->log = ngx_cycle->log;
 
-    item->socklen = pc->socklen;
-    ngx_memcpy(&item->sockaddr, pc->sockaddr, pc->socklen);
-
     if (c->read->ready) {
         ngx_http_upstream_keepalive_close_handler(c->read);
     }
@@ -380,7 +513,7 @@ ngx_http_upstream_keepalive_close_handler(ngx_event_t *ev)
 
     c = ev->data;
 
-    if (c->close) {
+    if (c->close || ev->timedout) {
         goto close;
     }
 
@@ -401,13 +534,40 @@ close:
     item = c->data;
     conf = item->conf;
 
-    ngx_http_upstream_keepalive_close(c);
+    ngx_http_upstream_keepalive_evict(item);
 
     ngx_queue_remove(&item->queue);
     ngx_queue_insert_head(&conf->free, &item->queue);
 }
 
 
+static void
+ngx_http_upstream_keepalive_evict(ngx_http_upstream_keepalive_cache_t *item)
+{
+    ngx_http_upstream_keepalive_release(item);
+
+    ngx_http_upstream_keepalive_close(item->connection);
+}
+
+
+static void
+ngx_http_upstream_keepalive_release(ngx_http_upstream_keepalive_cache_t *item)
+{
+    ngx_http_upstream_keepalive_bucket_t  *bucket;
+
+    bucket = item->bucket;
+
+    ngx_queue_remove(&item->peer_queue);
+
+    if (--bucket->cached) {
+        return;
+    }
+
+    ngx_rbtree_delete(&item->conf->peers, &bucket->node);
+    ngx_queue_insert_head(&item->conf->buckets, &bucket->queue);
+}
+
+
 static void
 ngx_http_upstream_keepalive_close(ngx_connection_t *c)
 {
@@ -431,6 +591,120 @@ ngx_http_upstream_keepalive_close(ngx_connection_t *c)
 }
 
 
+static ngx_http_upstream_keepalive_bucket_t *
+ngx_http_upstream_keepalive_lookup(ngx_http_upstream_keepalive_srv_conf_t *kcf,
+    struct sockaddr *sockaddr, socklen_t socklen, ngx_uint_t create)
+{
+    ngx_int_t                              rc;
+    uint32_t                               hash;
+    ngx_queue_t                           *q;
+    ngx_rbtree_node_t                     *node, *sentinel;
+    ngx_http_upstream_keepalive_bucket_t  *bucket;
+
+    hash = ngx_crc32_short((u_char *) sockaddr, socklen);
+
+    node = kcf->peers.root;
+    sentinel = kcf->peers.sentinel;
+
+    while (node != sentinel) {
+
+        if (hash < node->key) {
+            node = node->left;
+            continue;
+        }
+
+        if (hash > node->key) {
+            node = node->right;
+            continue;
+        }
+
+        /* hash == node->key */
+
+        bucket = (ngx_http_upstream_keepalive_bucket_t *) node;
+
+        /* ordered as by the insert_value() below */
+
+        rc = ngx_memn2cmp((u_char *) sockaddr, bucket->sockaddr,
+                          socklen, bucket->socklen);
+
+        if (rc == 0) {
+            return bucket;
+        }
+
+        node = (rc < 0) ? node->left : node->right;
+    }
+
+    if (!create) {
+        return NULL;
+    }
+
+    /*
+     * the caller holds a free cache item, so at most max_cached - 1
+     * buckets are in use and a free one is always available
+     */
+
+    q = ngx_queue_head(&kcf->buckets);
+    ngx_queue_remove(q);
+
+    bucket = ngx_queue_data(q, ngx_http_upstream_keepalive_bucket_t, queue);
+
+    bucket->node.key = hash;
+
+    ngx_queue_init(&bucket->cache);
+    bucket->cached = 0;
+
+    bucket->socklen = socklen;
+    ngx_memcpy(bucket->sockaddr, sockaddr, socklen);
+
+    ngx_rbtree_insert(&kcf->peers, &bucket->node);
+
+    return bucket;
+}
+
+
+static void
+ngx_http_upstream_keepalive_rbtree_insert_value(ngx_rbtree_node_t *temp,
+    ngx_rbtree_node_t *node, ngx_rbtree_node_t *sentinel)
+{
+    ngx_rbtree_node_t                    **p;
+    ngx_http_upstream_keepalive_bucket_t  *b, *bt;
+
+    for ( ;; ) {
+
+        if (node->key < temp->key) {
+
+            p = &temp->left;
+
+        } else if (node->key > temp->key) {
+
+            p = &temp->right;
+
+        } else { /* node->key == temp->key */
+
+            b = (ngx_http_upstream_keepalive_bucket_t *) node;
+            bt = (ngx_http_upstream_keepalive_bucket_t *) temp;
+
+            p = (ngx_memn2cmp(b->sockaddr, bt->sockaddr, b->socklen,
+                              bt->socklen)
+                 < 0)
+                ? &temp->left : &temp->right;
+        }
+
+        if (*p == sentinel) {
+            break;
+        }
+
+        temp = *p;
+    }
+
+    *p = node;
+    node->parent = temp;
+    node->left = sentinel;
+    node->right = sentinel;
+    ngx_rbt_red(node);
+}
+
+
 #if (NGX_HTTP_SSL)
 
 static ngx_int_t
@@ -454,6 +728,74 @@ ngx_http_upstream_keepalive_save_session(ngx_peer_connection_t *pc, void *data)
 #endif
 
 
+static ngx_int_t
+ngx_http_upstream_keepalive_variable(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data)
+{
+    u_char                                   *p;
+    size_t                                    len;
+    ngx_uint_t                                i, *hit;
+    ngx_http_upstream_keepalive_peer_data_t  *kp;
+
+    kp = ngx_http_get_module_ctx(r, ngx_http_upstream_keepalive_module);
+
+    if (kp == NULL || kp->tries.nelts == 0) {
+        v->not_found = 1;
+        return NGX_OK;
+    }
+
+    len = kp->tries.nelts * (sizeof("miss, ") - 1);
+
+    p = ngx_pnalloc(r->pool, len);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    v->data = p;
+
+    hit = kp->tries.elts;
+
+    for (i = 0; i < kp->tries.nelts; i++) {
+
+        if (hit[i]) {
+            p = ngx_cpymem(p, "hit", sizeof("hit") - 1);
+
+        } else {
+            p = ngx_cpymem(p, "miss", sizeof("miss") - 1);
+        }
+
+        *p++ = ',';
+        *p++ = ' ';
+    }
+
+    v->len = p - 2 - v->data;
+    v->valid = 1;
+    v->no_cacheable = 0;
+    v->not_found = 0;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_upstream_keepalive_add_variables(ngx_conf_t *cf)
+{
+    ngx_http_variable_t  *var, *v;
+
+    for (v = ngx_http_upstream_keepalive_vars; v->name.len; v++) {
+        var = ngx_http_add_variable(cf, &v->name, v->flags);
+        if (var == NULL) {
+            return NGX_ERROR;
+        }
+
+        var->get_handler = v->get_handler;
+        var->data = v->data;
+    }
+
+    return NGX_OK;
+}
+
+
 static void *
 ngx_http_upstream_keepalive_create_conf(ngx_conf_t *cf)
 {
@@ -470,9 +812,12 @@ ngx_http_upstream_keepalive_create_conf(ngx_conf_t *cf)
      *
      *     conf->original_init_upstream = NULL;
      *     conf->original_init_peer = NULL;
+     *     conf->max_per_peer = 0;
      */
 
     conf->max_cached = 1;
+    conf->timeout = NGX_CONF_UNSET_MSEC;
+    conf->requests = NGX_CONF_UNSET_UINT;
 
     return conf;
 }
@@ -485,7 +830,7 @@ ngx_http_upstream_keepalive(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     ngx_http_upstream_keepalive_srv_conf_t  *kcf = conf;
 
     ngx_int_t    n;
-    ngx_str_t   *value;
+    ngx_str_t   *value, s;
 
     uscf = ngx_http_conf_get_module_srv_conf(cf, ngx_http_upstream_module);
 
@@ -514,5 +859,28 @@ ngx_http_upstream_keepalive(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 
     kcf->max_cached = n;
 
+    if (cf->args->nelts == 3) {
+
+        if (ngx_strncmp(value[2].data, "per_peer=", 9) != 0) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid parameter \"%V\"", &value[2]);
+            return NGX_CONF_ERROR;
+        }
+
+        s.len = value[2].len - 9;
+        s.data = value[2].data + 9;
+
+        n = ngx_atoi(s.data, s.len);
+
+        if (n == NGX_ERROR || n == 0 || (ngx_uint_t) n > kcf->max_cached) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid value \"%V\" in \"%V\" directive",
+                               &value[2], &cmd->name);
+            return NGX_CONF_ERROR;
+        }
+
+        kcf->max_per_peer = n;
+    }
+
     return NGX_CONF_OK;
 }
@@ -0,0 +1,300 @@
+
+/*
+ * Copyright (C) Ruslan Ermilov
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+static char *ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+static ngx_int_t ngx_http_upstream_init_zone(ngx_shm_zone_t *shm_zone,
+    void *data);
+static ngx_http_upstream_rr_peers_t *ngx_http_upstream_zone_copy_peers(
+    ngx_slab_pool_t *shpool, ngx_http_upstream_rr_peers_t *src);
+static ngx_int_t ngx_http_upstream_zone_copy_hosts(ngx_slab_pool_t *shpool,
+    ngx_http_upstream_rr_peers_t *peers);
+
+
+static ngx_command_t  ngx_http_upstream_zone_commands[] = {
+
+    { ngx_string("zone"),
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE12,
+      ngx_http_upstream_zone,
+      0,
+      0,
+      NULL },
+
+      ngx_null_command
+};
+
+
+static ngx_http_module_t  ngx_http_upstream_zone_module_ctx = {
+    NULL,                                  /* preconfiguration */
+    NULL,                                  /* postconfiguration */
+
+    NULL,                                  /* create main configuration */
+    NULL,                                  /* init main configuration */
+
+    NULL,                                  /* create server configuration */
+    NULL,                                  /* merge server configuration */
+
+    NULL,                                  /* create location configuration */
+    NULL                                   /* merge location configuration */
+};
+
+
+ngx_module_t  ngx_http_upstream_zone_module = {
+    NGX_MODULE_V1,
+    &ngx_http_upstream_zone_module_ctx,    /* module context */
+    ngx_http_upstream_zone_commands,       /* module directives */
+    NGX_HTTP_MODULE,                       /* module type */
+    NULL,                                  /* init master */
+    NULL,                                  /* init module */
+    NULL,                                  /* init process */
+    NULL,                                  /* init thread */
+    NULL,                                  /* exit thread */
+    NULL,                                  /* exit process */
+    NULL,                                  /* exit master */
+    NGX_MODULE_V1_PADDING
+};
+
+
+static char *
+ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ssize_t                         size;
+    ngx_str_t                      *value;
+    ngx_http_upstream_srv_conf_t   *uscf;
+    ngx_http_upstream_main_conf_t  *umcf;
+
+    uscf = ngx_http_conf_get_module_srv_conf(cf, ngx_http_upstream_module);
+    umcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_upstream_module);
+
+    if (uscf->shm_zone) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (!value[1].len) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid zone name \"%V\"", &value[1]);
+        return NGX_CONF_ERROR;
+    }
+
+    if (cf->args->nelts == 3) {
+        size = ngx_parse_size(&value[2]);
+
+        if (size == NGX_ERROR) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid zone size \"%V\"", &value[2]);
+            return NGX_CONF_ERROR;
+        }
+
+        if (size < (ssize_t) (8 * ngx_pagesize)) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "zone \"%V\" is too small", &value[1]);
+            return NGX_CONF_ERROR;
+        }
+
+    } else {
+        size = 0;
+    }
+
+    uscf->shm_zone = ngx_shared_memory_add(cf, &value[1], size,
+                                           &ngx_http_upstream_module);
+    if (uscf->shm_zone == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    uscf->shm_zone->init = ngx_http_upstream_init_zone;
+    uscf->shm_zone->data = umcf;
+
+    /*
+     * peers are copied from the new configuration on every reload,
+     * the old zone is kept by the old worker processes until they exit
+     */
+
+    uscf->shm_zone->noreuse = 1;
+
+    return NGX_CONF_OK;
+}
+
+
+static ngx_int_t
+ngx_http_upstream_init_zone(ngx_shm_zone_t *shm_zone, void *data)
+{
+    size_t                          len;
+    ngx_uint_t                      i;
+    ngx_slab_pool_t                *shpool;
+    ngx_http_upstream_rr_peers_t   *peers, **peersp;
+    ngx_http_upstream_srv_conf_t   *uscf, **uscfp;
+    ngx_http_upstream_main_conf_t  *umcf;
+
+    shpool = (ngx_slab_pool_t *) shm_zone->shm.addr;
+    umcf = shm_zone->data;
+    uscfp = umcf->upstreams.elts;
+
+    if (shm_zone->shm.exists) {
+        peers = shpool->data;
+
+        for (i = 0; i < umcf->upstreams.nelts; i++) {
+            uscf = uscfp[i];
+
+            if (uscf->shm_zone != shm_zone) {
+                continue;
+            }
+
+            uscf->peer.data = peers;
+            peers = peers->zone_next;
+        }
+
+        return NGX_OK;
+    }
+
+    len = sizeof(" in upstream zone \"\"") + shm_zone->shm.name.len;
+
+    shpool->log_ctx = ngx_slab_alloc(shpool, len);
+    if (shpool->log_ctx == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_sprintf(shpool->log_ctx, " in upstream zone \"%V\"%Z",
+                &shm_zone->shm.name);
+
+
+    /* copy peers to shared memory */
+
+    peersp = (ngx_http_upstream_rr_peers_t **) (void *) &shpool->data;
+
+    for (i = 0; i < umcf->upstreams.nelts; i++) {
+        uscf = uscfp[i];
+
+        if (uscf->shm_zone != shm_zone) {
+            continue;
+        }
+
+        if (uscf->peer.data == NULL) {
+            ngx_log_error(NGX_LOG_EMERG, shm_zone->shm.log, 0,
+                          "upstream \"%V\" in %s:%ui has no peers to "
+                          "place in zone \"%V\"",
+                          &uscf->host, uscf->file_name, uscf->line,
+                          &shm_zone->shm.name);
+            return NGX_ERROR;
+        }
+
+        peers = ngx_http_upstream_zone_copy_peers(shpool, uscf->peer.data);
+        if (peers == NULL) {
+            ngx_log_error(NGX_LOG_EMERG, shm_zone->shm.log, 0,
+                          "upstream zone \"%V\" is too small for "
+                          "upstream \"%V\"",
+                          &shm_zone->shm.name, &uscf->host);
+            return NGX_ERROR;
+        }
+
+        uscf->peer.data = peers;
+
+        *peersp = peers;
+        peersp = &peers->zone_next;
+    }
+
+    return NGX_OK;
+}
+
+
+/*
+ * the peers are copied as is: addresses and names stay in the configuration
+ * pool, which is inherited by all worker processes at the same address;
+ * only the addresses of resolvable servers, which are updated at run time,
+ * are moved to the zone
+ */
+
+static ngx_http_upstream_rr_peers_t *
+ngx_http_upstream_zone_copy_peers(ngx_slab_pool_t *shpool,
+    ngx_http_upstream_rr_peers_t *src)
+{
+    size_t                         size;
+    ngx_http_upstream_rr_peers_t  *peers, *backup;
+
+    size = ngx_http_upstream_rr_peers_size(src->number);
+
+    peers = ngx_slab_alloc(shpool, size);
+    if (peers == NULL) {
+        return NULL;
+    }
+
+    ngx_memcpy(peers, src, size);
+
+    peers->shpool = shpool;
+    peers->rwlock = 0;
+    peers->zone_next = NULL;
+
+    if (ngx_http_upstream_zone_copy_hosts(shpool, peers) != NGX_OK) {
+        return NULL;
+    }
+
+    if (src->next == NULL) {
+        return peers;
+    }
+
+    size = ngx_http_upstream_rr_peers_size(src->next->number);
+
+    backup = ngx_slab_alloc(shpool, size);
+    if (backup == NULL) {
+        return NULL;
+    }
+
+    ngx_memcpy(backup, src->next, size);
+
+    backup->shpool = shpool;
+    backup->rwlock = 0;
+    backup->zone_next = NULL;
+
+    if (ngx_http_upstream_zone_copy_hosts(shpool, backup) != NGX_OK) {
+        return NULL;
+    }
+
+    peers->next = backup;
+
+    return peers;
+}
+
+
+static ngx_int_t
+ngx_http_upstream_zone_copy_hosts(ngx_slab_pool_t *shpool,
+    ngx_http_upstream_rr_peers_t *peers)
+{
+    u_char                       *p;
+    ngx_uint_t                    i;
+    ngx_http_upstream_rr_peer_t  *peer;
+
+    if (peers->nhosts == 0) {
+        return NGX_OK;
+    }
+
+    for (i = 0; i < peers->number; i++) {
+        peer = &peers->peer[i];
+
+        if (peer->host == NULL) {
+            continue;
+        }
+
+        p = ngx_slab_alloc(shpool, NGX_SOCKADDRLEN + NGX_SOCKADDR_STRLEN);
+        if (p == NULL) {
+            return NGX_ERROR;
+        }
+
+        ngx_memcpy(p, peer->sockaddr, NGX_SOCKADDRLEN);
+        ngx_memcpy(p + NGX_SOCKADDRLEN, peer->name.data, peer->name.len);
+
+        peer->sockaddr = (struct sockaddr *) p;
+        peer->name.data = p + NGX_SOCKADDRLEN;
+    }
+
+    return NGX_OK;
+}
@@ -35,6 +35,16 @@ static char *ngx_http_merge_locations(ngx_conf_t *cf,
     ngx_uint_t ctx_index);
 static ngx_int_t ngx_http_init_locations(ngx_conf_t *cf,
     ngx_http_core_srv_conf_t *cscf, ngx_http_core_loc_conf_t *pclcf);
+#if (NGX_PCRE)
+static ngx_int_t ngx_http_combine_regex_locations(ngx_conf_t *cf,
+    ngx_http_core_loc_conf_t *pclcf, ngx_uint_t n);
+static ngx_int_t ngx_http_add_regex_location_group(ngx_conf_t *cf,
+    ngx_array_t *groups, ngx_http_core_loc_conf_t **clcfp, ngx_uint_t n);
+static ngx_uint_t ngx_http_regex_location_anchored(
+    ngx_http_core_loc_conf_t *clcf);
+static ngx_uint_t ngx_http_regex_location_combinable(
+    ngx_http_core_loc_conf_t *clcf);
+#endif
 static ngx_int_t ngx_http_init_static_location_trees(ngx_conf_t *cf,
     ngx_http_core_loc_conf_t *pclcf);
 static ngx_int_t ngx_http_cmp_locations(const ngx_queue_t *one,
@@ -853,6 +863,12 @@ ngx_http_init_locations(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
         *clcfp = NULL;
 
         ngx_queue_split(locations, regex, &tail);
+
+        if (pclcf->combine_regex_locations
+            && ngx_http_combine_regex_locations(cf, pclcf, r) != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
     }
 
 #endif
@@ -861,6 +877,370 @@ ngx_http_init_locations(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 }
 
 
+#if (NGX_PCRE)
+
+/*
+ * Runs of combinable regex locations are compiled into a single regex
+ * of the form
+ *
+ *     \A(?:(?s:.*?)(?:re1)()|(?s:.*?)(?:re2)()|...)
+ *
+ * The anchored alternatives are tried in order, each one at all
+ * positions of the URI, so the first alternative that matches belongs
+ * to the first matching location in the configuration order.  The empty
+ * group after each alternative tells which one has matched.  Regexes
+ * starting with "^" are used without the "(?s:.*?)" prefix, so they are
+ * only tried at the start of the URI.
+ */
+
+static ngx_int_t
+ngx_http_combine_regex_locations(ngx_conf_t *cf,
+    ngx_http_core_loc_conf_t *pclcf, ngx_uint_t n)
+{
+    ngx_uint_t                  i, start;
+    ngx_array_t                 groups;
+    ngx_http_core_loc_conf_t  **clcfp;
+
+    if (ngx_array_init(&groups, cf->pool, 2,
+                       sizeof(ngx_http_regex_location_group_t))
+        != NGX_OK)
+    {
+        return NGX_ERROR;
+    }
+
+    clcfp = pclcf->regex_locations;
+    start = 0;
+
+    for (i = 0; i <= n; i++) {
+
+        if (i < n && ngx_http_regex_location_combinable(clcfp[i])) {
+            continue;
+        }
+
+        if (ngx_http_add_regex_location_group(cf, &groups, &clcfp[start],
+                                              i - start)
+            != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
+
+        if (i < n
+            && ngx_http_add_regex_location_group(cf, &groups, &clcfp[i], 1)
+               != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
+
+        start = i + 1;
+    }
+
+    pclcf->regex_groups = groups.elts;
+    pclcf->nregex_groups = groups.nelts;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_add_regex_location_group(ngx_conf_t *cf, ngx_array_t *groups,
+    ngx_http_core_loc_conf_t **clcfp, ngx_uint_t n)
+{
+    u_char                           *p;
+    size_t                            len;
+    ngx_uint_t                        i, mark;
+    ngx_regex_compile_t               rc;
+    ngx_http_regex_location_group_t  *g;
+    u_char                            errstr[NGX_MAX_CONF_ERRSTR];
+
+    if (n == 0) {
+        return NGX_OK;
+    }
+
+    g = ngx_array_push(groups);
+    if (g == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_memzero(g, sizeof(ngx_http_regex_location_group_t));
+
+    g->locations = clcfp;
+    g->nlocations = n;
+
+    if (n == 1) {
+        return NGX_OK;
+    }
+
+    len = sizeof("(?J)\\A(?:)");
+
+    for (i = 0; i < n; i++) {
+        len += sizeof("(?s:.*?)(?i:)()|") - 1 + clcfp[i]->name.len;
+    }
+
+    /* the pattern is kept for the cycle lifetime as the regex name */
+
+    p = ngx_pnalloc(cf->pool, len);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_memzero(&rc, sizeof(ngx_regex_compile_t));
+
+    rc.pattern.data = p;
+
+    /* named captures may be repeated in different locations */
+
+    p = ngx_cpymem(p, "(?J)\\A(?:", sizeof("(?J)\\A(?:") - 1);
+
+    for (i = 0; i < n; i++) {
+
+        if (i) {
+            *p++ = '|';
+        }
+
+        if (!ngx_http_regex_location_anchored(clcfp[i])) {
+            p = ngx_cpymem(p, "(?s:.*?)", sizeof("(?s:.*?)") - 1);
+        }
+
+        if (clcfp[i]->regex_caseless) {
+            p = ngx_cpymem(p, "(?i:", sizeof("(?i:") - 1);
+
+        } else {
+            p = ngx_cpymem(p, "(?:", sizeof("(?:") - 1);
+        }
+
+        p = ngx_cpymem(p, clcfp[i]->name.data, clcfp[i]->name.len);
+        p = ngx_cpymem(p, ")()", sizeof(")()") - 1);
+    }
+
+    *p++ = ')';
+    *p = '\0';
+
+    rc.pattern.len = p - rc.pattern.data;
+    rc.pool = cf->pool;
+    rc.err.len = NGX_MAX_CONF_ERRSTR;
+    rc.err.data = errstr;
+
+    if (ngx_regex_compile(&rc) != NGX_OK) {
+        ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                           "%ui regex locations starting with \"%V\" "
+                           "are not combined: %V",
+                           n, &clcfp[0]->name, &rc.err);
+        return NGX_OK;
+    }
+
+    g->marks = ngx_palloc(cf->pool, n * sizeof(ngx_uint_t));
+    if (g->marks == NULL) {
+        return NGX_ERROR;
+    }
+
+    mark = 0;
+
+    for (i = 0; i < n; i++) {
+        mark += clcfp[i]->regex->ncaptures + 1;
+        g->marks[i] = mark;
+    }
+
+    g->ncaptures = (rc.captures + 1) * 3;
+
+    g->captures = ngx_palloc(cf->pool, g->ncaptures * sizeof(int));
+    if (g->captures == NULL) {
+        return NGX_ERROR;
+    }
+
+    g->regex = rc.regex;
+
+    return NGX_OK;
+}
+
+
+/*
+ * A regex is anchored if it starts with "^" and has no alternatives
+ * outside of groups and character classes.
+ */
+
+static ngx_uint_t
+ngx_http_regex_location_anchored(ngx_http_core_loc_conf_t *clcf)
+{
+    u_char      *p, *last;
+    ngx_uint_t   depth;
+
+    p = clcf->name.data;
+    last = p + clcf->name.len;
+
+    if (p == last || *p != '^') {
+        return 0;
+    }
+
+    depth = 0;
+
+    for (p++; p < last; p++) {
+
+        switch (*p) {
+
+        case '\\':
+            p++;
+            break;
+
+        case '[':
+
+            /* "]" right after "[" or "[^" is a literal one */
+
+            p++;
+
+            if (p < last && *p == '^') {
+                p++;
+            }
+
+            if (p < last && *p == ']') {
+                p++;
+            }
+
+            while (p < last && *p != ']') {
+                if (*p == '\\') {
+                    p++;
+                }
+
+                p++;
+            }
+
+            break;
+
+        case '(':
+
+            /* comments may contain any characters but ")" */
+
+            if (last - p > 2 && p[1] == '?' && p[2] == '#') {
+                while (p < last && *p != ')') {
+                    p++;
+                }
+
+                break;
+            }
+
+            depth++;
+            break;
+
+        case ')':
+            depth--;
+            break;
+
+        case '|':
+            if (depth == 0) {
+                return 0;
+            }
+
+            break;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+ * Back references, subroutine calls and conditions on group numbers
+ * use absolute group numbers, while "\Q" and comments in the extended
+ * mode may swallow the rest of the combined regex, so such regexes are
+ * tested alone.
+ */
+
+static ngx_uint_t
+ngx_http_regex_location_combinable(ngx_http_core_loc_conf_t *clcf)
+{
+    u_char  *p, *last;
+
+    p = clcf->name.data;
+    last = p + clcf->name.len;
+
+    for ( /* void */ ; p < last; p++) {
+
+        if (*p == '\\') {
+
+            if (++p == last) {
+                return 0;
+            }
+
+            if (*p == 'Q' || *p == 'g' || *p == 'k'
+                || (*p >= '1' && *p <= '9'))
+            {
+                return 0;
+            }
+
+            continue;
+        }
+
+        if (*p != '(' || last - p < 3) {
+            continue;
+        }
+
+        p++;
+
+        if (*p == '*') {
+            return 0;
+        }
+
+        if (*p != '?') {
+            continue;
+        }
+
+        p++;
+
+        switch (*p) {
+
+        case 'R':
+        case '&':
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            return 0;
+
+        case 'P':
+            if (last - p > 1 && (p[1] == '>' || p[1] == '=')) {
+                return 0;
+            }
+
+            continue;
+
+        case '+':
+        case '-':
+            if (last - p > 1 && p[1] >= '0' && p[1] <= '9') {
+                return 0;
+            }
+
+            break;
+
+        case '(':
+            if (last - p > 1
+                && ((p[1] >= '0' && p[1] <= '9')
+                    || p[1] == '+' || p[1] == '-' || p[1] == 'R'))
+            {
+                return 0;
+            }
+
+            break;
+        }
+
+        /* option letters */
+
+        while (p < last
+               && ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z')
+                   || *p == '-'))
+        {
+            if (*p == 'x') {
+                return 0;
+            }
+
+            p++;
+        }
+
+        p--;
+    }
+
+    return 1;
+}
+
+#endif
+
+
 static ngx_int_t
 ngx_http_init_static_location_trees(ngx_conf_t *cf,
     ngx_http_core_loc_conf_t *pclcf)
@@ -1297,6 +1677,9 @@ ngx_http_add_addresses(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 #if (NGX_HTTP_SPDY)
     ngx_uint_t             spdy;
 #endif
+#if (NGX_HTTP_V2)
+    ngx_uint_t             http2;
+#endif
 
     /*
      * we cannot compare whole sockaddr struct's as kernel
@@ -1352,6 +1735,9 @@ ngx_http_add_addresses(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 #if (NGX_HTTP_SPDY)
         spdy = lsopt->spdy || addr[i].opt.spdy;
 #endif
+#if (NGX_HTTP_V2)
+        http2 = lsopt->http2 || addr[i].opt.http2;
+#endif
 
         if (lsopt->set) {
 
@@ -1385,6 +1771,9 @@ ngx_http_add_addresses(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 #if (NGX_HTTP_SPDY)
         addr[i].opt.spdy = spdy;
 #endif
+#if (NGX_HTTP_V2)
+        addr[i].opt.http2 = http2;
+#endif
 
         return NGX_OK;
     }
@@ -1425,6 +1814,15 @@ ngx_http_add_address(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
     }
 #endif
 
+#if (NGX_HTTP_V2 && NGX_HTTP_SSL                                              \
+     && !defined TLSEXT_TYPE_application_layer_protocol_negotiation)
+    if (lsopt->http2 && lsopt->ssl) {
+        ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                           "nginx was built without OpenSSL ALPN support, "
+                           "HTTP/2 is not enabled for %s", lsopt->addr);
+    }
+#endif
+
     addr = ngx_array_push(&port->addrs);
     if (addr == NULL) {
         return NGX_ERROR;
@@ -1805,6 +2203,10 @@ ngx_http_init_listening(ngx_conf_t *cf, ngx_http_conf_port_t *port)
             break;
         }
 
+        if (ngx_clone_listening(cf, ls) != NGX_OK) {
+            return NGX_ERROR;
+        }
+
         addr++;
         last--;
     }
@@ -1883,6 +2285,10 @@ ngx_http_add_listening(ngx_conf_t *cf, ngx_http_conf_addr_t *addr)
     ls->fastopen = addr->opt.fastopen;
 #endif
 
+#if (NGX_HAVE_REUSEPORT)
+    ls->reuseport = addr->opt.reuseport;
+#endif
+
     return ls;
 }
 
@@ -1914,6 +2320,9 @@ ngx_http_add_addrs(ngx_conf_t *cf, ngx_http_port_t *hport,
 #endif
 #if (NGX_HTTP_SPDY)
         addrs[i].conf.spdy = addr[i].opt.spdy;
+#endif
+#if (NGX_HTTP_V2)
+        addrs[i].conf.http2 = addr[i].opt.http2;
 #endif
         addrs[i].conf.proxy_protocol = addr[i].opt.proxy_protocol;
 
@@ -1980,6 +2389,9 @@ ngx_http_add_addrs6(ngx_conf_t *cf, ngx_http_port_t *hport,
 #if (NGX_HTTP_SPDY)
         addrs6[i].conf.spdy = addr[i].opt.spdy;
 #endif
+#if (NGX_HTTP_V2)
+        addrs6[i].conf.http2 = addr[i].opt.http2;
+#endif
 
         if (addr[i].hash.buckets == NULL
             && (addr[i].wc_head == NULL
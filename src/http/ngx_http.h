@@ -19,10 +19,14 @@ typedef struct ngx_http_cache_s       ngx_http_cache_t;
 typedef struct ngx_http_file_cache_s  ngx_http_file_cache_t;
 typedef struct ngx_http_log_ctx_s     ngx_http_log_ctx_t;
 typedef struct ngx_http_chunked_s     ngx_http_chunked_t;
+typedef struct ngx_http_spill_s       ngx_http_spill_t;
 
 #if (NGX_HTTP_SPDY)
 typedef struct ngx_http_spdy_stream_s  ngx_http_spdy_stream_t;
 #endif
+#if (NGX_HTTP_V2)
+typedef struct ngx_http_v2_stream_s    ngx_http_v2_stream_t;
+#endif
 
 typedef ngx_int_t (*ngx_http_header_handler_pt)(ngx_http_request_t *r,
     ngx_table_elt_t *h, ngx_uint_t offset);
@@ -36,11 +40,15 @@ typedef u_char *(*ngx_http_log_handler_pt)(ngx_http_request_t *r,
 #include <ngx_http_script.h>
 #include <ngx_http_upstream.h>
 #include <ngx_http_upstream_round_robin.h>
+#include <ngx_http_spill.h>
 #include <ngx_http_core_module.h>
 
 #if (NGX_HTTP_SPDY)
 #include <ngx_http_spdy.h>
 #endif
+#if (NGX_HTTP_V2)
+#include <ngx_http_v2.h>
+#endif
 #if (NGX_HTTP_CACHE)
 #include <ngx_http_cache.h>
 #endif
@@ -27,7 +27,9 @@
 #define NGX_HTTP_CACHE_ETAG_LEN      42
 #define NGX_HTTP_CACHE_VARY_LEN      42
 
-#define NGX_HTTP_CACHE_VERSION       3
+#define NGX_HTTP_CACHE_VERSION       4
+
+#define NGX_HTTP_CACHE_TIERS         4
 
 
 typedef struct {
@@ -50,7 +52,8 @@ typedef struct {
     unsigned                         exists:1;
     unsigned                         updating:1;
     unsigned                         deleting:1;
-                                     /* 11 unused bits */
+    unsigned                         tier:2;
+                                     /* 9 unused bits */
 
     ngx_file_uniq_t                  uniq;
     time_t                           expire;
@@ -70,6 +73,8 @@ struct ngx_http_cache_s {
 
     ngx_file_uniq_t                  uniq;
     time_t                           valid_sec;
+    time_t                           updating_sec;
+    time_t                           error_sec;
     time_t                           last_modified;
     time_t                           date;
 
@@ -111,12 +116,20 @@ struct ngx_http_cache_s {
     unsigned                         temp_file:1;
     unsigned                         reading:1;
     unsigned                         secondary:1;
+    unsigned                         background:1;
+
+    unsigned                         stale_updating:1;
+    unsigned                         stale_error:1;
+
+    unsigned                         tier:2;
 };
 
 
 typedef struct {
     ngx_uint_t                       version;
     time_t                           valid_sec;
+    time_t                           updating_sec;
+    time_t                           error_sec;
     time_t                           last_modified;
     time_t                           date;
     uint32_t                         crc32;
@@ -131,13 +144,53 @@ typedef struct {
 } ngx_http_file_cache_header_t;
 
 
+/*
+ * 通配符清除记录: 缓存时间不晚于 date 且键以 key 为前缀的条目视为已清除,
+ * 缓存管理进程分批遍历完索引并删除这些文件后记录被移除,
+ * walk 标记本轮遍历开始前已有的记录
+ */
+
+typedef struct {
+    ngx_queue_t                      queue;
+    time_t                           date;
+    ngx_uint_t                       walk;      /* unsigned  walk:1; */
+    size_t                           len;
+    u_char                           key[1];
+} ngx_http_file_cache_purge_t;
+
+
+/*
+ * 缓存分层: 主路径是最冷的一层, 其余各层依次更热, 各有自己的目录、
+ * 大小上限和提升所需的最少使用次数, 文件由缓存管理进程在层之间迁移
+ */
+
+typedef struct {
+    ngx_path_t                      *path;
+    off_t                            max_size;
+    ngx_uint_t                       min_uses;
+} ngx_http_file_cache_tier_t;
+
+
+typedef struct {
+    off_t                            size;
+    ngx_atomic_t                     hits;
+    ngx_atomic_t                     promoted;
+    ngx_atomic_t                     demoted;
+} ngx_http_file_cache_tier_sh_t;
+
+
 typedef struct {
     ngx_rbtree_t                     rbtree;
     ngx_rbtree_node_t                sentinel;
     ngx_queue_t                      queue;
+    ngx_queue_t                      purges;
+    ngx_uint_t                       purge_walk;
+    ngx_uint_t                       purge_resume;
+    u_char                           purge_cursor[NGX_HTTP_CACHE_KEY_LEN];
     ngx_atomic_t                     cold;
     ngx_atomic_t                     loading;
     off_t                            size;
+    ngx_http_file_cache_tier_sh_t    tiers[NGX_HTTP_CACHE_TIERS];
 } ngx_http_file_cache_sh_t;
 
 
@@ -159,6 +212,16 @@ struct ngx_http_file_cache_s {
     ngx_msec_t                       loader_sleep;
     ngx_msec_t                       loader_threshold;
 
+    ngx_str_t                        index;
+    time_t                           index_interval;
+    time_t                           index_next;
+    time_t                           index_date;
+
+    ngx_http_file_cache_tier_t       tiers[NGX_HTTP_CACHE_TIERS];
+    ngx_uint_t                       ntiers;
+    ngx_uint_t                       loader_tier;
+    size_t                           name_len;
+
     ngx_shm_zone_t                  *shm_zone;
 };
 
@@ -168,10 +231,12 @@ ngx_int_t ngx_http_file_cache_create(ngx_http_request_t *r);
 void ngx_http_file_cache_create_key(ngx_http_request_t *r);
 ngx_int_t ngx_http_file_cache_open(ngx_http_request_t *r);
 ngx_int_t ngx_http_file_cache_set_header(ngx_http_request_t *r, u_char *buf);
-void ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf);
+ngx_int_t ngx_http_file_cache_update(ngx_http_request_t *r,
+    ngx_temp_file_t *tf);
 void ngx_http_file_cache_update_header(ngx_http_request_t *r);
 ngx_int_t ngx_http_cache_send(ngx_http_request_t *);
 void ngx_http_file_cache_free(ngx_http_cache_t *c, ngx_temp_file_t *tf);
+ngx_int_t ngx_http_file_cache_purge(ngx_http_request_t *r);
 time_t ngx_http_file_cache_valid(ngx_array_t *cache_valid, ngx_uint_t status);
 
 char *ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd,
@@ -24,6 +24,12 @@ typedef struct {
 static ngx_int_t ngx_http_core_find_location(ngx_http_request_t *r);
 static ngx_int_t ngx_http_core_find_static_location(ngx_http_request_t *r,
     ngx_http_location_tree_node_t *node);
+#if (NGX_PCRE)
+static ngx_int_t ngx_http_core_find_regex_location(ngx_http_request_t *r,
+    ngx_http_core_loc_conf_t *pclcf);
+static ngx_int_t ngx_http_core_test_regex_locations(ngx_http_request_t *r,
+    ngx_http_core_loc_conf_t **clcfp, ngx_uint_t n);
+#endif
 
 static ngx_int_t ngx_http_core_preconfiguration(ngx_conf_t *cf);
 static ngx_int_t ngx_http_core_postconfiguration(ngx_conf_t *cf);
@@ -74,7 +80,9 @@ static char *ngx_http_core_internal(ngx_conf_t *cf, ngx_command_t *cmd,
 static char *ngx_http_core_resolver(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
 #if (NGX_HTTP_GZIP)
-static ngx_int_t ngx_http_gzip_accept_encoding(ngx_str_t *ae);
+static ngx_int_t ngx_http_gzip_test(ngx_http_request_t *r);
+static ngx_int_t ngx_http_gzip_accept_encoding(ngx_str_t *ae, char *name,
+    size_t len);
 static ngx_uint_t ngx_http_gzip_quantity(u_char *p, u_char *last);
 static char *ngx_http_gzip_disable(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
@@ -383,6 +391,13 @@ static ngx_command_t  ngx_http_core_commands[] = {
       offsetof(ngx_http_core_loc_conf_t, client_body_temp_path),
       NULL },
 
+    { ngx_string("client_body_spill_store"),
+      NGX_HTTP_MAIN_CONF|NGX_CONF_1MORE,
+      ngx_http_spill_store_set_slot,
+      NGX_HTTP_MAIN_CONF_OFFSET,
+      offsetof(ngx_http_core_main_conf_t, spill_store),
+      NULL },
+
     { ngx_string("client_body_in_file_only"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
       ngx_conf_set_enum_slot,
@@ -419,6 +434,20 @@ static ngx_command_t  ngx_http_core_commands[] = {
       0,
       NULL },
 
+    { ngx_string("aio_write"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, aio_write),
+      NULL },
+
+    { ngx_string("aio_open"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, aio_open),
+      NULL },
+
     { ngx_string("read_ahead"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
       ngx_conf_set_size_slot,
@@ -645,6 +674,13 @@ static ngx_command_t  ngx_http_core_commands[] = {
       offsetof(ngx_http_core_loc_conf_t, etag),
       NULL },
 
+    { ngx_string("combine_regex_locations"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, combine_regex_locations),
+      NULL },
+
     { ngx_string("error_page"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_HTTP_LIF_CONF
                         |NGX_CONF_2MORE,
@@ -799,8 +835,8 @@ ngx_module_t  ngx_http_core_module = {
     ngx_http_core_commands,                /* module directives */
     NGX_HTTP_MODULE,                       /* module type */
     NULL,                                  /* init master */
-    NULL,                                  /* init module */
-    NULL,                                  /* init process */
+    ngx_http_spill_init_module,            /* init module */
+    ngx_http_spill_init_process,           /* init process */
     NULL,                                  /* init thread */
     NULL,                                  /* exit thread */
     NULL,                                  /* exit process */
@@ -851,6 +887,10 @@ ngx_http_handler(ngx_http_request_t *r)
     r->gzip_ok = 0;
     r->gzip_vary = 0;
 #endif
+#if (NGX_HTTP_BROTLI)
+    r->brotli_tested = 0;
+    r->brotli_ok = 0;
+#endif
 
     r->write_event_handler = ngx_http_core_run_phases;
     ngx_http_core_run_phases(r);
@@ -1530,7 +1570,7 @@ ngx_http_core_find_location(ngx_http_request_t *r)
 #if (NGX_PCRE)
     ngx_int_t                  n;
     ngx_uint_t                 noregex;
-    ngx_http_core_loc_conf_t  *clcf, **clcfp;
+    ngx_http_core_loc_conf_t  *clcf;
 
     noregex = 0;
 #endif
@@ -1562,35 +1602,146 @@ ngx_http_core_find_location(ngx_http_request_t *r)
 
     if (noregex == 0 && pclcf->regex_locations) {
 
-        for (clcfp = pclcf->regex_locations; *clcfp; clcfp++) {
+        n = ngx_http_core_find_regex_location(r, pclcf);
 
-            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
-                           "test location: ~ \"%V\"", &(*clcfp)->name);
+        if (n == NGX_OK) {
 
-            n = ngx_http_regex_exec(r, (*clcfp)->regex, &r->uri);
+            /* look up nested locations */
 
-            if (n == NGX_OK) {
-                r->loc_conf = (*clcfp)->loc_conf;
+            rc = ngx_http_core_find_location(r);
 
-                /* look up nested locations */
+            return (rc == NGX_ERROR) ? rc : NGX_OK;
+        }
+
+        if (n == NGX_ERROR) {
+            return NGX_ERROR;
+        }
+    }
+#endif
+
+    return rc;
+}
 
-                rc = ngx_http_core_find_location(r);
 
-                return (rc == NGX_ERROR) ? rc : NGX_OK;
+#if (NGX_PCRE)
+
+/*
+ * NGX_OK       - match, r->loc_conf is set
+ * NGX_DECLINED - no match
+ * NGX_ERROR    - error
+ */
+
+static ngx_int_t
+ngx_http_core_find_regex_location(ngx_http_request_t *r,
+    ngx_http_core_loc_conf_t *pclcf)
+{
+    ngx_int_t                         n;
+    ngx_uint_t                        i, k;
+    ngx_http_regex_location_group_t  *g;
+
+    if (pclcf->regex_groups == NULL) {
+        return ngx_http_core_test_regex_locations(r, pclcf->regex_locations,
+                                                  NGX_MAX_UINT32_VALUE);
+    }
+
+    for (i = 0; i < pclcf->nregex_groups; i++) {
+
+        g = &pclcf->regex_groups[i];
+
+        if (g->regex == NULL) {
+            n = ngx_http_core_test_regex_locations(r, g->locations,
+                                                   g->nlocations);
+            if (n != NGX_DECLINED) {
+                return n;
             }
 
-            if (n == NGX_DECLINED) {
-                continue;
+            continue;
+        }
+
+        ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                       "test %ui combined locations: ~ \"%V\"",
+                       g->nlocations, &g->locations[0]->name);
+
+        n = ngx_regex_exec(g->regex, &r->uri, g->captures, g->ncaptures);
+
+        if (n == NGX_REGEX_NO_MATCHED) {
+            continue;
+        }
+
+        if (n < 0) {
+
+            /*
+             * the combined pattern may hit the match limit or exhaust
+             * the JIT stack where the separate ones do not, so the group
+             * is tested location by location instead
+             */
+
+            ngx_log_error(NGX_LOG_ERR, r->connection->log, 0,
+                          ngx_regex_exec_n " failed: %i on \"%V\" using "
+                          "combined locations starting with \"%V\", "
+                          "testing them separately",
+                          n, &r->uri, &g->locations[0]->name);
+
+            n = ngx_http_core_test_regex_locations(r, g->locations,
+                                                   g->nlocations);
+            if (n != NGX_DECLINED) {
+                return n;
             }
 
+            continue;
+        }
+
+        for (k = 0; k < g->nlocations; k++) {
+            if (g->captures[2 * g->marks[k]] != -1) {
+                break;
+            }
+        }
+
+        if (k == g->nlocations) {
+            k = 0;
+        }
+
+        /* the matched location's own regex sets the captures */
+
+        n = ngx_http_core_test_regex_locations(r, &g->locations[k],
+                                               g->nlocations - k);
+        if (n != NGX_DECLINED) {
+            return n;
+        }
+    }
+
+    return NGX_DECLINED;
+}
+
+
+static ngx_int_t
+ngx_http_core_test_regex_locations(ngx_http_request_t *r,
+    ngx_http_core_loc_conf_t **clcfp, ngx_uint_t n)
+{
+    ngx_int_t  rc;
+
+    for ( /* void */ ; n && *clcfp; clcfp++, n--) {
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                       "test location: ~ \"%V\"", &(*clcfp)->name);
+
+        rc = ngx_http_regex_exec(r, (*clcfp)->regex, &r->uri);
+
+        if (rc == NGX_OK) {
+            r->loc_conf = (*clcfp)->loc_conf;
+            return NGX_OK;
+        }
+
+        if (rc != NGX_DECLINED) {
             return NGX_ERROR;
         }
     }
-#endif
 
-    return rc;
+    return NGX_DECLINED;
 }
 
+#endif
+
 
 /*
  * NGX_OK       - exact match
@@ -2149,11 +2300,7 @@ ngx_http_auth_basic_user(ngx_http_request_t *r)
 ngx_int_t
 ngx_http_gzip_ok(ngx_http_request_t *r)
 {
-    time_t                     date, expires;
-    ngx_uint_t                 p;
-    ngx_array_t               *cc;
-    ngx_table_elt_t           *e, *d, *ae;
-    ngx_http_core_loc_conf_t  *clcf;
+    ngx_table_elt_t  *ae;
 
     r->gzip_tested = 1;
 
@@ -2187,11 +2334,73 @@ ngx_http_gzip_ok(ngx_http_request_t *r)
      */
 
     if (ngx_memcmp(ae->value.data, "gzip,", 5) != 0
-        && ngx_http_gzip_accept_encoding(&ae->value) != NGX_OK)
+        && ngx_http_gzip_accept_encoding(&ae->value, "gzip", 4) != NGX_OK)
     {
         return NGX_DECLINED;
     }
 
+    if (ngx_http_gzip_test(r) != NGX_OK) {
+        return NGX_DECLINED;
+    }
+
+    r->gzip_ok = 1;
+
+    return NGX_OK;
+}
+
+
+#if (NGX_HTTP_BROTLI)
+
+ngx_int_t
+ngx_http_brotli_ok(ngx_http_request_t *r)
+{
+    ngx_table_elt_t  *ae;
+
+    r->brotli_tested = 1;
+
+    if (r != r->main) {
+        return NGX_DECLINED;
+    }
+
+    ae = r->headers_in.accept_encoding;
+    if (ae == NULL) {
+        return NGX_DECLINED;
+    }
+
+    if (ae->value.len < sizeof("br") - 1) {
+        return NGX_DECLINED;
+    }
+
+    if (ngx_http_gzip_accept_encoding(&ae->value, "br", 2) != NGX_OK) {
+        return NGX_DECLINED;
+    }
+
+    if (ngx_http_gzip_test(r) != NGX_OK) {
+        return NGX_DECLINED;
+    }
+
+    r->brotli_ok = 1;
+
+    return NGX_OK;
+}
+
+#endif
+
+
+/*
+ * the checks common for all content codings:
+ * gzip_disable, gzip_http_version, and gzip_proxied
+ */
+
+static ngx_int_t
+ngx_http_gzip_test(ngx_http_request_t *r)
+{
+    time_t                     date, expires;
+    ngx_uint_t                 p;
+    ngx_array_t               *cc;
+    ngx_table_elt_t           *e, *d;
+    ngx_http_core_loc_conf_t  *clcf;
+
     clcf = ngx_http_get_module_loc_conf(r, ngx_http_core_module);
 
     if (r->headers_in.msie6 && clcf->gzip_disable_msie6) {
@@ -2308,8 +2517,6 @@ ok:
 
 #endif
 
-    r->gzip_ok = 1;
-
     return NGX_OK;
 }
 
@@ -2322,7 +2529,7 @@ ok:
  */
 
 static ngx_int_t
-ngx_http_gzip_accept_encoding(ngx_str_t *ae)
+ngx_http_gzip_accept_encoding(ngx_str_t *ae, char *name, size_t len)
 {
     u_char  *p, *start, *last;
 
@@ -2330,7 +2537,7 @@ ngx_http_gzip_accept_encoding(ngx_str_t *ae)
     last = start + ae->len;
 
     for ( ;; ) {
-        p = ngx_strcasestrn(start, "gzip", 4 - 1);
+        p = ngx_strcasestrn(start, name, len - 1);
         if (p == NULL) {
             return NGX_DECLINED;
         }
@@ -2339,10 +2546,10 @@ ngx_http_gzip_accept_encoding(ngx_str_t *ae)
             break;
         }
 
-        start = p + 4;
+        start = p + len;
     }
 
-    p += 4;
+    p += len;
 
     while (p < last) {
         switch (*p++) {
@@ -2505,6 +2712,9 @@ ngx_http_subrequest(ngx_http_request_t *r,
 #if (NGX_HTTP_SPDY)
     sr->spdy_stream = r->spdy_stream;
 #endif
+#if (NGX_HTTP_V2)
+    sr->stream = r->stream;
+#endif
 
     sr->method = NGX_HTTP_GET;
     sr->http_version = r->http_version;
@@ -2521,6 +2731,7 @@ ngx_http_subrequest(ngx_http_request_t *r,
 
     sr->subrequest_in_memory = (flags & NGX_HTTP_SUBREQUEST_IN_MEMORY) != 0;
     sr->waited = (flags & NGX_HTTP_SUBREQUEST_WAITED) != 0;
+    sr->background = (flags & NGX_HTTP_SUBREQUEST_BACKGROUND) != 0;
 
     sr->unparsed_uri = r->unparsed_uri;
     sr->method_name = ngx_http_core_get_method;
@@ -2534,29 +2745,46 @@ ngx_http_subrequest(ngx_http_request_t *r,
     sr->read_event_handler = ngx_http_request_empty_handler;
     sr->write_event_handler = ngx_http_handler;
 
-    if (c->data == r && r->postponed == NULL) {
-        c->data = sr;
+    if (flags & NGX_HTTP_SUBREQUEST_CLONE) {
+
+        /* the clone continues from the current phase of the parent */
+
+        sr->method = r->method;
+        sr->method_name = r->method_name;
+        sr->loc_conf = r->loc_conf;
+        sr->valid_location = r->valid_location;
+        sr->content_handler = r->content_handler;
+        sr->phase_handler = r->phase_handler;
+        sr->write_event_handler = ngx_http_core_run_phases;
+
+        ngx_http_update_location_config(sr);
     }
 
     sr->variables = r->variables;
 
     sr->log_handler = r->log_handler;
 
-    pr = ngx_palloc(r->pool, sizeof(ngx_http_postponed_request_t));
-    if (pr == NULL) {
-        return NGX_ERROR;
-    }
+    if (!sr->background) {
+        if (c->data == r && r->postponed == NULL) {
+            c->data = sr;
+        }
 
-    pr->request = sr;
-    pr->out = NULL;
-    pr->next = NULL;
+        pr = ngx_palloc(r->pool, sizeof(ngx_http_postponed_request_t));
+        if (pr == NULL) {
+            return NGX_ERROR;
+        }
 
-    if (r->postponed) {
-        for (p = r->postponed; p->next; p = p->next) { /* void */ }
-        p->next = pr;
+        pr->request = sr;
+        pr->out = NULL;
+        pr->next = NULL;
 
-    } else {
-        r->postponed = pr;
+        if (r->postponed) {
+            for (p = r->postponed; p->next; p = p->next) { /* void */ }
+            p->next = pr;
+
+        } else {
+            r->postponed = pr;
+        }
     }
 
     sr->internal = 1;
@@ -3307,6 +3535,7 @@ ngx_http_core_regex_location(ngx_conf_t *cf, ngx_http_core_loc_conf_t *clcf,
     }
 
     clcf->name = *regex;
+    clcf->regex_caseless = (rc.options & NGX_REGEX_CASELESS) ? 1 : 0;
 
     return NGX_OK;
 
@@ -3453,6 +3682,8 @@ ngx_http_core_create_main_conf(ngx_conf_t *cf)
     cmcf->variables_hash_max_size = NGX_CONF_UNSET_UINT;
     cmcf->variables_hash_bucket_size = NGX_CONF_UNSET_UINT;
 
+    cmcf->spill_store = NGX_CONF_UNSET_PTR;
+
     return cmcf;
 }
 
@@ -3481,6 +3712,8 @@ ngx_http_core_init_main_conf(ngx_conf_t *cf, void *conf)
         cmcf->ncaptures = (cmcf->ncaptures + 1) * 3;
     }
 
+    ngx_conf_init_ptr_value(cmcf->spill_store, NULL);
+
     return NGX_CONF_OK;
 }
 
@@ -3635,6 +3868,8 @@ ngx_http_core_create_loc_conf(ngx_conf_t *cf)
     clcf->sendfile = NGX_CONF_UNSET;
     clcf->sendfile_max_chunk = NGX_CONF_UNSET_SIZE;
     clcf->aio = NGX_CONF_UNSET;
+    clcf->aio_write = NGX_CONF_UNSET;
+    clcf->aio_open = NGX_CONF_UNSET;
 #if (NGX_THREADS)
     clcf->thread_pool = NGX_CONF_UNSET_PTR;
     clcf->thread_pool_value = NGX_CONF_UNSET_PTR;
@@ -3667,6 +3902,7 @@ ngx_http_core_create_loc_conf(ngx_conf_t *cf)
     clcf->server_tokens = NGX_CONF_UNSET;
     clcf->chunked_transfer_encoding = NGX_CONF_UNSET;
     clcf->etag = NGX_CONF_UNSET;
+    clcf->combine_regex_locations = NGX_CONF_UNSET;
     clcf->types_hash_max_size = NGX_CONF_UNSET_UINT;
     clcf->types_hash_bucket_size = NGX_CONF_UNSET_UINT;
 
@@ -3856,6 +4092,8 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
                               prev->sendfile_max_chunk, 0);
 #if (NGX_HAVE_FILE_AIO || NGX_THREADS)
     ngx_conf_merge_value(conf->aio, prev->aio, NGX_HTTP_AIO_OFF);
+    ngx_conf_merge_value(conf->aio_write, prev->aio_write, 0);
+    ngx_conf_merge_value(conf->aio_open, prev->aio_open, 0);
 #endif
 #if (NGX_THREADS)
     ngx_conf_merge_ptr_value(conf->thread_pool, prev->thread_pool, NULL);
@@ -3933,6 +4171,8 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
     ngx_conf_merge_value(conf->chunked_transfer_encoding,
                               prev->chunked_transfer_encoding, 1);
     ngx_conf_merge_value(conf->etag, prev->etag, 1);
+    ngx_conf_merge_value(conf->combine_regex_locations,
+                         prev->combine_regex_locations, 0);
 
     ngx_conf_merge_ptr_value(conf->open_file_cache,
                               prev->open_file_cache, NULL);
@@ -4200,6 +4440,19 @@ ngx_http_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 #endif
         }
 
+        if (ngx_strcmp(value[n].data, "reuseport") == 0) {
+#if (NGX_HAVE_REUSEPORT)
+            lsopt.reuseport = 1;
+            lsopt.set = 1;
+            lsopt.bind = 1;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "reuseport is not supported "
+                               "on this platform, ignored");
+#endif
+            continue;
+        }
+
         if (ngx_strcmp(value[n].data, "ssl") == 0) {
 #if (NGX_HTTP_SSL)
             lsopt.ssl = 1;
@@ -4224,6 +4477,18 @@ ngx_http_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 #endif
         }
 
+        if (ngx_strcmp(value[n].data, "http2") == 0) {
+#if (NGX_HTTP_V2)
+            lsopt.http2 = 1;
+            continue;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "the \"http2\" parameter requires "
+                               "ngx_http_v2_module");
+            return NGX_CONF_ERROR;
+#endif
+        }
+
         if (ngx_strncmp(value[n].data, "so_keepalive=", 13) == 0) {
 
             if (ngx_strcmp(&value[n].data[13], "on") == 0) {
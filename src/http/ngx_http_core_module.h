@@ -82,8 +82,14 @@ typedef struct {
 #if (NGX_HTTP_SPDY)
     unsigned                   spdy:1;
 #endif
+#if (NGX_HTTP_V2)
+    unsigned                   http2:1;
+#endif
 #if (NGX_HAVE_INET6 && defined IPV6_V6ONLY)
     unsigned                   ipv6only:1;
+#endif
+#if (NGX_HAVE_REUSEPORT)
+    unsigned                   reuseport:1;
 #endif
     unsigned                   so_keepalive:2;
     unsigned                   proxy_protocol:1;
@@ -182,6 +188,8 @@ typedef struct {
 
     ngx_uint_t                 try_files;       /* unsigned  try_files:1 */
 
+    ngx_http_spill_store_t    *spill_store;
+
     ngx_http_phase_t           phases[NGX_HTTP_LOG_PHASE + 1];
 } ngx_http_core_main_conf_t;
 
@@ -247,6 +255,9 @@ struct ngx_http_addr_conf_s {
 #endif
 #if (NGX_HTTP_SPDY)
     unsigned                   spdy:1;
+#endif
+#if (NGX_HTTP_V2)
+    unsigned                   http2:1;
 #endif
     unsigned                   proxy_protocol:1;
 };
@@ -324,6 +335,26 @@ typedef struct {
 } ngx_http_try_file_t;
 
 
+#if (NGX_PCRE)
+
+/*
+ * 合并的正则 location: 连续的若干正则 location 编译为一个正则,
+ * 单个正则 (regex == NULL) 的组按原方式逐个匹配
+ */
+
+typedef struct {
+    ngx_regex_t                     *regex;
+    int                             *captures;
+    ngx_uint_t                       ncaptures;
+    ngx_uint_t                      *marks;
+
+    ngx_http_core_loc_conf_t       **locations;
+    ngx_uint_t                       nlocations;
+} ngx_http_regex_location_group_t;
+
+#endif
+
+
 struct ngx_http_core_loc_conf_s {
     ngx_str_t     name;          /* location name */
 
@@ -337,6 +368,7 @@ struct ngx_http_core_loc_conf_s {
 
     unsigned      exact_match:1;
     unsigned      noregex:1;
+    unsigned      regex_caseless:1;
 
     unsigned      auto_redirect:1;
 #if (NGX_HTTP_GZIP)
@@ -349,6 +381,8 @@ struct ngx_http_core_loc_conf_s {
     ngx_http_location_tree_node_t   *static_locations;
 #if (NGX_PCRE)
     ngx_http_core_loc_conf_t       **regex_locations;
+    ngx_http_regex_location_group_t *regex_groups;
+    ngx_uint_t                       nregex_groups;
 #endif
 
     /* pointer to the modules' loc_conf */
@@ -407,6 +441,8 @@ struct ngx_http_core_loc_conf_s {
     ngx_flag_t    internal;                /* internal */
     ngx_flag_t    sendfile;                /* sendfile */
     ngx_flag_t    aio;                     /* aio */
+    ngx_flag_t    aio_write;               /* aio_write */
+    ngx_flag_t    aio_open;                /* aio_open */
     ngx_flag_t    tcp_nopush;              /* tcp_nopush */
     ngx_flag_t    tcp_nodelay;             /* tcp_nodelay */
     ngx_flag_t    reset_timedout_connection; /* reset_timedout_connection */
@@ -420,6 +456,7 @@ struct ngx_http_core_loc_conf_s {
     ngx_flag_t    server_tokens;           /* server_tokens */
     ngx_flag_t    chunked_transfer_encoding; /* chunked_transfer_encoding */
     ngx_flag_t    etag;                    /* etag */
+    ngx_flag_t    combine_regex_locations; /* combine_regex_locations */
 
 #if (NGX_HTTP_GZIP)
     ngx_flag_t    gzip_vary;               /* gzip_vary */
@@ -523,6 +560,9 @@ ngx_int_t ngx_http_auth_basic_user(ngx_http_request_t *r);
 #if (NGX_HTTP_GZIP)
 ngx_int_t ngx_http_gzip_ok(ngx_http_request_t *r);
 #endif
+#if (NGX_HTTP_BROTLI)
+ngx_int_t ngx_http_brotli_ok(ngx_http_request_t *r);
+#endif
 
 
 ngx_int_t ngx_http_subrequest(ngx_http_request_t *r,
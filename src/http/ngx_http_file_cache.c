@@ -11,6 +11,43 @@
 #include <ngx_md5.h>
 
 
+/*
+ * 缓存索引快照: 文件头之后是按红黑树顺序排列的条目数组,
+ * 缓存加载进程通过 mmap 读取快照, 只遍历快照之后修改过的目录
+ */
+
+#define NGX_HTTP_CACHE_INDEX_MAGIC   0x78646e69     /* "indx" */
+#define NGX_HTTP_CACHE_INDEX_CHUNK   4096
+
+
+typedef struct {
+    uint32_t                         magic;
+    uint32_t                         version;
+    uint32_t                         bsize;
+    u_char                           levels[NGX_MAX_PATH_LEVEL];
+    time_t                           date;
+    ngx_uint_t                       count;
+} ngx_http_file_cache_index_header_t;
+
+
+typedef struct {
+    u_char                           key[NGX_HTTP_CACHE_KEY_LEN];
+    off_t                            fs_size;
+    ngx_uint_t                       tier;
+} ngx_http_file_cache_index_entry_t;
+
+
+#define NGX_HTTP_CACHE_TIER_MOVES    64
+#define NGX_HTTP_CACHE_TIER_WINDOW   10000
+
+
+typedef struct {
+    u_char                           key[NGX_HTTP_CACHE_KEY_LEN];
+    ngx_uint_t                       from;
+    ngx_uint_t                       to;
+} ngx_http_file_cache_move_t;
+
+
 static ngx_int_t ngx_http_file_cache_lock(ngx_http_request_t *r,
     ngx_http_cache_t *c);
 static void ngx_http_file_cache_lock_wait_handler(ngx_event_t *ev);
@@ -32,6 +69,8 @@ static ngx_int_t ngx_http_file_cache_exists(ngx_http_file_cache_t *cache,
     ngx_http_cache_t *c);
 static ngx_int_t ngx_http_file_cache_name(ngx_http_request_t *r,
     ngx_path_t *path);
+static void ngx_http_file_cache_node_name(ngx_http_file_cache_t *cache,
+    ngx_uint_t tier, ngx_http_file_cache_node_t *fcn, u_char *name);
 static ngx_http_file_cache_node_t *
     ngx_http_file_cache_lookup(ngx_http_file_cache_t *cache, u_char *key);
 static void ngx_http_file_cache_rbtree_insert_value(ngx_rbtree_node_t *temp,
@@ -45,10 +84,26 @@ static ngx_int_t ngx_http_file_cache_reopen(ngx_http_request_t *r,
 static ngx_int_t ngx_http_file_cache_update_variant(ngx_http_request_t *r,
     ngx_http_cache_t *c);
 static void ngx_http_file_cache_cleanup(void *data);
+static ngx_int_t ngx_http_file_cache_purge_wildcard(ngx_http_request_t *r,
+    ngx_http_cache_t *c);
+static void ngx_http_file_cache_purge_node(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_node_t *fcn, u_char *name);
+static ngx_uint_t ngx_http_file_cache_purged(ngx_http_file_cache_t *cache,
+    ngx_str_t *key, ngx_uint_t n, time_t date);
+static ngx_uint_t ngx_http_file_cache_purge_match(
+    ngx_http_file_cache_purge_t *purge, ngx_str_t *key, ngx_uint_t n);
+static ngx_int_t ngx_http_file_cache_purge_walk(ngx_http_file_cache_t *cache);
+static ngx_http_file_cache_node_t *ngx_http_file_cache_purge_next(
+    ngx_http_file_cache_t *cache);
 static time_t ngx_http_file_cache_forced_expire(ngx_http_file_cache_t *cache);
 static time_t ngx_http_file_cache_expire(ngx_http_file_cache_t *cache);
 static void ngx_http_file_cache_delete(ngx_http_file_cache_t *cache,
     ngx_queue_t *q, u_char *name);
+static void ngx_http_file_cache_tiers(ngx_http_file_cache_t *cache);
+static ngx_uint_t ngx_http_file_cache_tier_moves(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_move_t *moves);
+static ngx_int_t ngx_http_file_cache_move(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_move_t *move, u_char *from, u_char *to, u_char *temp);
 static void ngx_http_file_cache_loader_sleep(ngx_http_file_cache_t *cache);
 static ngx_int_t ngx_http_file_cache_noop(ngx_tree_ctx_t *ctx,
     ngx_str_t *path);
@@ -62,6 +117,12 @@ static ngx_int_t ngx_http_file_cache_add(ngx_http_file_cache_t *cache,
     ngx_http_cache_t *c);
 static ngx_int_t ngx_http_file_cache_delete_file(ngx_tree_ctx_t *ctx,
     ngx_str_t *path);
+static void ngx_http_file_cache_save_index(void *data);
+static time_t ngx_http_file_cache_load_index(ngx_http_file_cache_t *cache);
+static ngx_rbtree_node_t *ngx_http_file_cache_index_next(ngx_rbtree_t *tree,
+    ngx_rbtree_node_t *node);
+static ngx_rbtree_node_t *ngx_http_file_cache_index_resume(
+    ngx_http_file_cache_t *cache, u_char *key);
 
 
 ngx_str_t  ngx_http_cache_status[] = {
@@ -109,6 +170,28 @@ ngx_http_file_cache_init(ngx_shm_zone_t *shm_zone, void *data)
             }
         }
 
+        if (cache->ntiers != ocache->ntiers) {
+            ngx_log_error(NGX_LOG_EMERG, shm_zone->shm.log, 0,
+                          "cache \"%V\" had previously different tiers",
+                          &shm_zone->shm.name);
+            return NGX_ERROR;
+        }
+
+        for (n = 1; n < cache->ntiers; n++) {
+            if (ngx_strcmp(cache->tiers[n].path->name.data,
+                           ocache->tiers[n].path->name.data)
+                != 0)
+            {
+                ngx_log_error(NGX_LOG_EMERG, shm_zone->shm.log, 0,
+                              "cache \"%V\" uses the \"%V\" tier path "
+                              "while previously it used the \"%V\" tier path",
+                              &shm_zone->shm.name,
+                              &cache->tiers[n].path->name,
+                              &ocache->tiers[n].path->name);
+                return NGX_ERROR;
+            }
+        }
+
         cache->sh = ocache->sh;
 
         cache->shpool = ocache->shpool;
@@ -116,6 +199,10 @@ ngx_http_file_cache_init(ngx_shm_zone_t *shm_zone, void *data)
 
         cache->max_size /= cache->bsize;
 
+        for (n = 1; n < cache->ntiers; n++) {
+            cache->tiers[n].max_size /= cache->bsize;
+        }
+
         if (!cache->sh->cold || cache->sh->loading) {
             cache->path->loader = NULL;
         }
@@ -143,15 +230,27 @@ ngx_http_file_cache_init(ngx_shm_zone_t *shm_zone, void *data)
                     ngx_http_file_cache_rbtree_insert_value);
 
     ngx_queue_init(&cache->sh->queue);
+    ngx_queue_init(&cache->sh->purges);
+
+    cache->sh->purge_walk = 0;
+    cache->sh->purge_resume = 0;
 
     cache->sh->cold = 1;
     cache->sh->loading = 0;
     cache->sh->size = 0;
 
+    ngx_memzero(cache->sh->tiers, sizeof(cache->sh->tiers));
+
     cache->bsize = ngx_fs_bsize(cache->path->name.data);
 
     cache->max_size /= cache->bsize;
 
+    /* the sizes of all tiers are counted in blocks of the main path */
+
+    for (n = 1; n < cache->ntiers; n++) {
+        cache->tiers[n].max_size /= cache->bsize;
+    }
+
     len = sizeof(" in cache keys zone \"\"") + shm_zone->shm.name.len;
 
     cache->shpool->log_ctx = ngx_slab_alloc(cache->shpool, len);
@@ -212,7 +311,7 @@ ngx_http_file_cache_create(ngx_http_request_t *r)
         return NGX_ERROR;
     }
 
-    if (ngx_http_file_cache_name(r, cache->path) != NGX_OK) {
+    if (ngx_http_file_cache_name(r, cache->tiers[c->tier].path) != NGX_OK) {
         return NGX_ERROR;
     }
 
@@ -261,7 +360,8 @@ ngx_int_t
 ngx_http_file_cache_open(ngx_http_request_t *r)
 {
     ngx_int_t                  rc, rv;
-    ngx_uint_t                 test;
+    ngx_uint_t                 test, tier;
+    ngx_file_uniq_t            uniq;
     ngx_http_cache_t          *c;
     ngx_pool_cleanup_t        *cln;
     ngx_open_file_info_t       of;
@@ -331,7 +431,7 @@ ngx_http_file_cache_open(ngx_http_request_t *r)
         }
     }
 
-    if (ngx_http_file_cache_name(r, cache->path) != NGX_OK) {
+    if (ngx_http_file_cache_name(r, cache->tiers[c->tier].path) != NGX_OK) {
         return NGX_ERROR;
     }
 
@@ -339,6 +439,8 @@ ngx_http_file_cache_open(ngx_http_request_t *r)
         goto done;
     }
 
+again:
+
     clcf = ngx_http_get_module_loc_conf(r, ngx_http_core_module);
 
     ngx_memzero(&of, sizeof(ngx_open_file_info_t));
@@ -360,6 +462,30 @@ ngx_http_file_cache_open(ngx_http_request_t *r)
 
         case NGX_ENOENT:
         case NGX_ENOTDIR:
+
+            /* the file may have been moved to another tier meanwhile */
+
+            ngx_shmtx_lock(&cache->shpool->mutex);
+
+            tier = c->node->tier;
+            uniq = c->node->uniq;
+
+            ngx_shmtx_unlock(&cache->shpool->mutex);
+
+            if (tier != c->tier && c->exists) {
+                c->tier = tier;
+                c->uniq = uniq;
+                c->file.name.len = 0;
+
+                if (ngx_http_file_cache_name(r, cache->tiers[tier].path)
+                    != NGX_OK)
+                {
+                    return NGX_ERROR;
+                }
+
+                goto again;
+            }
+
             goto done;
 
         default:
@@ -577,9 +703,30 @@ ngx_http_file_cache_read(ngx_http_request_t *r, ngx_http_cache_t *c)
         }
     }
 
+    cache = c->file_cache;
+
+    if (!ngx_queue_empty(&cache->sh->purges)) {
+
+        ngx_shmtx_lock(&cache->shpool->mutex);
+
+        rc = ngx_http_file_cache_purged(cache, c->keys.elts, c->keys.nelts,
+                                        h->date);
+
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+
+        if (rc) {
+            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                           "http file cache \"%s\" purged",
+                           c->file.name.data);
+            return NGX_DECLINED;
+        }
+    }
+
     c->buf->last += n;
 
     c->valid_sec = h->valid_sec;
+    c->updating_sec = h->updating_sec;
+    c->error_sec = h->error_sec;
     c->last_modified = h->last_modified;
     c->date = h->date;
     c->valid_msec = h->valid_msec;
@@ -590,7 +737,9 @@ ngx_http_file_cache_read(ngx_http_request_t *r, ngx_http_cache_t *c)
 
     r->cached = 1;
 
-    cache = c->file_cache;
+    if (cache->ntiers > 1) {
+        (void) ngx_atomic_fetch_add(&cache->sh->tiers[c->tier].hits, 1);
+    }
 
     if (cache->sh->cold) {
 
@@ -604,6 +753,7 @@ ngx_http_file_cache_read(ngx_http_request_t *r, ngx_http_cache_t *c)
             c->node->fs_size = c->fs_size;
 
             cache->sh->size += c->fs_size;
+            cache->sh->tiers[c->node->tier].size += c->fs_size;
         }
 
         ngx_shmtx_unlock(&cache->shpool->mutex);
@@ -612,6 +762,8 @@ ngx_http_file_cache_read(ngx_http_request_t *r, ngx_http_cache_t *c)
     now = ngx_time();
 
     if (c->valid_sec < now) {
+        c->stale_updating = c->valid_sec + c->updating_sec >= now;
+        c->stale_error = c->valid_sec + c->error_sec >= now;
 
         ngx_shmtx_lock(&cache->shpool->mutex);
 
@@ -889,6 +1041,7 @@ done:
 
     c->uniq = fcn->uniq;
     c->error = fcn->error;
+    c->tier = fcn->tier;
     c->node = fcn;
 
 failed:
@@ -934,6 +1087,32 @@ ngx_http_file_cache_name(ngx_http_request_t *r, ngx_path_t *path)
 }
 
 
+/*
+ * makes the name of the entry file in the tier given, the buffer
+ * should have space for cache->name_len + 1 bytes
+ */
+
+static void
+ngx_http_file_cache_node_name(ngx_http_file_cache_t *cache, ngx_uint_t tier,
+    ngx_http_file_cache_node_t *fcn, u_char *name)
+{
+    u_char      *p;
+    ngx_path_t  *path;
+
+    path = cache->tiers[tier].path;
+
+    p = ngx_cpymem(name, path->name.data, path->name.len);
+    p += 1 + path->len;
+
+    p = ngx_hex_dump(p, (u_char *) &fcn->node.key, sizeof(ngx_rbtree_key_t));
+    p = ngx_hex_dump(p, fcn->key,
+                     NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+    *p = '\0';
+
+    ngx_create_hashed_filename(path, name, p - name);
+}
+
+
 static ngx_http_file_cache_node_t *
 ngx_http_file_cache_lookup(ngx_http_file_cache_t *cache, u_char *key)
 {
@@ -1227,6 +1406,8 @@ ngx_http_file_cache_set_header(ngx_http_request_t *r, u_char *buf)
 
     h->version = NGX_HTTP_CACHE_VERSION;
     h->valid_sec = c->valid_sec;
+    h->updating_sec = c->updating_sec;
+    h->error_sec = c->error_sec;
     h->last_modified = c->last_modified;
     h->date = c->date;
     h->crc32 = c->crc32;
@@ -1312,7 +1493,7 @@ ngx_http_file_cache_update_variant(ngx_http_request_t *r, ngx_http_cache_t *c)
         return NGX_ERROR;
     }
 
-    if (ngx_http_file_cache_name(r, cache->path) != NGX_OK) {
+    if (ngx_http_file_cache_name(r, cache->tiers[c->tier].path) != NGX_OK) {
         return NGX_ERROR;
     }
 
@@ -1320,11 +1501,13 @@ ngx_http_file_cache_update_variant(ngx_http_request_t *r, ngx_http_cache_t *c)
 }
 
 
-void
+ngx_int_t
 ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
 {
+    u_char                 *name;
     off_t                   fs_size;
     ngx_int_t               rc;
+    ngx_uint_t              tier;
     ngx_file_uniq_t         uniq;
     ngx_file_info_t         fi;
     ngx_http_cache_t        *c;
@@ -1334,7 +1517,7 @@ ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
     c = r->cache;
 
     if (c->updated) {
-        return;
+        return NGX_OK;
     }
 
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
@@ -1342,8 +1525,26 @@ ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
 
     cache = c->file_cache;
 
-    c->updated = 1;
-    c->updating = 0;
+    name = NULL;
+
+    if (cache->ntiers > 1) {
+
+        /* a new version of an entry is always stored in the main path */
+
+        if (c->tier) {
+            c->tier = 0;
+            c->file.name.len = 0;
+
+            if (ngx_http_file_cache_name(r, cache->path) != NGX_OK) {
+                return NGX_ERROR;
+            }
+        }
+
+        name = ngx_pnalloc(r->pool, cache->name_len + 1);
+        if (name == NULL) {
+            return NGX_ERROR;
+        }
+    }
 
     uniq = 0;
     fs_size = 0;
@@ -1352,14 +1553,41 @@ ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
                    "http file cache rename: \"%s\" to \"%s\"",
                    tf->file.name.data, c->file.name.data);
 
-    ext.access = NGX_FILE_OWNER_ACCESS;
-    ext.path_access = NGX_FILE_OWNER_ACCESS;
-    ext.time = -1;
-    ext.create_path = 1;
-    ext.delete_file = 1;
-    ext.log = r->connection->log;
+    rc = NGX_DECLINED;
+
+#if (NGX_THREADS)
+
+    /* the file written by threads is renamed there as well */
+
+    if (tf->thread_write) {
+        rc = ngx_thread_rename_file(&tf->file, c->file.name.data, r->pool);
+
+        if (rc == NGX_AGAIN) {
+            return NGX_AGAIN;
+        }
+    }
+
+#endif
+
+    c->updated = 1;
+    c->updating = 0;
+
+    if (rc != NGX_OK) {
+
+        /*
+         * the plain rename is retried here to create a missing path
+         * or to copy the file to another file system
+         */
+
+        ext.access = NGX_FILE_OWNER_ACCESS;
+        ext.path_access = NGX_FILE_OWNER_ACCESS;
+        ext.time = -1;
+        ext.create_path = 1;
+        ext.delete_file = 1;
+        ext.log = r->connection->log;
 
-    rc = ngx_ext_rename_file(&tf->file.name, &c->file.name, &ext);
+        rc = ngx_ext_rename_file(&tf->file.name, &c->file.name, &ext);
+    }
 
     if (rc == NGX_OK) {
 
@@ -1381,8 +1609,17 @@ ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
     c->node->uniq = uniq;
     c->node->body_start = c->body_start;
 
+    tier = c->node->tier;
+
     cache->sh->size += fs_size - c->node->fs_size;
+    cache->sh->tiers[tier].size -= c->node->fs_size;
+    cache->sh->tiers[0].size += fs_size;
     c->node->fs_size = fs_size;
+    c->node->tier = 0;
+
+    if (tier) {
+        ngx_http_file_cache_node_name(cache, tier, c->node, name);
+    }
 
     if (rc == NGX_OK) {
         c->node->exists = 1;
@@ -1391,6 +1628,17 @@ ngx_http_file_cache_update(ngx_http_request_t *r, ngx_temp_file_t *tf)
     c->node->updating = 0;
 
     ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    /* the previous version is removed from the tier it was moved to */
+
+    if (tier && ngx_delete_file(name) == NGX_FILE_ERROR
+        && ngx_errno != NGX_ENOENT)
+    {
+        ngx_log_error(NGX_LOG_CRIT, r->connection->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", name);
+    }
+
+    return NGX_OK;
 }
 
 
@@ -1487,6 +1735,8 @@ ngx_http_file_cache_update_header(ngx_http_request_t *r)
 
     h.version = NGX_HTTP_CACHE_VERSION;
     h.valid_sec = c->valid_sec;
+    h.updating_sec = c->updating_sec;
+    h.error_sec = c->error_sec;
     h.last_modified = c->last_modified;
     h.date = c->date;
     h.crc32 = c->crc32;
@@ -1653,7 +1903,7 @@ ngx_http_file_cache_cleanup(void *data)
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, c->file.log, 0,
                    "http file cache cleanup");
 
-    if (c->updating) {
+    if (c->updating && !c->background) {
         ngx_log_error(NGX_LOG_ALERT, c->file.log, 0,
                       "stalled cache updating, error:%ui", c->error);
     }
@@ -1662,196 +1912,155 @@ ngx_http_file_cache_cleanup(void *data)
 }
 
 
-static time_t
-ngx_http_file_cache_forced_expire(ngx_http_file_cache_t *cache)
+ngx_int_t
+ngx_http_file_cache_purge(ngx_http_request_t *r)
 {
     u_char                      *name;
-    size_t                       len;
-    time_t                       wait;
-    ngx_uint_t                   tries;
-    ngx_path_t                  *path;
-    ngx_queue_t                 *q;
+    ngx_str_t                   *key;
+    ngx_http_cache_t            *c;
+    ngx_http_file_cache_t       *cache;
     ngx_http_file_cache_node_t  *fcn;
 
-    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                   "http file cache forced expire");
+    c = r->cache;
+    cache = c->file_cache;
 
-    path = cache->path;
-    len = path->name.len + 1 + path->len + 2 * NGX_HTTP_CACHE_KEY_LEN;
+    key = c->keys.elts;
 
-    name = ngx_alloc(len + 1, ngx_cycle->log);
-    if (name == NULL) {
-        return 10;
+    if (c->keys.nelts
+        && key[c->keys.nelts - 1].len
+        && key[c->keys.nelts - 1].data[key[c->keys.nelts - 1].len - 1] == '*')
+    {
+        return ngx_http_file_cache_purge_wildcard(r, c);
     }
 
-    ngx_memcpy(name, path->name.data, path->name.len);
-
-    wait = 10;
-    tries = 20;
+    name = ngx_pnalloc(r->pool, cache->name_len + 1);
+    if (name == NULL) {
+        return NGX_ERROR;
+    }
 
     ngx_shmtx_lock(&cache->shpool->mutex);
 
-    for (q = ngx_queue_last(&cache->sh->queue);
-         q != ngx_queue_sentinel(&cache->sh->queue);
-         q = ngx_queue_prev(q))
-    {
-        fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
-
-        ngx_log_debug6(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                  "http file cache forced expire: #%d %d %02xd%02xd%02xd%02xd",
-                  fcn->count, fcn->exists,
-                  fcn->key[0], fcn->key[1], fcn->key[2], fcn->key[3]);
-
-        if (fcn->count == 0) {
-            ngx_http_file_cache_delete(cache, q, name);
-            wait = 0;
-
-        } else {
-            if (--tries) {
-                continue;
-            }
-
-            wait = 1;
-        }
+    fcn = ngx_http_file_cache_lookup(cache, c->key);
 
-        break;
+    if (fcn == NULL || (!fcn->exists && !fcn->error)) {
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+        return NGX_DECLINED;
     }
 
-    ngx_shmtx_unlock(&cache->shpool->mutex);
+    ngx_http_file_cache_purge_node(cache, fcn, name);
 
-    ngx_free(name);
+    ngx_shmtx_unlock(&cache->shpool->mutex);
 
-    return wait;
+    return NGX_OK;
 }
 
 
-static time_t
-ngx_http_file_cache_expire(ngx_http_file_cache_t *cache)
+static ngx_int_t
+ngx_http_file_cache_purge_wildcard(ngx_http_request_t *r, ngx_http_cache_t *c)
 {
-    u_char                      *name, *p;
-    size_t                       len;
-    time_t                       now, wait;
-    ngx_path_t                  *path;
-    ngx_queue_t                 *q;
-    ngx_http_file_cache_node_t  *fcn;
-    u_char                       key[2 * NGX_HTTP_CACHE_KEY_LEN];
+    u_char                       *p;
+    size_t                        len;
+    ngx_str_t                    *key;
+    ngx_uint_t                    i;
+    ngx_queue_t                  *q;
+    ngx_http_file_cache_t        *cache;
+    ngx_http_file_cache_purge_t  *purge;
 
-    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                   "http file cache expire");
+    cache = c->file_cache;
 
-    path = cache->path;
-    len = path->name.len + 1 + path->len + 2 * NGX_HTTP_CACHE_KEY_LEN;
+    key = c->keys.elts;
+    len = 0;
 
-    name = ngx_alloc(len + 1, ngx_cycle->log);
-    if (name == NULL) {
-        return 10;
+    for (i = 0; i < c->keys.nelts; i++) {
+        len += key[i].len;
     }
 
-    ngx_memcpy(name, path->name.data, path->name.len);
+    /* the trailing "*" is not a part of the prefix */
 
-    now = ngx_time();
+    len--;
 
     ngx_shmtx_lock(&cache->shpool->mutex);
 
-    for ( ;; ) {
+    for (q = ngx_queue_head(&cache->sh->purges);
+         q != ngx_queue_sentinel(&cache->sh->purges);
+         q = ngx_queue_next(q))
+    {
+        purge = ngx_queue_data(q, ngx_http_file_cache_purge_t, queue);
 
-        if (ngx_quit || ngx_terminate) {
-            wait = 1;
-            break;
-        }
+        if (purge->len == len
+            && ngx_http_file_cache_purge_match(purge, key, c->keys.nelts))
+        {
+            /* the walk in progress may have passed some entries already */
 
-        if (ngx_queue_empty(&cache->sh->queue)) {
-            wait = 10;
-            break;
+            purge->date = ngx_time();
+            purge->walk = 0;
+            goto done;
         }
+    }
 
-        q = ngx_queue_last(&cache->sh->queue);
-
-        fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
-
-        wait = fcn->expire - now;
-
-        if (wait > 0) {
-            wait = wait > 10 ? 10 : wait;
-            break;
-        }
+    purge = ngx_slab_alloc_locked(cache->shpool,
+                             offsetof(ngx_http_file_cache_purge_t, key) + len);
+    if (purge == NULL) {
+        ngx_shmtx_unlock(&cache->shpool->mutex);
 
-        ngx_log_debug6(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                       "http file cache expire: #%d %d %02xd%02xd%02xd%02xd",
-                       fcn->count, fcn->exists,
-                       fcn->key[0], fcn->key[1], fcn->key[2], fcn->key[3]);
+        ngx_log_error(NGX_LOG_ALERT, r->connection->log, 0,
+                      "could not allocate purge%s", cache->shpool->log_ctx);
+        return NGX_ERROR;
+    }
 
-        if (fcn->count == 0) {
-            ngx_http_file_cache_delete(cache, q, name);
-            continue;
-        }
+    purge->date = ngx_time();
+    purge->walk = 0;
+    purge->len = len;
 
-        if (fcn->deleting) {
-            wait = 1;
-            break;
-        }
+    p = purge->key;
 
-        p = ngx_hex_dump(key, (u_char *) &fcn->node.key,
-                         sizeof(ngx_rbtree_key_t));
-        len = NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t);
-        (void) ngx_hex_dump(p, fcn->key, len);
+    for (i = 0; i < c->keys.nelts; i++) {
+        p = ngx_cpymem(p, key[i].data, ngx_min(key[i].len, len));
+        len -= ngx_min(key[i].len, len);
+    }
 
-        /*
-         * abnormally exited workers may leave locked cache entries,
-         * and although it may be safe to remove them completely,
-         * we prefer to just move them to the top of the inactive queue
-         */
+    ngx_queue_insert_tail(&cache->sh->purges, &purge->queue);
 
-        ngx_queue_remove(q);
-        fcn->expire = ngx_time() + cache->inactive;
-        ngx_queue_insert_head(&cache->sh->queue, &fcn->queue);
+done:
 
-        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, 0,
-                      "ignore long locked inactive cache entry %*s, count:%d",
-                      2 * NGX_HTTP_CACHE_KEY_LEN, key, fcn->count);
-    }
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                   "http file cache purge: \"%*s*\"", purge->len, purge->key);
 
     ngx_shmtx_unlock(&cache->shpool->mutex);
 
-    ngx_free(name);
-
-    return wait;
+    return NGX_OK;
 }
 
 
+/*
+ * the mutex is locked on entry and on exit, the name buffer
+ * should have space for cache->name_len + 1 bytes
+ */
+
 static void
-ngx_http_file_cache_delete(ngx_http_file_cache_t *cache, ngx_queue_t *q,
-    u_char *name)
+ngx_http_file_cache_purge_node(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_node_t *fcn, u_char *name)
 {
-    u_char                      *p;
-    size_t                       len;
-    ngx_path_t                  *path;
-    ngx_http_file_cache_node_t  *fcn;
-
-    fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+    fcn->error = 0;
+    fcn->valid_sec = 0;
 
     if (fcn->exists) {
         cache->sh->size -= fcn->fs_size;
+        cache->sh->tiers[fcn->tier].size -= fcn->fs_size;
+        fcn->exists = 0;
 
-        path = cache->path;
-        p = name + path->name.len + 1 + path->len;
-        p = ngx_hex_dump(p, (u_char *) &fcn->node.key,
-                         sizeof(ngx_rbtree_key_t));
-        len = NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t);
-        p = ngx_hex_dump(p, fcn->key, len);
-        *p = '\0';
+        ngx_http_file_cache_node_name(cache, fcn->tier, fcn, name);
 
         fcn->count++;
         fcn->deleting = 1;
         ngx_shmtx_unlock(&cache->shpool->mutex);
 
-        len = path->name.len + 1 + path->len + 2 * NGX_HTTP_CACHE_KEY_LEN;
-        ngx_create_hashed_filename(path, name, len);
-
         ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                       "http file cache expire: \"%s\"", name);
+                       "http file cache purge: \"%s\"", name);
 
-        if (ngx_delete_file(name) == NGX_FILE_ERROR) {
+        if (ngx_delete_file(name) == NGX_FILE_ERROR
+            && ngx_errno != NGX_ENOENT)
+        {
             ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
                           ngx_delete_file_n " \"%s\" failed", name);
         }
@@ -1861,264 +2070,1713 @@ ngx_http_file_cache_delete(ngx_http_file_cache_t *cache, ngx_queue_t *q,
         fcn->deleting = 0;
     }
 
+    /* the entry still in use is freed by the last ngx_http_file_cache_free() */
+
     if (fcn->count == 0) {
-        ngx_queue_remove(q);
+        ngx_queue_remove(&fcn->queue);
         ngx_rbtree_delete(&cache->sh->rbtree, &fcn->node);
         ngx_slab_free_locked(cache->shpool, fcn);
     }
 }
 
 
-static time_t
-ngx_http_file_cache_manager(void *data)
+/*
+ * tests whether the key given in parts matches a purge record made
+ * not earlier than the date, the mutex should be locked
+ */
+
+static ngx_uint_t
+ngx_http_file_cache_purged(ngx_http_file_cache_t *cache, ngx_str_t *key,
+    ngx_uint_t n, time_t date)
 {
-    ngx_http_file_cache_t  *cache = data;
+    ngx_queue_t                  *q;
+    ngx_http_file_cache_purge_t  *purge;
 
-    off_t   size;
-    time_t  next, wait;
+    for (q = ngx_queue_head(&cache->sh->purges);
+         q != ngx_queue_sentinel(&cache->sh->purges);
+         q = ngx_queue_next(q))
+    {
+        purge = ngx_queue_data(q, ngx_http_file_cache_purge_t, queue);
 
-    next = ngx_http_file_cache_expire(cache);
+        if (purge->date >= date
+            && ngx_http_file_cache_purge_match(purge, key, n))
+        {
+            return 1;
+        }
+    }
 
-    cache->last = ngx_current_msec;
-    cache->files = 0;
+    return 0;
+}
+
+
+static ngx_uint_t
+ngx_http_file_cache_purge_match(ngx_http_file_cache_purge_t *purge,
+    ngx_str_t *key, ngx_uint_t n)
+{
+    u_char      *p;
+    size_t       len, size;
+    ngx_uint_t   i;
+
+    p = purge->key;
+    len = purge->len;
+
+    for (i = 0; i < n && len; i++) {
+        size = ngx_min(key[i].len, len);
+
+        if (ngx_memcmp(p, key[i].data, size) != 0) {
+            return 0;
+        }
+
+        p += size;
+        len -= size;
+    }
+
+    return (len == 0);
+}
+
+
+/*
+ * The cache manager walks the index once for the wildcard purges
+ * registered before the walk started: the keys are read from the files,
+ * and matching entries are removed.  Until then ngx_http_file_cache_read()
+ * does not use the entries.  The walk is done in key order, a batch
+ * limited by loader_files and loader_threshold per manager run, and
+ * the last key walked is kept in the zone to resume from.
+ */
+
+static ngx_int_t
+ngx_http_file_cache_purge_walk(ngx_http_file_cache_t *cache)
+{
+    u_char                         *name;
+    u_char                          k[NGX_HTTP_CACHE_KEY_LEN];
+    ssize_t                         n;
+    ngx_int_t                       rc;
+    ngx_str_t                       key;
+    ngx_msec_t                      elapsed;
+    ngx_file_t                      file;
+    ngx_queue_t                    *q, *next;
+    ngx_http_file_cache_sh_t       *sh;
+    ngx_http_file_cache_node_t     *fcn;
+    ngx_http_file_cache_purge_t    *purge;
+    ngx_http_file_cache_header_t    h;
+
+    name = ngx_alloc(cache->name_len + 1, ngx_cycle->log);
+    if (name == NULL) {
+        return NGX_ERROR;
+    }
+
+    /* the key length is limited by the u_short header_start */
+
+    key.data = ngx_alloc(65536, ngx_cycle->log);
+    if (key.data == NULL) {
+        ngx_free(name);
+        return NGX_ERROR;
+    }
+
+    sh = cache->sh;
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    if (!sh->purge_walk) {
+
+        for (q = ngx_queue_head(&sh->purges);
+             q != ngx_queue_sentinel(&sh->purges);
+             q = ngx_queue_next(q))
+        {
+            purge = ngx_queue_data(q, ngx_http_file_cache_purge_t, queue);
+            purge->walk = 1;
+        }
+
+        sh->purge_walk = 1;
+        sh->purge_resume = 0;
+    }
+
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache purge walk%s",
+                   sh->purge_resume ? " resumed" : "");
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    ngx_memzero(&file, sizeof(ngx_file_t));
+    file.log = ngx_cycle->log;
 
     for ( ;; ) {
+
+        if (ngx_quit || ngx_terminate) {
+            rc = NGX_AGAIN;
+            goto done;
+        }
+
         ngx_shmtx_lock(&cache->shpool->mutex);
 
-        size = cache->sh->size;
+        fcn = ngx_http_file_cache_purge_next(cache);
+
+        if (fcn == NULL) {
+            break;
+        }
+
+        ngx_memcpy(k, &fcn->node.key, sizeof(ngx_rbtree_key_t));
+        ngx_memcpy(&k[sizeof(ngx_rbtree_key_t)], fcn->key,
+                   NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+
+        ngx_memcpy(sh->purge_cursor, k, NGX_HTTP_CACHE_KEY_LEN);
+        sh->purge_resume = 1;
+
+        if (!fcn->exists) {
+            ngx_shmtx_unlock(&cache->shpool->mutex);
+            goto next;
+        }
+
+        ngx_http_file_cache_node_name(cache, fcn->tier, fcn, name);
 
         ngx_shmtx_unlock(&cache->shpool->mutex);
 
-        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                       "http file cache size: %O", size);
+        file.name.len = ngx_strlen(name);
+        file.name.data = name;
+        file.offset = 0;
 
-        if (size < cache->max_size) {
-            return next;
+        file.fd = ngx_open_file(name, NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+        if (file.fd == NGX_INVALID_FILE) {
+            goto next;
         }
 
-        wait = ngx_http_file_cache_forced_expire(cache);
+        n = ngx_read_file(&file, (u_char *) &h, sizeof(h), 0);
 
-        if (wait > 0) {
-            return wait;
+        if (n == (ssize_t) sizeof(h)
+            && h.version == NGX_HTTP_CACHE_VERSION
+            && h.header_start > sizeof(h) + sizeof(ngx_http_file_cache_key))
+        {
+            key.len = h.header_start - sizeof(h)
+                      - sizeof(ngx_http_file_cache_key) - 1;
+
+            n = ngx_read_file(&file, key.data, key.len,
+                              sizeof(h) + sizeof(ngx_http_file_cache_key));
+
+        } else {
+            n = NGX_ERROR;
         }
 
-        if (ngx_quit || ngx_terminate) {
-            return next;
+        if (ngx_close_file(file.fd) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                          ngx_close_file_n " \"%s\" failed", name);
+        }
+
+        if (n == (ssize_t) key.len) {
+
+            ngx_shmtx_lock(&cache->shpool->mutex);
+
+            if (ngx_http_file_cache_purged(cache, &key, 1, h.date)) {
+
+                fcn = ngx_http_file_cache_lookup(cache, k);
+
+                if (fcn && fcn->exists) {
+                    ngx_http_file_cache_purge_node(cache, fcn, name);
+                }
+            }
+
+            ngx_shmtx_unlock(&cache->shpool->mutex);
+        }
+
+    next:
+
+        /*
+         * every node visited counts, including the ones skipped, and
+         * the rest of the index waits for the next manager run
+         */
+
+        if (++cache->files >= cache->loader_files) {
+            rc = NGX_AGAIN;
+            goto done;
+        }
+
+        ngx_time_update();
+
+        elapsed = ngx_abs((ngx_msec_int_t) (ngx_current_msec - cache->last));
+
+        if (elapsed >= cache->loader_threshold) {
+            rc = NGX_AGAIN;
+            goto done;
+        }
+    }
+
+    /*
+     * the whole index is walked, the purges registered or renewed
+     * after the walk started wait for the next one
+     */
+
+    for (q = ngx_queue_head(&sh->purges);
+         q != ngx_queue_sentinel(&sh->purges);
+         q = next)
+    {
+        next = ngx_queue_next(q);
+
+        purge = ngx_queue_data(q, ngx_http_file_cache_purge_t, queue);
+
+        if (purge->walk) {
+            ngx_queue_remove(q);
+            ngx_slab_free_locked(cache->shpool, purge);
         }
     }
+
+    sh->purge_walk = 0;
+    sh->purge_resume = 0;
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache purge walk done");
+
+    rc = NGX_OK;
+
+done:
+
+    ngx_free(key.data);
+    ngx_free(name);
+
+    return rc;
 }
 
 
-static void
-ngx_http_file_cache_loader(void *data)
+/*
+ * finds the first node after the purge cursor in the key order,
+ * the mutex is locked on entry and on exit
+ */
+
+static ngx_http_file_cache_node_t *
+ngx_http_file_cache_purge_next(ngx_http_file_cache_t *cache)
 {
-    ngx_http_file_cache_t  *cache = data;
+    u_char                      *cursor;
+    ngx_int_t                    rc;
+    ngx_rbtree_key_t             node_key;
+    ngx_rbtree_node_t           *node, *sentinel;
+    ngx_http_file_cache_node_t  *fcn, *next;
 
-    ngx_tree_ctx_t  tree;
+    cursor = cache->sh->purge_cursor;
 
-    if (!cache->sh->cold || cache->sh->loading) {
-        return;
-    }
+    ngx_memcpy((u_char *) &node_key, cursor, sizeof(ngx_rbtree_key_t));
 
-    if (!ngx_atomic_cmp_set(&cache->sh->loading, 0, ngx_pid)) {
-        return;
+    node = cache->sh->rbtree.root;
+    sentinel = cache->sh->rbtree.sentinel;
+
+    next = NULL;
+
+    while (node != sentinel) {
+
+        fcn = (ngx_http_file_cache_node_t *) node;
+
+        if (!cache->sh->purge_resume || node_key < node->key) {
+            rc = -1;
+
+        } else if (node_key > node->key) {
+            rc = 1;
+
+        } else {
+            rc = ngx_memcmp(&cursor[sizeof(ngx_rbtree_key_t)], fcn->key,
+                            NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+        }
+
+        if (rc < 0) {
+            next = fcn;
+            node = node->left;
+
+        } else {
+            node = node->right;
+        }
     }
 
+    return next;
+}
+
+
+static time_t
+ngx_http_file_cache_forced_expire(ngx_http_file_cache_t *cache)
+{
+    u_char                      *name;
+    time_t                       wait;
+    ngx_uint_t                   tries;
+    ngx_queue_t                 *q;
+    ngx_http_file_cache_node_t  *fcn;
+
     ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                   "http file cache loader");
+                   "http file cache forced expire");
 
-    tree.init_handler = NULL;
-    tree.file_handler = ngx_http_file_cache_manage_file;
-    tree.pre_tree_handler = ngx_http_file_cache_manage_directory;
-    tree.post_tree_handler = ngx_http_file_cache_noop;
-    tree.spec_handler = ngx_http_file_cache_delete_file;
-    tree.data = cache;
-    tree.alloc = 0;
-    tree.log = ngx_cycle->log;
+    name = ngx_alloc(cache->name_len + 1, ngx_cycle->log);
+    if (name == NULL) {
+        return 10;
+    }
 
-    cache->last = ngx_current_msec;
-    cache->files = 0;
+    wait = 10;
+    tries = 20;
 
-    if (ngx_walk_tree(&tree, &cache->path->name) == NGX_ABORT) {
-        cache->sh->loading = 0;
-        return;
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    for (q = ngx_queue_last(&cache->sh->queue);
+         q != ngx_queue_sentinel(&cache->sh->queue);
+         q = ngx_queue_prev(q))
+    {
+        fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+        ngx_log_debug6(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                  "http file cache forced expire: #%d %d %02xd%02xd%02xd%02xd",
+                  fcn->count, fcn->exists,
+                  fcn->key[0], fcn->key[1], fcn->key[2], fcn->key[3]);
+
+        if (fcn->count == 0) {
+            ngx_http_file_cache_delete(cache, q, name);
+            wait = 0;
+
+        } else {
+            if (--tries) {
+                continue;
+            }
+
+            wait = 1;
+        }
+
+        break;
     }
 
-    cache->sh->cold = 0;
-    cache->sh->loading = 0;
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    ngx_free(name);
+
+    return wait;
+}
+
+
+static time_t
+ngx_http_file_cache_expire(ngx_http_file_cache_t *cache)
+{
+    u_char                      *name, *p;
+    size_t                       len;
+    time_t                       now, wait;
+    ngx_queue_t                 *q;
+    ngx_http_file_cache_node_t  *fcn;
+    u_char                       key[2 * NGX_HTTP_CACHE_KEY_LEN];
+
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache expire");
+
+    name = ngx_alloc(cache->name_len + 1, ngx_cycle->log);
+    if (name == NULL) {
+        return 10;
+    }
+
+    now = ngx_time();
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    for ( ;; ) {
+
+        if (ngx_quit || ngx_terminate) {
+            wait = 1;
+            break;
+        }
+
+        if (ngx_queue_empty(&cache->sh->queue)) {
+            wait = 10;
+            break;
+        }
+
+        q = ngx_queue_last(&cache->sh->queue);
+
+        fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+        wait = fcn->expire - now;
+
+        if (wait > 0) {
+            wait = wait > 10 ? 10 : wait;
+            break;
+        }
+
+        ngx_log_debug6(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                       "http file cache expire: #%d %d %02xd%02xd%02xd%02xd",
+                       fcn->count, fcn->exists,
+                       fcn->key[0], fcn->key[1], fcn->key[2], fcn->key[3]);
+
+        if (fcn->count == 0) {
+            ngx_http_file_cache_delete(cache, q, name);
+            continue;
+        }
+
+        if (fcn->deleting) {
+            wait = 1;
+            break;
+        }
+
+        p = ngx_hex_dump(key, (u_char *) &fcn->node.key,
+                         sizeof(ngx_rbtree_key_t));
+        len = NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t);
+        (void) ngx_hex_dump(p, fcn->key, len);
+
+        /*
+         * abnormally exited workers may leave locked cache entries,
+         * and although it may be safe to remove them completely,
+         * we prefer to just move them to the top of the inactive queue
+         */
+
+        ngx_queue_remove(q);
+        fcn->expire = ngx_time() + cache->inactive;
+        ngx_queue_insert_head(&cache->sh->queue, &fcn->queue);
+
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, 0,
+                      "ignore long locked inactive cache entry %*s, count:%d",
+                      2 * NGX_HTTP_CACHE_KEY_LEN, key, fcn->count);
+    }
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    ngx_free(name);
+
+    return wait;
+}
+
+
+static void
+ngx_http_file_cache_delete(ngx_http_file_cache_t *cache, ngx_queue_t *q,
+    u_char *name)
+{
+    ngx_http_file_cache_node_t  *fcn;
+
+    fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+    if (fcn->exists) {
+        cache->sh->size -= fcn->fs_size;
+        cache->sh->tiers[fcn->tier].size -= fcn->fs_size;
+
+        ngx_http_file_cache_node_name(cache, fcn->tier, fcn, name);
+
+        fcn->count++;
+        fcn->deleting = 1;
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                       "http file cache expire: \"%s\"", name);
+
+        /* an entry restored from a stale index may have no file */
+
+        if (ngx_delete_file(name) == NGX_FILE_ERROR
+            && (cache->index.len == 0 || ngx_errno != NGX_ENOENT))
+        {
+            ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                          ngx_delete_file_n " \"%s\" failed", name);
+        }
+
+        ngx_shmtx_lock(&cache->shpool->mutex);
+        fcn->count--;
+        fcn->deleting = 0;
+    }
+
+    if (fcn->count == 0) {
+        ngx_queue_remove(q);
+        ngx_rbtree_delete(&cache->sh->rbtree, &fcn->node);
+        ngx_slab_free_locked(cache->shpool, fcn);
+    }
+}
+
+
+/*
+ * moves the files of the entries between the tiers: the least recently
+ * used entries are demoted from the tiers over their size, the entries
+ * recently used often enough are promoted to the hottest tier possible
+ */
+
+static void
+ngx_http_file_cache_tiers(ngx_http_file_cache_t *cache)
+{
+    u_char                      *from, *to, *temp;
+    off_t                        size[NGX_HTTP_CACHE_TIERS];
+    ngx_uint_t                   i, n, done, moved;
+    ngx_msec_t                   elapsed;
+    ngx_http_file_cache_move_t  *moves;
+
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache tiers");
+
+    moves = ngx_alloc(NGX_HTTP_CACHE_TIER_MOVES
+                      * sizeof(ngx_http_file_cache_move_t), ngx_cycle->log);
+    if (moves == NULL) {
+        return;
+    }
+
+    from = ngx_alloc(2 * (cache->name_len + 1) + cache->name_len
+                     + sizeof(".") - 1 + NGX_INT64_LEN + 1, ngx_cycle->log);
+    if (from == NULL) {
+        ngx_free(moves);
+        return;
+    }
+
+    to = from + cache->name_len + 1;
+    temp = to + cache->name_len + 1;
+
+    moved = 0;
+
+    for ( ;; ) {
+
+        n = ngx_http_file_cache_tier_moves(cache, moves);
+
+        done = 0;
+
+        for (i = 0; i < n; i++) {
+
+            if (ngx_quit || ngx_terminate) {
+                goto failed;
+            }
+
+            if (ngx_http_file_cache_move(cache, &moves[i], from, to, temp)
+                == NGX_OK)
+            {
+                done++;
+            }
+
+            if (++cache->files >= cache->loader_files) {
+                ngx_http_file_cache_loader_sleep(cache);
+
+            } else {
+                ngx_time_update();
+
+                elapsed = ngx_abs((ngx_msec_int_t)
+                                  (ngx_current_msec - cache->last));
+
+                if (elapsed >= cache->loader_threshold) {
+                    ngx_http_file_cache_loader_sleep(cache);
+                }
+            }
+        }
+
+        moved += done;
+
+        /* the moves made may make room for the next ones */
+
+        if (done == 0 || moved >= NGX_HTTP_CACHE_TIER_WINDOW) {
+            break;
+        }
+    }
+
+    if (moved == 0) {
+        goto failed;
+    }
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    for (i = 0; i < cache->ntiers; i++) {
+        size[i] = cache->sh->tiers[i].size;
+    }
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    for (i = 0; i < cache->ntiers; i++) {
+        ngx_log_error(NGX_LOG_INFO, ngx_cycle->log, 0,
+                      "http file cache tier %ui: %V %.3fM, hits: %uA, "
+                      "promoted: %uA, demoted: %uA",
+                      i, &cache->tiers[i].path->name,
+                      ((double) size[i] * cache->bsize) / (1024 * 1024),
+                      cache->sh->tiers[i].hits,
+                      cache->sh->tiers[i].promoted,
+                      cache->sh->tiers[i].demoted);
+    }
+
+failed:
+
+    ngx_free(from);
+    ngx_free(moves);
+}
+
+
+/*
+ * selects the entries to move; the entries to be promoted are searched
+ * for among the most recently used ones only, and the room for them is
+ * made by demoting the entries not used since or not used often enough
+ */
+
+static ngx_uint_t
+ngx_http_file_cache_tier_moves(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_move_t *moves)
+{
+    off_t                        size[NGX_HTTP_CACHE_TIERS];
+    off_t                        need[NGX_HTTP_CACHE_TIERS];
+    ngx_uint_t                   n, t, scanned, recent;
+    ngx_queue_t                 *q, *window;
+    ngx_http_file_cache_node_t  *fcn;
+
+    n = 0;
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    for (t = 0; t < cache->ntiers; t++) {
+        size[t] = cache->sh->tiers[t].size;
+        need[t] = 0;
+    }
+
+    /* the tiers over their size */
+
+    for (t = cache->ntiers - 1; t > 0; t--) {
+
+        for (q = ngx_queue_last(&cache->sh->queue);
+             q != ngx_queue_sentinel(&cache->sh->queue)
+             && size[t] > cache->tiers[t].max_size
+             && n < NGX_HTTP_CACHE_TIER_MOVES;
+             q = ngx_queue_prev(q))
+        {
+            fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+            if (fcn->tier != t
+                || !fcn->exists || fcn->updating || fcn->deleting)
+            {
+                continue;
+            }
+
+            ngx_memcpy(moves[n].key, &fcn->node.key, sizeof(ngx_rbtree_key_t));
+            ngx_memcpy(&moves[n].key[sizeof(ngx_rbtree_key_t)], fcn->key,
+                       NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+            moves[n].from = t;
+            moves[n].to = t - 1;
+            n++;
+
+            size[t] -= fcn->fs_size;
+            size[t - 1] += fcn->fs_size;
+        }
+    }
+
+    /* the promotions */
+
+    scanned = 0;
+
+    for (q = ngx_queue_head(&cache->sh->queue);
+         q != ngx_queue_sentinel(&cache->sh->queue)
+         && scanned < NGX_HTTP_CACHE_TIER_WINDOW
+         && n < NGX_HTTP_CACHE_TIER_MOVES;
+         q = ngx_queue_next(q), scanned++)
+    {
+        fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+        if (!fcn->exists || fcn->updating || fcn->deleting) {
+            continue;
+        }
+
+        for (t = cache->ntiers - 1; t > fcn->tier; t--) {
+
+            if (fcn->uses < cache->tiers[t].min_uses
+                || fcn->fs_size > cache->tiers[t].max_size)
+            {
+                continue;
+            }
+
+            /* a tier colder is tried meanwhile */
+
+            if (size[t] + fcn->fs_size > cache->tiers[t].max_size) {
+                need[t] += fcn->fs_size;
+                continue;
+            }
+
+            ngx_memcpy(moves[n].key, &fcn->node.key, sizeof(ngx_rbtree_key_t));
+            ngx_memcpy(&moves[n].key[sizeof(ngx_rbtree_key_t)], fcn->key,
+                       NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+            moves[n].from = fcn->tier;
+            moves[n].to = t;
+            n++;
+
+            size[fcn->tier] -= fcn->fs_size;
+            size[t] += fcn->fs_size;
+
+            break;
+        }
+    }
+
+    /* the last entry scanned */
+
+    window = ngx_queue_prev(q);
+
+    for (t = cache->ntiers - 1; t > 0; t--) {
+
+        if (need[t] == 0) {
+            continue;
+        }
+
+        need[t] -= cache->tiers[t].max_size - size[t];
+        recent = 0;
+
+        for (q = ngx_queue_last(&cache->sh->queue);
+             q != ngx_queue_sentinel(&cache->sh->queue)
+             && need[t] > 0
+             && n < NGX_HTTP_CACHE_TIER_MOVES;
+             q = ngx_queue_prev(q))
+        {
+            if (q == window) {
+                recent = 1;
+            }
+
+            fcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+            if (fcn->tier != t
+                || !fcn->exists || fcn->updating || fcn->deleting)
+            {
+                continue;
+            }
+
+            /* the recently used entries are kept if used often enough */
+
+            if (recent && fcn->uses >= cache->tiers[t].min_uses) {
+                continue;
+            }
+
+            ngx_memcpy(moves[n].key, &fcn->node.key, sizeof(ngx_rbtree_key_t));
+            ngx_memcpy(&moves[n].key[sizeof(ngx_rbtree_key_t)], fcn->key,
+                       NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+            moves[n].from = t;
+            moves[n].to = t - 1;
+            n++;
+
+            need[t] -= fcn->fs_size;
+        }
+    }
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    return n;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_move(ngx_http_file_cache_t *cache,
+    ngx_http_file_cache_move_t *move, u_char *from, u_char *to, u_char *temp)
+{
+    ngx_err_t                    err;
+    ngx_int_t                    rc;
+    ngx_file_uniq_t              uniq, nuniq;
+    ngx_copy_file_t              cf;
+    ngx_file_info_t              fi;
+    ngx_http_file_cache_node_t  *fcn;
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    fcn = ngx_http_file_cache_lookup(cache, move->key);
+
+    if (fcn == NULL || fcn->tier != move->from
+        || !fcn->exists || fcn->updating || fcn->deleting)
+    {
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+        return NGX_DECLINED;
+    }
+
+    uniq = fcn->uniq;
+
+    ngx_http_file_cache_node_name(cache, move->from, fcn, from);
+    ngx_http_file_cache_node_name(cache, move->to, fcn, to);
+
+    /* the entry is not freed while the file is copied */
+
+    fcn->count++;
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    ngx_log_debug3(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache move: \"%s\" to tier %ui \"%s\"",
+                   from, move->to, to);
+
+    /* the file is copied aside and renamed when complete */
+
+    (void) ngx_sprintf(temp, "%s.%P%Z", to, ngx_pid);
+
+    rc = NGX_ERROR;
+    nuniq = 0;
+
+    cf.size = -1;
+    cf.buf_size = 0;
+    cf.access = NGX_FILE_OWNER_ACCESS;
+    cf.time = -1;
+    cf.log = ngx_cycle->log;
+
+    err = ngx_create_full_path(temp, ngx_dir_access(NGX_FILE_OWNER_ACCESS));
+
+    if (err) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, err,
+                      ngx_create_dir_n " \"%s\" failed", temp);
+
+    } else if (ngx_copy_file(from, temp, &cf) == NGX_OK) {
+
+        if (ngx_file_info(temp, &fi) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                          ngx_file_info_n " \"%s\" failed", temp);
+
+        } else if (ngx_rename_file(temp, to) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                          ngx_rename_file_n " \"%s\" to \"%s\" failed",
+                          temp, to);
+
+        } else {
+            nuniq = ngx_file_uniq(&fi);
+            rc = NGX_DECLINED;
+        }
+    }
+
+    if (rc == NGX_ERROR
+        && ngx_delete_file(temp) == NGX_FILE_ERROR
+        && ngx_errno != NGX_ENOENT)
+    {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", temp);
+    }
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    fcn->count--;
+
+    /* the entry may have been updated or purged meanwhile */
+
+    if (rc == NGX_DECLINED
+        && fcn->exists && !fcn->deleting
+        && fcn->uniq == uniq && fcn->tier == move->from)
+    {
+        fcn->tier = move->to;
+        fcn->uniq = nuniq;
+
+        cache->sh->tiers[move->from].size -= fcn->fs_size;
+        cache->sh->tiers[move->to].size += fcn->fs_size;
+
+        if (move->to > move->from) {
+            cache->sh->tiers[move->to].promoted++;
+
+        } else {
+            cache->sh->tiers[move->from].demoted++;
+        }
+
+        rc = NGX_OK;
+    }
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    if (rc == NGX_ERROR) {
+        return NGX_ERROR;
+    }
+
+    if (rc == NGX_DECLINED) {
+
+        /* the copy is removed unless it was replaced already */
+
+        if (ngx_file_info(to, &fi) == NGX_FILE_ERROR
+            || ngx_file_uniq(&fi) != nuniq)
+        {
+            return NGX_DECLINED;
+        }
+
+        from = to;
+    }
+
+    if (ngx_delete_file(from) == NGX_FILE_ERROR && ngx_errno != NGX_ENOENT) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", from);
+    }
+
+    return rc;
+}
+
+
+static time_t
+ngx_http_file_cache_manager(void *data)
+{
+    ngx_http_file_cache_t  *cache = data;
+
+    off_t   size;
+    time_t  next, wait;
+
+    next = ngx_http_file_cache_expire(cache);
+
+    cache->last = ngx_current_msec;
+    cache->files = 0;
+
+    if (!ngx_queue_empty(&cache->sh->purges)
+        && ngx_http_file_cache_purge_walk(cache) == NGX_AGAIN)
+    {
+        next = 1;
+    }
+
+    if (cache->ntiers > 1 && !cache->sh->cold) {
+        ngx_http_file_cache_tiers(cache);
+    }
+
+    if (cache->index.len) {
+
+        if (cache->index_next == 0) {
+            cache->index_next = ngx_time() + cache->index_interval;
+
+        } else if (ngx_time() >= cache->index_next && !cache->sh->cold) {
+            ngx_http_file_cache_save_index(cache);
+            cache->index_next = ngx_time() + cache->index_interval;
+        }
+    }
+
+    for ( ;; ) {
+        ngx_shmtx_lock(&cache->shpool->mutex);
+
+        size = cache->sh->size;
+
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                       "http file cache size: %O", size);
+
+        if (size < cache->max_size) {
+            return next;
+        }
+
+        wait = ngx_http_file_cache_forced_expire(cache);
+
+        if (wait > 0) {
+            return wait;
+        }
+
+        if (ngx_quit || ngx_terminate) {
+            return next;
+        }
+    }
+}
+
+
+static void
+ngx_http_file_cache_loader(void *data)
+{
+    ngx_http_file_cache_t  *cache = data;
+
+    ngx_uint_t       n;
+    ngx_path_t      *path;
+    ngx_tree_ctx_t   tree;
+    ngx_file_info_t  fi;
+
+    if (!cache->sh->cold || cache->sh->loading) {
+        return;
+    }
+
+    if (!ngx_atomic_cmp_set(&cache->sh->loading, 0, ngx_pid)) {
+        return;
+    }
+
+    ngx_log_debug0(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http file cache loader");
+
+    if (cache->index.len) {
+        cache->index_date = ngx_http_file_cache_load_index(cache);
+
+        if (ngx_quit || ngx_terminate) {
+            cache->sh->loading = 0;
+            return;
+        }
+    }
+
+    tree.init_handler = NULL;
+    tree.file_handler = ngx_http_file_cache_manage_file;
+    tree.pre_tree_handler = ngx_http_file_cache_manage_directory;
+    tree.post_tree_handler = ngx_http_file_cache_noop;
+    tree.spec_handler = ngx_http_file_cache_delete_file;
+    tree.data = cache;
+    tree.alloc = 0;
+    tree.log = ngx_cycle->log;
+
+    cache->last = ngx_current_msec;
+    cache->files = 0;
+
+    for (n = 0; n < cache->ntiers; n++) {
+        path = cache->tiers[n].path;
+
+        if (cache->index_date && path->level[0] == 0) {
+
+            /* without levels the files are in the cache directory itself */
+
+            if (ngx_file_info(path->name.data, &fi) != NGX_FILE_ERROR
+                && ngx_file_mtime(&fi) < cache->index_date)
+            {
+                continue;
+            }
+        }
+
+        cache->loader_tier = n;
+
+        if (ngx_walk_tree(&tree, &path->name) == NGX_ABORT) {
+            cache->sh->loading = 0;
+            return;
+        }
+    }
+
+    cache->sh->cold = 0;
+    cache->sh->loading = 0;
+
+    ngx_log_error(NGX_LOG_NOTICE, ngx_cycle->log, 0,
+                  "http file cache: %V %.3fM, bsize: %uz",
+                  &cache->path->name,
+                  ((double) cache->sh->size * cache->bsize) / (1024 * 1024),
+                  cache->bsize);
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_noop(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_manage_file(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    ngx_msec_t              elapsed;
+    ngx_http_file_cache_t  *cache;
+
+    cache = ctx->data;
+
+    /*
+     * the index and its temporary copies may be kept in the cache
+     * or a tier directory, as the cache manager can write there
+     */
+
+    if (cache->index.len
+        && path->len >= cache->index.len
+        && ngx_strncmp(path->data, cache->index.data, cache->index.len) == 0
+        && (path->len == cache->index.len
+            || path->data[cache->index.len] == '.'))
+    {
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ctx->log, 0,
+                       "http file cache skip index: \"%s\"", path->data);
+
+        return NGX_OK;
+    }
+
+    if (ngx_http_file_cache_add_file(ctx, path) != NGX_OK) {
+        (void) ngx_http_file_cache_delete_file(ctx, path);
+    }
+
+    if (++cache->files >= cache->loader_files) {
+        ngx_http_file_cache_loader_sleep(cache);
+
+    } else {
+        ngx_time_update();
+
+        elapsed = ngx_abs((ngx_msec_int_t) (ngx_current_msec - cache->last));
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                       "http file cache loader time elapsed: %M", elapsed);
+
+        if (elapsed >= cache->loader_threshold) {
+            ngx_http_file_cache_loader_sleep(cache);
+        }
+    }
+
+    return (ngx_quit || ngx_terminate) ? NGX_ABORT : NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_manage_directory(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    u_char                 *p, *last;
+    ngx_uint_t              n, depth;
+    ngx_http_file_cache_t  *cache;
+
+    if (path->len >= 5
+        && ngx_strncmp(path->data + path->len - 5, "/temp", 5) == 0)
+    {
+        return NGX_DECLINED;
+    }
+
+    cache = ctx->data;
+
+    if (cache->index_date == 0 || ctx->mtime >= cache->index_date) {
+        return NGX_OK;
+    }
+
+    /*
+     * the files of a directory of the last level not modified
+     * since the index was saved are known from the index already
+     */
+
+    for (n = 0; n < NGX_MAX_PATH_LEVEL && cache->path->level[n]; n++) {
+        /* void */
+    }
+
+    depth = 0;
+    last = path->data + path->len;
+
+    p = path->data + cache->tiers[cache->loader_tier].path->name.len;
+
+    for ( /* void */ ; p < last; p++) {
+        if (*p == '/') {
+            depth++;
+        }
+    }
+
+    if (depth == n) {
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ctx->log, 0,
+                       "http file cache skip directory: \"%s\"", path->data);
+        return NGX_DECLINED;
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_file_cache_loader_sleep(ngx_http_file_cache_t *cache)
+{
+    ngx_msleep(cache->loader_sleep);
+
+    ngx_time_update();
+
+    cache->last = ngx_current_msec;
+    cache->files = 0;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_add_file(ngx_tree_ctx_t *ctx, ngx_str_t *name)
+{
+    u_char                      *p, *known;
+    ngx_int_t                    n, rc;
+    ngx_uint_t                   i, tier;
+    ngx_file_info_t              fi;
+    ngx_http_cache_t             c;
+    ngx_http_file_cache_t       *cache;
+    ngx_http_file_cache_node_t  *fcn;
+
+    if (name->len < 2 * NGX_HTTP_CACHE_KEY_LEN) {
+        return NGX_ERROR;
+    }
+
+    if (ctx->size < (off_t) sizeof(ngx_http_file_cache_header_t)) {
+        ngx_log_error(NGX_LOG_CRIT, ctx->log, 0,
+                      "cache file \"%s\" is too small", name->data);
+        return NGX_ERROR;
+    }
+
+    ngx_memzero(&c, sizeof(ngx_http_cache_t));
+    cache = ctx->data;
+
+    c.length = ctx->size;
+    c.fs_size = (ctx->fs_size + cache->bsize - 1) / cache->bsize;
+
+    p = &name->data[name->len - 2 * NGX_HTTP_CACHE_KEY_LEN];
+
+    for (i = 0; i < NGX_HTTP_CACHE_KEY_LEN; i++) {
+        n = ngx_hextoi(p, 2);
+
+        if (n == NGX_ERROR) {
+            return NGX_ERROR;
+        }
+
+        p += 2;
+
+        c.key[i] = (u_char) n;
+    }
+
+    c.tier = cache->loader_tier;
+
+    rc = ngx_http_file_cache_add(cache, &c);
+
+    if (rc != NGX_DECLINED) {
+        return rc;
+    }
+
+    /*
+     * the entry is known in another tier already: either a move was
+     * interrupted, or the entry was moved after the index was saved;
+     * the file found is kept only if the known one does not exist
+     */
+
+    known = ngx_alloc(cache->name_len + 1, ctx->log);
+    if (known == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    fcn = ngx_http_file_cache_lookup(cache, c.key);
+
+    if (fcn == NULL) {
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+        ngx_free(known);
+        return NGX_ERROR;
+    }
+
+    tier = fcn->tier;
+
+    ngx_http_file_cache_node_name(cache, tier, fcn, known);
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    if (ngx_file_info(known, &fi) != NGX_FILE_ERROR) {
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ctx->log, 0,
+                       "http file cache duplicate: \"%s\"", name->data);
+        ngx_free(known);
+        return NGX_ERROR;
+    }
+
+    ngx_free(known);
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    fcn = ngx_http_file_cache_lookup(cache, c.key);
+
+    if (fcn && fcn->tier == tier) {
+        cache->sh->tiers[tier].size -= fcn->fs_size;
+        cache->sh->tiers[c.tier].size += fcn->fs_size;
+        fcn->tier = c.tier;
+    }
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_add(ngx_http_file_cache_t *cache, ngx_http_cache_t *c)
+{
+    ngx_http_file_cache_node_t  *fcn;
+
+    ngx_shmtx_lock(&cache->shpool->mutex);
+
+    fcn = ngx_http_file_cache_lookup(cache, c->key);
+
+    if (fcn == NULL) {
+
+        fcn = ngx_slab_calloc_locked(cache->shpool,
+                                     sizeof(ngx_http_file_cache_node_t));
+        if (fcn == NULL) {
+            ngx_shmtx_unlock(&cache->shpool->mutex);
+            return NGX_ERROR;
+        }
+
+        ngx_memcpy((u_char *) &fcn->node.key, c->key, sizeof(ngx_rbtree_key_t));
+
+        ngx_memcpy(fcn->key, &c->key[sizeof(ngx_rbtree_key_t)],
+                   NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+
+        ngx_rbtree_insert(&cache->sh->rbtree, &fcn->node);
+
+        fcn->uses = 1;
+        fcn->exists = 1;
+        fcn->fs_size = c->fs_size;
+        fcn->tier = c->tier;
+
+        cache->sh->size += c->fs_size;
+        cache->sh->tiers[c->tier].size += c->fs_size;
+
+    } else if (fcn->tier != c->tier) {
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+        return NGX_DECLINED;
+
+    } else {
+        ngx_queue_remove(&fcn->queue);
+    }
+
+    fcn->expire = ngx_time() + cache->inactive;
+
+    ngx_queue_insert_head(&cache->sh->queue, &fcn->queue);
+
+    ngx_shmtx_unlock(&cache->shpool->mutex);
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_file_cache_delete_file(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ctx->log, 0,
+                   "http file cache delete: \"%s\"", path->data);
+
+    if (ngx_delete_file(path->data) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_CRIT, ctx->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", path->data);
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_file_cache_save_index(void *data)
+{
+    ngx_http_file_cache_t  *cache = data;
+
+    u_char                              *name;
+    ssize_t                              n;
+    ngx_uint_t                           i, count, done;
+    ngx_file_t                           file;
+    ngx_rbtree_t                        *tree;
+    ngx_rbtree_node_t                   *node, *last;
+    ngx_http_file_cache_node_t          *fcn;
+    ngx_http_file_cache_index_entry_t   *entries;
+    ngx_http_file_cache_index_header_t   h;
+    u_char                               key[NGX_HTTP_CACHE_KEY_LEN];
+
+    if (cache->index.len == 0 || cache->sh->cold) {
+        return;
+    }
+
+    name = ngx_alloc(cache->index.len + 1 + NGX_INT64_LEN + 1,
+                     ngx_cycle->log);
+    if (name == NULL) {
+        return;
+    }
+
+    entries = ngx_alloc(NGX_HTTP_CACHE_INDEX_CHUNK
+                        * sizeof(ngx_http_file_cache_index_entry_t),
+                        ngx_cycle->log);
+    if (entries == NULL) {
+        ngx_free(name);
+        return;
+    }
+
+    /* the index is written aside and renamed when complete */
+
+    (void) ngx_sprintf(name, "%V.%P%Z", &cache->index, ngx_pid);
+
+    ngx_memzero(&file, sizeof(ngx_file_t));
+
+    file.name.len = ngx_strlen(name);
+    file.name.data = name;
+    file.log = ngx_cycle->log;
+
+    file.fd = ngx_open_file(name, NGX_FILE_WRONLY, NGX_FILE_TRUNCATE,
+                            NGX_FILE_DEFAULT_ACCESS);
+
+    if (file.fd == NGX_INVALID_FILE) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_open_file_n " \"%s\" failed", name);
+        goto failed;
+    }
+
+    ngx_memzero(&h, sizeof(ngx_http_file_cache_index_header_t));
+
+    h.magic = NGX_HTTP_CACHE_INDEX_MAGIC;
+    h.version = NGX_HTTP_CACHE_VERSION;
+    h.bsize = (uint32_t) cache->bsize;
+    h.date = ngx_time();
+
+    for (i = 0; i < NGX_MAX_PATH_LEVEL; i++) {
+        h.levels[i] = (u_char) cache->path->level[i];
+    }
+
+    count = 0;
+    done = 0;
+
+    tree = &cache->sh->rbtree;
+
+    /*
+     * the tree is copied in chunks to keep the mutex locked for a short
+     * time only, each chunk starts after the last key of the previous one
+     */
+
+    while (!done) {
+
+        ngx_shmtx_lock(&cache->shpool->mutex);
+
+        if (count == 0 && file.offset == 0) {
+            node = (tree->root == tree->sentinel)
+                   ? NULL : ngx_rbtree_min(tree->root, tree->sentinel);
+
+        } else {
+            node = ngx_http_file_cache_index_resume(cache, key);
+        }
+
+        i = 0;
+        last = NULL;
+
+        while (node && i < NGX_HTTP_CACHE_INDEX_CHUNK) {
+            fcn = (ngx_http_file_cache_node_t *) node;
+
+            if (fcn->exists) {
+                ngx_memcpy(entries[i].key, &node->key,
+                           sizeof(ngx_rbtree_key_t));
+                ngx_memcpy(&entries[i].key[sizeof(ngx_rbtree_key_t)],
+                           fcn->key,
+                           NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+                entries[i].fs_size = fcn->fs_size;
+                entries[i].tier = fcn->tier;
+                i++;
+            }
+
+            last = node;
+            node = ngx_http_file_cache_index_next(tree, node);
+        }
+
+        if (node == NULL) {
+            done = 1;
+
+        } else {
+            fcn = (ngx_http_file_cache_node_t *) last;
+
+            ngx_memcpy(key, &last->key, sizeof(ngx_rbtree_key_t));
+            ngx_memcpy(&key[sizeof(ngx_rbtree_key_t)], fcn->key,
+                       NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+        }
+
+        ngx_shmtx_unlock(&cache->shpool->mutex);
+
+        if (file.offset == 0) {
+            file.offset = sizeof(ngx_http_file_cache_index_header_t);
+        }
+
+        n = i * sizeof(ngx_http_file_cache_index_entry_t);
 
-    ngx_log_error(NGX_LOG_NOTICE, ngx_cycle->log, 0,
-                  "http file cache: %V %.3fM, bsize: %uz",
-                  &cache->path->name,
-                  ((double) cache->sh->size * cache->bsize) / (1024 * 1024),
-                  cache->bsize);
-}
+        if (n && ngx_write_file(&file, (u_char *) entries, n, file.offset)
+                 != n)
+        {
+            goto failed;
+        }
 
+        count += i;
+    }
 
-static ngx_int_t
-ngx_http_file_cache_noop(ngx_tree_ctx_t *ctx, ngx_str_t *path)
-{
-    return NGX_OK;
-}
+    h.count = count;
 
+    if (ngx_write_file(&file, (u_char *) &h, sizeof(h), 0)
+        != (ssize_t) sizeof(h))
+    {
+        goto failed;
+    }
 
-static ngx_int_t
-ngx_http_file_cache_manage_file(ngx_tree_ctx_t *ctx, ngx_str_t *path)
-{
-    ngx_msec_t              elapsed;
-    ngx_http_file_cache_t  *cache;
+    if (ngx_close_file(file.fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      ngx_close_file_n " \"%s\" failed", name);
+    }
 
-    cache = ctx->data;
+    file.fd = NGX_INVALID_FILE;
 
-    if (ngx_http_file_cache_add_file(ctx, path) != NGX_OK) {
-        (void) ngx_http_file_cache_delete_file(ctx, path);
+    if (ngx_rename_file(name, cache->index.data) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_rename_file_n " \"%s\" to \"%s\" failed",
+                      name, cache->index.data);
+        goto failed;
     }
 
-    if (++cache->files >= cache->loader_files) {
-        ngx_http_file_cache_loader_sleep(cache);
+    ngx_log_error(NGX_LOG_NOTICE, ngx_cycle->log, 0,
+                  "http file cache index: \"%V\", %ui entries",
+                  &cache->index, count);
 
-    } else {
-        ngx_time_update();
+    ngx_free(entries);
+    ngx_free(name);
 
-        elapsed = ngx_abs((ngx_msec_int_t) (ngx_current_msec - cache->last));
+    return;
 
-        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
-                       "http file cache loader time elapsed: %M", elapsed);
+failed:
 
-        if (elapsed >= cache->loader_threshold) {
-            ngx_http_file_cache_loader_sleep(cache);
+    if (file.fd != NGX_INVALID_FILE) {
+        if (ngx_close_file(file.fd) == NGX_FILE_ERROR) {
+            ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                          ngx_close_file_n " \"%s\" failed", name);
         }
     }
 
-    return (ngx_quit || ngx_terminate) ? NGX_ABORT : NGX_OK;
+    if (ngx_delete_file(name) == NGX_FILE_ERROR && ngx_errno != NGX_ENOENT) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", name);
+    }
+
+    ngx_free(entries);
+    ngx_free(name);
 }
 
 
-static ngx_int_t
-ngx_http_file_cache_manage_directory(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+static time_t
+ngx_http_file_cache_load_index(ngx_http_file_cache_t *cache)
 {
-    if (path->len >= 5
-        && ngx_strncmp(path->data + path->len - 5, "/temp", 5) == 0)
-    {
-        return NGX_DECLINED;
+    u_char                              *addr;
+    size_t                               size;
+    time_t                               date;
+    ngx_fd_t                             fd;
+    ngx_err_t                            err;
+    ngx_uint_t                           i;
+    ngx_file_info_t                      fi;
+    ngx_http_cache_t                     c;
+    ngx_http_file_cache_index_entry_t   *entry;
+    ngx_http_file_cache_index_header_t  *h;
+
+    fd = ngx_open_file(cache->index.data, NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        err = ngx_errno;
+
+        if (err != NGX_ENOENT) {
+            ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, err,
+                          ngx_open_file_n " \"%V\" failed", &cache->index);
+        }
+
+        return 0;
     }
 
-    return NGX_OK;
-}
+    date = 0;
+    addr = NULL;
+    size = 0;
 
+    if (ngx_fd_info(fd, &fi) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      ngx_fd_info_n " \"%V\" failed", &cache->index);
+        goto done;
+    }
 
-static void
-ngx_http_file_cache_loader_sleep(ngx_http_file_cache_t *cache)
-{
-    ngx_msleep(cache->loader_sleep);
+    size = (size_t) ngx_file_size(&fi);
 
-    ngx_time_update();
+    if (size < sizeof(ngx_http_file_cache_index_header_t)) {
+        goto invalid;
+    }
 
-    cache->last = ngx_current_msec;
-    cache->files = 0;
-}
+    addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
 
+    if (addr == MAP_FAILED) {
+        ngx_log_error(NGX_LOG_CRIT, ngx_cycle->log, ngx_errno,
+                      "mmap(%uz) \"%V\" failed", size, &cache->index);
+        addr = NULL;
+        goto done;
+    }
 
-static ngx_int_t
-ngx_http_file_cache_add_file(ngx_tree_ctx_t *ctx, ngx_str_t *name)
-{
-    u_char                 *p;
-    ngx_int_t               n;
-    ngx_uint_t              i;
-    ngx_http_cache_t        c;
-    ngx_http_file_cache_t  *cache;
+    h = (ngx_http_file_cache_index_header_t *) addr;
 
-    if (name->len < 2 * NGX_HTTP_CACHE_KEY_LEN) {
-        return NGX_ERROR;
+    if (h->magic != NGX_HTTP_CACHE_INDEX_MAGIC
+        || h->version != NGX_HTTP_CACHE_VERSION
+        || h->bsize != cache->bsize
+        || size != sizeof(ngx_http_file_cache_index_header_t)
+                   + h->count * sizeof(ngx_http_file_cache_index_entry_t))
+    {
+        goto invalid;
     }
 
-    if (ctx->size < (off_t) sizeof(ngx_http_file_cache_header_t)) {
-        ngx_log_error(NGX_LOG_CRIT, ctx->log, 0,
-                      "cache file \"%s\" is too small", name->data);
-        return NGX_ERROR;
+    for (i = 0; i < NGX_MAX_PATH_LEVEL; i++) {
+        if (h->levels[i] != cache->path->level[i]) {
+            goto invalid;
+        }
     }
 
+    entry = (ngx_http_file_cache_index_entry_t *)
+                (addr + sizeof(ngx_http_file_cache_index_header_t));
+
     ngx_memzero(&c, sizeof(ngx_http_cache_t));
-    cache = ctx->data;
 
-    c.length = ctx->size;
-    c.fs_size = (ctx->fs_size + cache->bsize - 1) / cache->bsize;
+    for (i = 0; i < h->count; i++) {
 
-    p = &name->data[name->len - 2 * NGX_HTTP_CACHE_KEY_LEN];
+        if ((i % NGX_HTTP_CACHE_INDEX_CHUNK) == 0
+            && (ngx_quit || ngx_terminate))
+        {
+            goto done;
+        }
 
-    for (i = 0; i < NGX_HTTP_CACHE_KEY_LEN; i++) {
-        n = ngx_hextoi(p, 2);
+        /* the files of the tiers no longer configured are not known */
 
-        if (n == NGX_ERROR) {
-            return NGX_ERROR;
+        if (entry[i].tier >= cache->ntiers) {
+            continue;
         }
 
-        p += 2;
+        ngx_memcpy(c.key, entry[i].key, NGX_HTTP_CACHE_KEY_LEN);
+        c.fs_size = entry[i].fs_size;
+        c.tier = entry[i].tier;
 
-        c.key[i] = (u_char) n;
+        if (ngx_http_file_cache_add(cache, &c) == NGX_ERROR) {
+
+            /* the keys zone is full, the whole tree is to be walked */
+
+            ngx_log_error(NGX_LOG_WARN, ngx_cycle->log, 0,
+                          "cache index \"%V\" is loaded partially",
+                          &cache->index);
+            goto done;
+        }
     }
 
-    return ngx_http_file_cache_add(cache, &c);
-}
+    date = h->date;
 
+    ngx_log_error(NGX_LOG_NOTICE, ngx_cycle->log, 0,
+                  "http file cache index: \"%V\" loaded, %ui entries",
+                  &cache->index, h->count);
 
-static ngx_int_t
-ngx_http_file_cache_add(ngx_http_file_cache_t *cache, ngx_http_cache_t *c)
-{
-    ngx_http_file_cache_node_t  *fcn;
+    goto done;
 
-    ngx_shmtx_lock(&cache->shpool->mutex);
+invalid:
 
-    fcn = ngx_http_file_cache_lookup(cache, c->key);
+    ngx_log_error(NGX_LOG_WARN, ngx_cycle->log, 0,
+                  "cache index \"%V\" is invalid, ignored", &cache->index);
 
-    if (fcn == NULL) {
+done:
 
-        fcn = ngx_slab_calloc_locked(cache->shpool,
-                                     sizeof(ngx_http_file_cache_node_t));
-        if (fcn == NULL) {
-            ngx_shmtx_unlock(&cache->shpool->mutex);
-            return NGX_ERROR;
-        }
+    if (addr && munmap(addr, size) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "munmap(%uz) \"%V\" failed", size, &cache->index);
+    }
 
-        ngx_memcpy((u_char *) &fcn->node.key, c->key, sizeof(ngx_rbtree_key_t));
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      ngx_close_file_n " \"%V\" failed", &cache->index);
+    }
 
-        ngx_memcpy(fcn->key, &c->key[sizeof(ngx_rbtree_key_t)],
-                   NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+    return date;
+}
 
-        ngx_rbtree_insert(&cache->sh->rbtree, &fcn->node);
 
-        fcn->uses = 1;
-        fcn->exists = 1;
-        fcn->fs_size = c->fs_size;
+static ngx_rbtree_node_t *
+ngx_http_file_cache_index_next(ngx_rbtree_t *tree, ngx_rbtree_node_t *node)
+{
+    ngx_rbtree_node_t  *root, *sentinel, *parent;
 
-        cache->sh->size += c->fs_size;
+    sentinel = tree->sentinel;
 
-    } else {
-        ngx_queue_remove(&fcn->queue);
+    if (node->right != sentinel) {
+        return ngx_rbtree_min(node->right, sentinel);
     }
 
-    fcn->expire = ngx_time() + cache->inactive;
+    root = tree->root;
 
-    ngx_queue_insert_head(&cache->sh->queue, &fcn->queue);
+    for ( ;; ) {
+        parent = node->parent;
 
-    ngx_shmtx_unlock(&cache->shpool->mutex);
+        if (node == root) {
+            return NULL;
+        }
 
-    return NGX_OK;
+        if (node == parent->left) {
+            return parent;
+        }
+
+        node = parent;
+    }
 }
 
 
-static ngx_int_t
-ngx_http_file_cache_delete_file(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+/* the first node with a key greater than the given one */
+
+static ngx_rbtree_node_t *
+ngx_http_file_cache_index_resume(ngx_http_file_cache_t *cache, u_char *key)
 {
-    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, ctx->log, 0,
-                   "http file cache delete: \"%s\"", path->data);
+    ngx_int_t                    rc;
+    ngx_rbtree_key_t             node_key;
+    ngx_rbtree_node_t           *node, *sentinel, *next;
+    ngx_http_file_cache_node_t  *fcn;
 
-    if (ngx_delete_file(path->data) == NGX_FILE_ERROR) {
-        ngx_log_error(NGX_LOG_CRIT, ctx->log, ngx_errno,
-                      ngx_delete_file_n " \"%s\" failed", path->data);
+    ngx_memcpy((u_char *) &node_key, key, sizeof(ngx_rbtree_key_t));
+
+    node = cache->sh->rbtree.root;
+    sentinel = cache->sh->rbtree.sentinel;
+    next = NULL;
+
+    while (node != sentinel) {
+
+        if (node_key != node->key) {
+            rc = (node_key < node->key) ? -1 : 1;
+
+        } else {
+            fcn = (ngx_http_file_cache_node_t *) node;
+
+            rc = ngx_memcmp(&key[sizeof(ngx_rbtree_key_t)], fcn->key,
+                            NGX_HTTP_CACHE_KEY_LEN - sizeof(ngx_rbtree_key_t));
+        }
+
+        if (rc < 0) {
+            next = node;
+            node = node->left;
+
+        } else {
+            node = node->right;
+        }
     }
 
-    return NGX_OK;
+    return next;
 }
 
 
@@ -2153,17 +3811,21 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 {
     char  *confp = conf;
 
-    off_t                   max_size;
-    u_char                 *last, *p;
-    time_t                  inactive;
-    size_t                  len;
-    ssize_t                 size;
-    ngx_str_t               s, name, *value;
-    ngx_int_t               loader_files;
-    ngx_msec_t              loader_sleep, loader_threshold;
-    ngx_uint_t              i, n, use_temp_path;
-    ngx_array_t            *caches;
-    ngx_http_file_cache_t  *cache, **ce;
+    off_t                        max_size;
+    u_char                      *last, *p;
+    time_t                       inactive;
+    size_t                       len;
+    ssize_t                      size;
+    ngx_str_t                    s, name, *value;
+    ngx_int_t                    loader_files;
+    ngx_msec_t                   loader_sleep, loader_threshold;
+    time_t                       index_interval;
+    ngx_int_t                    uses;
+    ngx_uint_t                   i, n, use_temp_path;
+    ngx_path_t                  *path;
+    ngx_array_t                 *caches;
+    ngx_http_file_cache_t       *cache, **ce;
+    ngx_http_file_cache_tier_t  *tier;
 
     cache = ngx_pcalloc(cf->pool, sizeof(ngx_http_file_cache_t));
     if (cache == NULL) {
@@ -2181,6 +3843,7 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     loader_files = 100;
     loader_sleep = 50;
     loader_threshold = 200;
+    index_interval = 3600;
 
     name.len = 0;
     size = 0;
@@ -2198,6 +3861,9 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         return NGX_CONF_ERROR;
     }
 
+    cache->tiers[0].path = cache->path;
+    cache->ntiers = 1;
+
     for (i = 2; i < cf->args->nelts; i++) {
 
         if (ngx_strncmp(value[i].data, "levels=", 7) == 0) {
@@ -2353,6 +4019,119 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
             continue;
         }
 
+        if (ngx_strncmp(value[i].data, "index=", 6) == 0) {
+
+            cache->index.len = value[i].len - 6;
+            cache->index.data = value[i].data + 6;
+
+            if (cache->index.len == 0) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "invalid index value \"%V\"", &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            if (ngx_conf_full_name(cf->cycle, &cache->index, 0) != NGX_OK) {
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "tier=", 5) == 0) {
+
+            if (cache->ntiers == NGX_HTTP_CACHE_TIERS) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "too many tiers \"%V\"", &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            tier = &cache->tiers[cache->ntiers];
+
+            /* tier=path:max_size:min_uses */
+
+            p = value[i].data + 5;
+            last = value[i].data + value[i].len;
+
+            s.data = p;
+            p = ngx_strlchr(p, last, ':');
+
+            if (p == NULL || p == s.data) {
+                goto invalid_tier;
+            }
+
+            s.len = p - s.data;
+
+            if (s.data[s.len - 1] == '/') {
+                s.len--;
+            }
+
+            tier->path = ngx_pcalloc(cf->pool, sizeof(ngx_path_t));
+            if (tier->path == NULL) {
+                return NGX_CONF_ERROR;
+            }
+
+            tier->path->name.len = s.len;
+            tier->path->name.data = ngx_pnalloc(cf->pool, s.len + 1);
+            if (tier->path->name.data == NULL) {
+                return NGX_CONF_ERROR;
+            }
+
+            ngx_memcpy(tier->path->name.data, s.data, s.len);
+            tier->path->name.data[s.len] = '\0';
+
+            if (ngx_conf_full_name(cf->cycle, &tier->path->name, 0) != NGX_OK) {
+                return NGX_CONF_ERROR;
+            }
+
+            s.data = p + 1;
+            p = ngx_strlchr(s.data, last, ':');
+
+            if (p == NULL) {
+                goto invalid_tier;
+            }
+
+            s.len = p - s.data;
+
+            tier->max_size = ngx_parse_offset(&s);
+            if (tier->max_size <= 0) {
+                goto invalid_tier;
+            }
+
+            /* the uses counter of a node is 10 bits wide */
+
+            uses = ngx_atoi(p + 1, last - p - 1);
+            if (uses == NGX_ERROR || uses == 0 || uses > 1023) {
+                goto invalid_tier;
+            }
+
+            tier->min_uses = uses;
+
+            cache->ntiers++;
+
+            continue;
+
+        invalid_tier:
+
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid tier \"%V\"", &value[i]);
+            return NGX_CONF_ERROR;
+        }
+
+        if (ngx_strncmp(value[i].data, "index_interval=", 15) == 0) {
+
+            s.len = value[i].len - 15;
+            s.data = value[i].data + 15;
+
+            index_interval = ngx_parse_time(&s, 1);
+            if (index_interval == (time_t) NGX_ERROR || index_interval == 0) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid index_interval value \"%V\"", &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
         ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
                            "invalid parameter \"%V\"", &value[i]);
         return NGX_CONF_ERROR;
@@ -2373,11 +4152,44 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     cache->loader_files = loader_files;
     cache->loader_sleep = loader_sleep;
     cache->loader_threshold = loader_threshold;
+    cache->index_interval = index_interval;
+
+    if (cache->index.len) {
+        cache->path->saver = ngx_http_file_cache_save_index;
+    }
 
     if (ngx_add_path(cf, &cache->path) != NGX_OK) {
         return NGX_CONF_ERROR;
     }
 
+    len = cache->path->name.len;
+
+    for (n = 1; n < cache->ntiers; n++) {
+        path = cache->tiers[n].path;
+
+        if (ngx_strcmp(path->name.data, cache->path->name.data) == 0) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "tier \"%V\" is the cache path",
+                               &path->name);
+            return NGX_CONF_ERROR;
+        }
+
+        ngx_memcpy(path->level, cache->path->level, sizeof(path->level));
+
+        path->len = cache->path->len;
+        path->data = cache;
+        path->conf_file = cf->conf_file->file.name.data;
+        path->line = cf->conf_file->line;
+
+        if (ngx_add_path(cf, &cache->tiers[n].path) != NGX_OK) {
+            return NGX_CONF_ERROR;
+        }
+
+        len = ngx_max(len, path->name.len);
+    }
+
+    cache->name_len = len + 1 + cache->path->len + 2 * NGX_HTTP_CACHE_KEY_LEN;
+
     if (!use_temp_path) {
         cache->temp_path = ngx_pcalloc(cf->pool, sizeof(ngx_path_t));
         if (cache->temp_path == NULL) {
@@ -23,6 +23,7 @@
 #define NGX_HTTP_VERSION_9                 9
 #define NGX_HTTP_VERSION_10                1000
 #define NGX_HTTP_VERSION_11                1001
+#define NGX_HTTP_VERSION_20                2000
 
 #define NGX_HTTP_UNKNOWN                   0x0001
 #define NGX_HTTP_GET                       0x0002
@@ -62,6 +63,8 @@
 #define NGX_HTTP_SUBREQUEST_IN_MEMORY      2
 #define NGX_HTTP_SUBREQUEST_WAITED         4
 #define NGX_HTTP_LOG_UNSAFE                8
+#define NGX_HTTP_SUBREQUEST_CLONE          16
+#define NGX_HTTP_SUBREQUEST_BACKGROUND     32
 
 
 #define NGX_HTTP_CONTINUE                  100
@@ -136,6 +139,7 @@
 #define NGX_HTTP_LOWLEVEL_BUFFERED         0xf0
 #define NGX_HTTP_WRITE_BUFFERED            0x10
 #define NGX_HTTP_GZIP_BUFFERED             0x20
+#define NGX_HTTP_BROTLI_BUFFERED           0x40
 #define NGX_HTTP_SSI_BUFFERED              0x01
 #define NGX_HTTP_SUB_BUFFERED              0x02
 #define NGX_HTTP_COPY_BUFFERED             0x04
@@ -270,6 +274,7 @@ typedef struct {
     ngx_array_t                       cache_control;
 
     off_t                             content_length_n;
+    off_t                             content_offset;
     time_t                            date_time;
     time_t                            last_modified_time;
 } ngx_http_headers_out_t;
@@ -285,6 +290,7 @@ typedef struct {
     ngx_chain_t                      *free;
     ngx_chain_t                      *busy;
     ngx_http_chunked_t               *chunked;
+    ngx_http_spill_t                 *spill;
     ngx_http_client_body_handler_pt   post_handler;
 } ngx_http_request_body_t;
 
@@ -434,6 +440,9 @@ struct ngx_http_request_s {
 #if (NGX_HTTP_SPDY)
     ngx_http_spdy_stream_t           *spdy_stream;
 #endif
+#if (NGX_HTTP_V2)
+    ngx_http_v2_stream_t             *stream;
+#endif
 
     ngx_http_log_handler_pt           log_handler;
 
@@ -478,6 +487,9 @@ struct ngx_http_request_s {
     unsigned                          subrequest_in_memory:1;
     unsigned                          waited:1;
 
+    /* 后台子请求: 不参与父请求的输出, 结束时不唤醒父请求 */
+    unsigned                          background:1;
+
 #if (NGX_HTTP_CACHE)
     unsigned                          cached:1;
 #endif
@@ -488,6 +500,11 @@ struct ngx_http_request_s {
     unsigned                          gzip_vary:1;
 #endif
 
+#if (NGX_HTTP_BROTLI)
+    unsigned                          brotli_tested:1;
+    unsigned                          brotli_ok:1;
+#endif
+
     unsigned                          proxy:1;
     unsigned                          bypass_cache:1;
     unsigned                          no_cache:1;
@@ -529,6 +546,7 @@ struct ngx_http_request_s {
     unsigned                          filter_need_in_memory:1;
     unsigned                          filter_need_temporary:1;
     unsigned                          allow_ranges:1;
+    unsigned                          subrequest_ranges:1;
     unsigned                          single_range:1;
     unsigned                          disable_not_modified:1;
 
@@ -48,6 +48,14 @@ ngx_http_read_client_request_body(ngx_http_request_t *r,
     }
 #endif
 
+#if (NGX_HTTP_V2)
+    if (r->stream && r == r->main) {
+        r->request_body_no_buffering = 0;
+        rc = ngx_http_v2_read_request_body(r, post_handler);
+        goto done;
+    }
+#endif
+
     if (r != r->main || r->request_body || r->discard_body) {
         r->request_body_no_buffering = 0;
         post_handler(r);
@@ -442,7 +450,7 @@ ngx_http_do_read_client_request_body(ngx_http_request_t *r)
         ngx_del_timer(c->read);
     }
 
-    if (rb->temp_file || r->request_body_in_file_only) {
+    if (rb->temp_file || rb->spill || r->request_body_in_file_only) {
 
         /* save the last part */
 
@@ -450,7 +458,9 @@ ngx_http_do_read_client_request_body(ngx_http_request_t *r)
             return NGX_HTTP_INTERNAL_SERVER_ERROR;
         }
 
-        if (rb->temp_file->file.offset != 0) {
+        cl = NULL;
+
+        if (rb->temp_file && rb->temp_file->file.offset != 0) {
 
             cl = ngx_chain_get_free_buf(r->pool, &rb->free);
             if (cl == NULL) {
@@ -464,12 +474,17 @@ ngx_http_do_read_client_request_body(ngx_http_request_t *r)
             b->in_file = 1;
             b->file_last = rb->temp_file->file.offset;
             b->file = &rb->temp_file->file;
+        }
 
-            rb->bufs = cl;
+        if (rb->spill) {
 
-        } else {
-            rb->bufs = NULL;
+            /* the spilled part precedes the one in the temporary file */
+
+            *rb->spill->last = cl;
+            cl = rb->spill->bufs;
         }
+
+        rb->bufs = cl;
     }
 
     if (!r->request_body_no_buffering) {
@@ -485,6 +500,7 @@ static ngx_int_t
 ngx_http_write_request_body(ngx_http_request_t *r)
 {
     ssize_t                    n;
+    ngx_int_t                  rc;
     ngx_chain_t               *cl, *ln;
     ngx_temp_file_t           *tf;
     ngx_http_request_body_t   *rb;
@@ -495,6 +511,26 @@ ngx_http_write_request_body(ngx_http_request_t *r)
     ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
                    "http write client request body, bufs %p", rb->bufs);
 
+    if (rb->temp_file == NULL && !r->request_body_in_file_only) {
+
+        if (rb->bufs == NULL) {
+            /* the last part of a spilled body was empty */
+            return NGX_OK;
+        }
+
+        /* try the spill store before resorting to a temporary file */
+
+        rc = ngx_http_spill_write(r, rb->bufs);
+
+        if (rc == NGX_ERROR) {
+            return NGX_ERROR;
+        }
+
+        if (rc == NGX_OK) {
+            goto written;
+        }
+    }
+
     if (rb->temp_file == NULL) {
         tf = ngx_pcalloc(r->pool, sizeof(ngx_temp_file_t));
         if (tf == NULL) {
@@ -546,6 +582,8 @@ ngx_http_write_request_body(ngx_http_request_t *r)
 
     rb->temp_file->offset += n;
 
+written:
+
     /* mark all buffers as written */
 
     for (cl = rb->bufs; cl; /* void */) {
@@ -577,6 +615,13 @@ ngx_http_discard_request_body(ngx_http_request_t *r)
     }
 #endif
 
+#if (NGX_HTTP_V2)
+    if (r->stream && r == r->main) {
+        r->stream->skip_data = NGX_HTTP_V2_DATA_DISCARD;
+        return NGX_OK;
+    }
+#endif
+
     if (r != r->main || r->discard_body || r->request_body) {
         return NGX_OK;
     }
@@ -0,0 +1,612 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+static ngx_int_t ngx_http_spill_reserve(ngx_http_request_t *r,
+    ngx_http_spill_store_t *store, ngx_uint_t n);
+static ngx_int_t ngx_http_spill_add_segment(ngx_http_request_t *r,
+    ngx_http_spill_store_t *store);
+static void ngx_http_spill_release_segment(ngx_http_spill_store_t *store,
+    ngx_http_spill_segment_t *segment);
+static ngx_buf_t *ngx_http_spill_get_block(ngx_http_request_t *r,
+    ngx_http_spill_t *spill);
+static void ngx_http_spill_cleanup(void *data);
+static void ngx_http_spill_free_shm(void *data);
+
+
+/*
+ * Returns NGX_DECLINED if there is no store or its budget is exhausted,
+ * the caller is expected to fall back to a temporary file then.
+ * Either the whole chain is copied or nothing at all.
+ */
+
+ngx_int_t
+ngx_http_spill_write(ngx_http_request_t *r, ngx_chain_t *in)
+{
+    size_t                      len, room, n;
+    u_char                     *p;
+    ngx_int_t                   rc;
+    ngx_buf_t                  *b;
+    ngx_chain_t                *cl;
+    ngx_http_spill_t           *spill;
+    ngx_pool_cleanup_t         *cln;
+    ngx_http_spill_store_t     *store;
+    ngx_http_request_body_t    *rb;
+    ngx_http_core_main_conf_t  *cmcf;
+
+    cmcf = ngx_http_get_module_main_conf(r, ngx_http_core_module);
+
+    store = cmcf->spill_store;
+
+    if (store == NULL) {
+        return NGX_DECLINED;
+    }
+
+    rb = r->request_body;
+    spill = rb->spill;
+
+    len = 0;
+
+    for (cl = in; cl; cl = cl->next) {
+        len += cl->buf->last - cl->buf->pos;
+    }
+
+    room = (spill && spill->buf) ? (size_t) (spill->buf->end - spill->buf->last)
+                                 : 0;
+
+    if (len > room) {
+        rc = ngx_http_spill_reserve(r, store,
+                                    (len - room + store->block_size - 1)
+                                    / store->block_size);
+        if (rc != NGX_OK) {
+            return rc;
+        }
+    }
+
+    if (spill == NULL) {
+        spill = ngx_pcalloc(r->pool, sizeof(ngx_http_spill_t));
+        if (spill == NULL) {
+            return NGX_ERROR;
+        }
+
+        cln = ngx_pool_cleanup_add(r->pool, 0);
+        if (cln == NULL) {
+            return NGX_ERROR;
+        }
+
+        /*
+         * set by ngx_pcalloc():
+         *
+         *     spill->nblocks = 0;
+         *     spill->bufs = NULL;
+         *     spill->buf = NULL;
+         */
+
+        spill->store = store;
+        ngx_queue_init(&spill->blocks);
+        spill->last = &spill->bufs;
+
+        cln->handler = ngx_http_spill_cleanup;
+        cln->data = spill;
+
+        rb->spill = spill;
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                   "http spill write: %uz, %ui free blocks", len, store->nfree);
+
+    for (cl = in; cl; cl = cl->next) {
+
+        p = cl->buf->pos;
+
+        while (p < cl->buf->last) {
+
+            b = spill->buf;
+
+            if (b == NULL || b->last == b->end) {
+                b = ngx_http_spill_get_block(r, spill);
+                if (b == NULL) {
+                    return NGX_ERROR;
+                }
+            }
+
+            n = ngx_min((size_t) (b->end - b->last),
+                        (size_t) (cl->buf->last - p));
+
+            b->last = ngx_cpymem(b->last, p, n);
+            p += n;
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_spill_reserve(ngx_http_request_t *r, ngx_http_spill_store_t *store,
+    ngx_uint_t n)
+{
+    ngx_atomic_uint_t  total;
+
+    while (store->nfree < n) {
+
+        /* the budget is shared by all workers */
+
+        for ( ;; ) {
+            total = *store->total;
+
+            if ((total + 1) * store->segment_size > store->size) {
+                ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                               "http spill store exhausted: %ui of %ui blocks",
+                               n, store->nfree);
+                return NGX_DECLINED;
+            }
+
+            if (ngx_atomic_cmp_set(store->total, total, total + 1)) {
+                break;
+            }
+        }
+
+        store->mapped[ngx_worker]++;
+
+        if (ngx_http_spill_add_segment(r, store) != NGX_OK) {
+            store->mapped[ngx_worker]--;
+            (void) ngx_atomic_fetch_add(store->total, -1);
+            return NGX_ERROR;
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_spill_add_segment(ngx_http_request_t *r,
+    ngx_http_spill_store_t *store)
+{
+    u_char                    *addr;
+    ngx_uint_t                 i, n;
+    ngx_file_t                 file;
+    ngx_queue_t               *q;
+    ngx_http_spill_block_t    *block;
+    ngx_http_spill_segment_t  *segment;
+    ngx_http_core_loc_conf_t  *clcf;
+
+    clcf = ngx_http_get_module_loc_conf(r, ngx_http_core_module);
+
+    n = store->segment_size / store->block_size;
+
+    /* the segment structures live as long as the worker process */
+
+    if (!ngx_queue_empty(&store->spare)) {
+        q = ngx_queue_head(&store->spare);
+        ngx_queue_remove(q);
+
+        segment = ngx_queue_data(q, ngx_http_spill_segment_t, queue);
+
+    } else {
+        segment = ngx_palloc(ngx_cycle->pool,
+                             sizeof(ngx_http_spill_segment_t));
+        if (segment == NULL) {
+            return NGX_ERROR;
+        }
+
+        segment->blocks = ngx_palloc(ngx_cycle->pool,
+                                     n * sizeof(ngx_http_spill_block_t));
+        if (segment->blocks == NULL) {
+            return NGX_ERROR;
+        }
+    }
+
+    ngx_memzero(&file, sizeof(ngx_file_t));
+
+    file.fd = NGX_INVALID_FILE;
+    file.log = r->connection->log;
+
+    /* the file is unlinked right after creation */
+
+    if (ngx_create_temp_file(&file, clcf->client_body_temp_path, r->pool,
+                             0, 0, 0)
+        != NGX_OK)
+    {
+        return NGX_ERROR;
+    }
+
+    if (ftruncate(file.fd, store->segment_size) == -1) {
+        ngx_log_error(NGX_LOG_CRIT, r->connection->log, ngx_errno,
+                      "ftruncate() \"%s\" failed", file.name.data);
+        ngx_pool_run_cleanup_file(r->pool, file.fd);
+        ngx_queue_insert_head(&store->spare, &segment->queue);
+        return NGX_ERROR;
+    }
+
+    addr = (u_char *) mmap(NULL, store->segment_size, PROT_READ|PROT_WRITE,
+                           MAP_SHARED, file.fd, 0);
+
+    if (addr == MAP_FAILED) {
+        ngx_log_error(NGX_LOG_CRIT, r->connection->log, ngx_errno,
+                      "mmap(%uz) \"%s\" failed",
+                      store->segment_size, file.name.data);
+        ngx_pool_run_cleanup_file(r->pool, file.fd);
+        ngx_queue_insert_head(&store->spare, &segment->queue);
+        return NGX_ERROR;
+    }
+
+    /* the mapping holds the file, the descriptor is not needed anymore */
+
+    ngx_pool_run_cleanup_file(r->pool, file.fd);
+
+    segment->start = addr;
+    segment->used = 0;
+
+    block = segment->blocks;
+
+    for (i = 0; i < n; i++) {
+        block[i].start = addr + i * store->block_size;
+        block[i].segment = segment;
+        ngx_queue_insert_tail(&store->free, &block[i].queue);
+    }
+
+    store->nfree += n;
+    store->segments++;
+    store->idle++;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                   "http spill segment #%ui: %p, %ui blocks",
+                   store->segments, addr, n);
+
+    return NGX_OK;
+}
+
+
+static ngx_buf_t *
+ngx_http_spill_get_block(ngx_http_request_t *r, ngx_http_spill_t *spill)
+{
+    ngx_buf_t               *b;
+    ngx_queue_t             *q;
+    ngx_chain_t             *cl;
+    ngx_http_spill_store_t  *store;
+    ngx_http_spill_block_t  *block;
+
+    store = spill->store;
+
+    b = ngx_calloc_buf(r->pool);
+    if (b == NULL) {
+        return NULL;
+    }
+
+    cl = ngx_alloc_chain_link(r->pool);
+    if (cl == NULL) {
+        return NULL;
+    }
+
+    /* the space was reserved by ngx_http_spill_reserve() */
+
+    q = ngx_queue_head(&store->free);
+    ngx_queue_remove(q);
+    store->nfree--;
+
+    ngx_queue_insert_tail(&spill->blocks, q);
+    spill->nblocks++;
+
+    block = ngx_queue_data(q, ngx_http_spill_block_t, queue);
+
+    if (block->segment->used++ == 0) {
+        store->idle--;
+    }
+
+    b->temporary = 1;
+    b->start = block->start;
+    b->pos = block->start;
+    b->last = block->start;
+    b->end = block->start + store->block_size;
+
+    cl->buf = b;
+    cl->next = NULL;
+
+    *spill->last = cl;
+    spill->last = &cl->next;
+
+    spill->buf = b;
+
+    return b;
+}
+
+
+static void
+ngx_http_spill_cleanup(void *data)
+{
+    ngx_http_spill_t          *spill = data;
+    ngx_queue_t               *q;
+    ngx_http_spill_block_t    *block;
+    ngx_http_spill_store_t    *store;
+    ngx_http_spill_segment_t  *segment;
+
+    store = spill->store;
+
+    while (!ngx_queue_empty(&spill->blocks)) {
+        q = ngx_queue_head(&spill->blocks);
+        ngx_queue_remove(q);
+
+        ngx_queue_insert_tail(&store->free, q);
+        store->nfree++;
+
+        block = ngx_queue_data(q, ngx_http_spill_block_t, queue);
+        segment = block->segment;
+
+        if (--segment->used) {
+            continue;
+        }
+
+        /*
+         * a few idle segments are kept for the next bodies, the others
+         * are returned to the budget shared with other workers
+         */
+
+        if (++store->idle > NGX_HTTP_SPILL_IDLE_SEGMENTS) {
+            ngx_http_spill_release_segment(store, segment);
+        }
+    }
+
+    spill->nblocks = 0;
+}
+
+
+static void
+ngx_http_spill_release_segment(ngx_http_spill_store_t *store,
+    ngx_http_spill_segment_t *segment)
+{
+    ngx_uint_t  i, n;
+
+    n = store->segment_size / store->block_size;
+
+    /* all blocks of an idle segment are in the free list */
+
+    for (i = 0; i < n; i++) {
+        ngx_queue_remove(&segment->blocks[i].queue);
+    }
+
+    store->nfree -= n;
+    store->segments--;
+    store->idle--;
+
+    if (munmap(segment->start, store->segment_size) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "munmap(%p, %uz) failed",
+                      segment->start, store->segment_size);
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, ngx_cycle->log, 0,
+                   "http spill segment %p released, %ui left",
+                   segment->start, store->segments);
+
+    store->mapped[ngx_worker]--;
+    (void) ngx_atomic_fetch_add(store->total, -1);
+
+    ngx_queue_insert_head(&store->spare, &segment->queue);
+}
+
+
+/*
+ * the segments mapped are accounted in memory shared by the workers of
+ * a cycle; after a reload the old workers keep their segments, and
+ * their own accounting, until they exit
+ */
+
+ngx_int_t
+ngx_http_spill_init_module(ngx_cycle_t *cycle)
+{
+    ngx_shm_t                   shm;
+    ngx_core_conf_t            *ccf;
+    ngx_pool_cleanup_t         *cln;
+    ngx_http_spill_store_t     *store;
+    ngx_http_core_main_conf_t  *cmcf;
+
+    cmcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_core_module);
+
+    if (cmcf == NULL || cmcf->spill_store == NULL) {
+        return NGX_OK;
+    }
+
+    store = cmcf->spill_store;
+
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    store->workers = ccf->worker_processes;
+
+    cln = ngx_pool_cleanup_add(cycle->pool, sizeof(ngx_shm_t));
+    if (cln == NULL) {
+        return NGX_ERROR;
+    }
+
+    shm.size = (store->workers + 1) * sizeof(ngx_atomic_t);
+    shm.name.len = sizeof("nginx_http_spill") - 1;
+    shm.name.data = (u_char *) "nginx_http_spill";
+    shm.log = cycle->log;
+
+    if (ngx_shm_alloc(&shm) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    *(ngx_shm_t *) cln->data = shm;
+    cln->handler = ngx_http_spill_free_shm;
+
+    store->total = (ngx_atomic_t *) shm.addr;
+    store->mapped = store->total + 1;
+
+    return NGX_OK;
+}
+
+
+ngx_int_t
+ngx_http_spill_init_process(ngx_cycle_t *cycle)
+{
+    ngx_http_spill_store_t     *store;
+    ngx_http_core_main_conf_t  *cmcf;
+
+    cmcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_core_module);
+
+    if (cmcf == NULL || cmcf->spill_store == NULL) {
+        return NGX_OK;
+    }
+
+    /* the cache manager and loader do not serve requests */
+
+    if (ngx_process == NGX_PROCESS_HELPER) {
+        return NGX_OK;
+    }
+
+    store = cmcf->spill_store;
+
+    /* the segments of an exited worker this one replaces are gone */
+
+    if (store->mapped[ngx_worker]) {
+        (void) ngx_atomic_fetch_add(store->total,
+                                    - (ngx_atomic_int_t)
+                                      store->mapped[ngx_worker]);
+        store->mapped[ngx_worker] = 0;
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_spill_free_shm(void *data)
+{
+    ngx_shm_t  *shm = data;
+
+    ngx_shm_free(shm);
+}
+
+
+char *
+ngx_http_spill_store_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    char  *p = conf;
+
+    ssize_t                  size;
+    ngx_str_t               *value, s;
+    ngx_uint_t               i;
+    ngx_http_spill_store_t  *store, **sp;
+
+    sp = (ngx_http_spill_store_t **) (p + cmd->offset);
+
+    if (*sp != NGX_CONF_UNSET_PTR) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "off") == 0) {
+
+        if (cf->args->nelts != 2) {
+            return "is invalid";
+        }
+
+        *sp = NULL;
+        return NGX_CONF_OK;
+    }
+
+    store = ngx_pcalloc(cf->pool, sizeof(ngx_http_spill_store_t));
+    if (store == NULL) {
+        return NGX_CONF_ERROR;
+    }
+
+    store->segment_size = 1024 * 1024;
+    store->block_size = 64 * 1024;
+
+    for (i = 1; i < cf->args->nelts; i++) {
+
+        if (ngx_strncmp(value[i].data, "size=", 5) == 0) {
+
+            s.len = value[i].len - 5;
+            s.data = value[i].data + 5;
+
+            size = ngx_parse_size(&s);
+            if (size == NGX_ERROR || size == 0) {
+                goto invalid;
+            }
+
+            store->size = size;
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "segment=", 8) == 0) {
+
+            s.len = value[i].len - 8;
+            s.data = value[i].data + 8;
+
+            size = ngx_parse_size(&s);
+            if (size == NGX_ERROR || size == 0) {
+                goto invalid;
+            }
+
+            store->segment_size = size;
+
+            continue;
+        }
+
+        if (ngx_strncmp(value[i].data, "block=", 6) == 0) {
+
+            s.len = value[i].len - 6;
+            s.data = value[i].data + 6;
+
+            size = ngx_parse_size(&s);
+            if (size == NGX_ERROR || size == 0) {
+                goto invalid;
+            }
+
+            store->block_size = size;
+
+            continue;
+        }
+
+        goto invalid;
+    }
+
+    if (store->size == 0) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "\"%V\" must have \"size\" parameter",
+                           &cmd->name);
+        return NGX_CONF_ERROR;
+    }
+
+    store->block_size = ngx_align(store->block_size, ngx_pagesize);
+
+    if (store->segment_size < store->block_size) {
+        store->segment_size = store->block_size;
+    }
+
+    store->segment_size = store->segment_size / store->block_size
+                          * store->block_size;
+
+    if (store->size < store->segment_size) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "\"%V\" size is less than segment size",
+                           &cmd->name);
+        return NGX_CONF_ERROR;
+    }
+
+    ngx_queue_init(&store->free);
+    ngx_queue_init(&store->spare);
+
+    *sp = store;
+
+    return NGX_CONF_OK;
+
+invalid:
+
+    ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                       "invalid parameter \"%V\"", &value[i]);
+
+    return NGX_CONF_ERROR;
+}
@@ -0,0 +1,86 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#ifndef _NGX_HTTP_SPILL_H_INCLUDED_
+#define _NGX_HTTP_SPILL_H_INCLUDED_
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+/*
+ * 请求体溢出存储: 每个 worker 进程持有若干 mmap 映射的段文件,
+ * 段被切分为固定大小的块, 超出 client_body_buffer_size 的请求体
+ * 被复制到块中, 请求结束后块归还到空闲链表; 每个 worker 最多保留
+ * 一个完全空闲的段, 其余空闲段被解除映射, 归还给共同的预算;
+ * size 是所有 worker 共同的预算, 已映射的段数记在共享内存中
+ */
+
+#define NGX_HTTP_SPILL_IDLE_SEGMENTS  1
+
+
+typedef struct ngx_http_spill_segment_s  ngx_http_spill_segment_t;
+
+
+typedef struct {
+    size_t                           size;
+    size_t                           segment_size;
+    size_t                           block_size;
+
+    ngx_uint_t                       segments;
+    ngx_uint_t                       idle;
+
+    /* the segment structures kept after unmapping */
+    ngx_queue_t                      spare;
+
+    /* the segments mapped by all workers and by each of them */
+    ngx_atomic_t                    *total;
+    ngx_atomic_t                    *mapped;
+    ngx_uint_t                       workers;
+
+    ngx_queue_t                      free;
+    ngx_uint_t                       nfree;
+} ngx_http_spill_store_t;
+
+
+typedef struct {
+    ngx_queue_t                      queue;
+    u_char                          *start;
+    ngx_http_spill_segment_t        *segment;
+} ngx_http_spill_block_t;
+
+
+struct ngx_http_spill_segment_s {
+    ngx_queue_t                      queue;
+    u_char                          *start;
+    ngx_uint_t                       used;
+    ngx_http_spill_block_t          *blocks;
+};
+
+
+struct ngx_http_spill_s {
+    ngx_http_spill_store_t          *store;
+
+    ngx_queue_t                      blocks;
+    ngx_uint_t                       nblocks;
+
+    ngx_chain_t                     *bufs;
+    ngx_chain_t                    **last;
+    ngx_buf_t                       *buf;
+};
+
+
+ngx_int_t ngx_http_spill_write(ngx_http_request_t *r, ngx_chain_t *in);
+ngx_int_t ngx_http_spill_init_module(ngx_cycle_t *cycle);
+ngx_int_t ngx_http_spill_init_process(ngx_cycle_t *cycle);
+
+char *ngx_http_spill_store_set_slot(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+
+
+#endif /* _NGX_HTTP_SPILL_H_INCLUDED_ */
@@ -63,6 +63,7 @@ typedef struct {
     time_t                           header_sec;
     ngx_uint_t                       header_msec;
     off_t                            response_length;
+    ngx_uint_t                       cached;
 
     ngx_str_t                       *peer;
 } ngx_http_upstream_state_t;
@@ -97,8 +98,13 @@ typedef struct {
     ngx_uint_t                       max_fails;
     time_t                           fail_timeout;
 
+    ngx_str_t                        host;
+    in_port_t                        port;
+    ngx_uint_t                       max_addrs;
+
     unsigned                         down:1;
     unsigned                         backup:1;
+    unsigned                         resolve:1;
 } ngx_http_upstream_server_t;
 
 
@@ -110,6 +116,9 @@ typedef struct {
 #define NGX_HTTP_UPSTREAM_BACKUP        0x0020
 
 
+#define NGX_HTTP_UPSTREAM_MAX_ADDRS     8
+
+
 struct ngx_http_upstream_srv_conf_s {
     ngx_http_upstream_peer_t         peer;
     void                           **srv_conf;
@@ -123,6 +132,13 @@ struct ngx_http_upstream_srv_conf_s {
     in_port_t                        port;
     in_port_t                        default_port;
     ngx_uint_t                       no_port;  /* unsigned no_port:1 */
+
+    ngx_resolver_t                  *resolver;
+    ngx_msec_t                       resolver_timeout;
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    ngx_shm_zone_t                  *shm_zone;
+#endif
 };
 
 
@@ -190,10 +206,12 @@ typedef struct {
     ngx_msec_t                       cache_lock_age;
 
     ngx_flag_t                       cache_revalidate;
+    ngx_flag_t                       cache_background_update;
 
     ngx_array_t                     *cache_valid;
     ngx_array_t                     *cache_bypass;
     ngx_array_t                     *no_cache;
+    ngx_array_t                     *cache_purge;
 #endif
 
     ngx_array_t                     *store_lengths;
@@ -14,6 +14,17 @@
                                     + ((p)->next ? (p)->next->number : 0))
 
 
+static ngx_int_t ngx_http_upstream_init_host(ngx_conf_t *cf,
+    ngx_http_upstream_srv_conf_t *us, ngx_http_upstream_server_t *server,
+    ngx_http_upstream_rr_peers_t *peers, ngx_uint_t first,
+    ngx_http_upstream_rr_host_t *host);
+static void ngx_http_upstream_resolve_host(ngx_event_t *ev);
+static void ngx_http_upstream_resolve_handler(ngx_resolver_ctx_t *ctx);
+static void ngx_http_upstream_update_host(ngx_http_upstream_rr_host_t *host,
+    ngx_http_upstream_rr_peers_t *peers, ngx_addr_t *addrs,
+    ngx_uint_t naddrs, ngx_log_t *log);
+static void ngx_http_upstream_reset_peer(ngx_http_upstream_rr_peers_t *peers,
+    ngx_http_upstream_rr_peer_t *peer);
 static ngx_http_upstream_rr_peer_t *ngx_http_upstream_get_peer(
     ngx_http_upstream_rr_peer_data_t *rrp);
 
@@ -32,8 +43,9 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
     ngx_http_upstream_srv_conf_t *us)
 {
     ngx_url_t                      u;
-    ngx_uint_t                     i, j, n, w;
+    ngx_uint_t                     i, j, n, w, h, naddrs;
     ngx_http_upstream_server_t    *server;
+    ngx_http_upstream_rr_host_t   *host;
     ngx_http_upstream_rr_peer_t   *peer;
     ngx_http_upstream_rr_peers_t  *peers, *backup;
 
@@ -44,14 +56,19 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
 
         n = 0;
         w = 0;
+        h = 0;
 
         for (i = 0; i < us->servers->nelts; i++) {
             if (server[i].backup) {
                 continue;
             }
 
-            n += server[i].naddrs;
-            w += server[i].naddrs * server[i].weight;
+            naddrs = server[i].resolve ? server[i].max_addrs
+                                       : server[i].naddrs;
+
+            n += naddrs;
+            w += naddrs * server[i].weight;
+            h += server[i].resolve;
         }
 
         if (n == 0) {
@@ -67,13 +84,24 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
             return NGX_ERROR;
         }
 
-        peers->single = (n == 1);
+        peers->single = (n == 1 && h == 0);
         peers->number = n;
         peers->weighted = (w != n);
         peers->total_weight = w;
         peers->name = &us->host;
 
+        if (h) {
+            host = ngx_pcalloc(cf->pool, h * sizeof(ngx_http_upstream_rr_host_t));
+            if (host == NULL) {
+                return NGX_ERROR;
+            }
+
+            peers->nhosts = h;
+            peers->hosts = host;
+        }
+
         n = 0;
+        h = 0;
         peer = peers->peer;
 
         for (i = 0; i < us->servers->nelts; i++) {
@@ -81,6 +109,18 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
                 continue;
             }
 
+            if (server[i].resolve) {
+                if (ngx_http_upstream_init_host(cf, us, &server[i], peers, n,
+                                                &peers->hosts[h++])
+                    != NGX_OK)
+                {
+                    return NGX_ERROR;
+                }
+
+                n += server[i].max_addrs;
+                continue;
+            }
+
             for (j = 0; j < server[i].naddrs; j++) {
                 peer[n].sockaddr = server[i].addrs[j].sockaddr;
                 peer[n].socklen = server[i].addrs[j].socklen;
@@ -102,14 +142,19 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
 
         n = 0;
         w = 0;
+        h = 0;
 
         for (i = 0; i < us->servers->nelts; i++) {
             if (!server[i].backup) {
                 continue;
             }
 
-            n += server[i].naddrs;
-            w += server[i].naddrs * server[i].weight;
+            naddrs = server[i].resolve ? server[i].max_addrs
+                                       : server[i].naddrs;
+
+            n += naddrs;
+            w += naddrs * server[i].weight;
+            h += server[i].resolve;
         }
 
         if (n == 0) {
@@ -129,7 +174,18 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
         backup->total_weight = w;
         backup->name = &us->host;
 
+        if (h) {
+            host = ngx_pcalloc(cf->pool, h * sizeof(ngx_http_upstream_rr_host_t));
+            if (host == NULL) {
+                return NGX_ERROR;
+            }
+
+            backup->nhosts = h;
+            backup->hosts = host;
+        }
+
         n = 0;
+        h = 0;
         peer = backup->peer;
 
         for (i = 0; i < us->servers->nelts; i++) {
@@ -137,6 +193,18 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
                 continue;
             }
 
+            if (server[i].resolve) {
+                if (ngx_http_upstream_init_host(cf, us, &server[i], backup, n,
+                                                &backup->hosts[h++])
+                    != NGX_OK)
+                {
+                    return NGX_ERROR;
+                }
+
+                n += server[i].max_addrs;
+                continue;
+            }
+
             for (j = 0; j < server[i].naddrs; j++) {
                 peer[n].sockaddr = server[i].addrs[j].sockaddr;
                 peer[n].socklen = server[i].addrs[j].socklen;
@@ -217,6 +285,370 @@ ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
 }
 
 
+/*
+ * a server with the "resolve" parameter occupies max_addrs slots in
+ * the peers array; the slots which are not used by the current set of
+ * addresses are vacant and are skipped like the peers marked as down
+ */
+
+static ngx_int_t
+ngx_http_upstream_init_host(ngx_conf_t *cf, ngx_http_upstream_srv_conf_t *us,
+    ngx_http_upstream_server_t *server, ngx_http_upstream_rr_peers_t *peers,
+    ngx_uint_t first, ngx_http_upstream_rr_host_t *host)
+{
+    u_char                       *p;
+    ngx_uint_t                    i;
+    ngx_http_upstream_rr_peer_t  *peer;
+
+    host->name = server->host;
+    host->port = server->port;
+    host->first = first;
+    host->max_addrs = server->max_addrs;
+    host->down = server->down;
+    host->backup = server->backup;
+    host->upstream = us;
+
+    for (i = 0; i < server->max_addrs; i++) {
+        peer = &peers->peer[first + i];
+
+        /* the address storage is rewritten when the name is re-resolved */
+
+        p = ngx_pcalloc(cf->pool, NGX_SOCKADDRLEN + NGX_SOCKADDR_STRLEN);
+        if (p == NULL) {
+            return NGX_ERROR;
+        }
+
+        peer->sockaddr = (struct sockaddr *) p;
+        peer->name.data = p + NGX_SOCKADDRLEN;
+
+        if (i < server->naddrs) {
+            peer->socklen = server->addrs[i].socklen;
+            ngx_memcpy(peer->sockaddr, server->addrs[i].sockaddr,
+                       peer->socklen);
+
+            peer->name.len = ngx_min(server->addrs[i].name.len,
+                                     NGX_SOCKADDR_STRLEN);
+            ngx_memcpy(peer->name.data, server->addrs[i].name.data,
+                       peer->name.len);
+
+            peer->down = server->down;
+
+        } else {
+            peer->vacant = 1;
+            peer->down = 1;
+        }
+
+        peer->weight = server->weight;
+        peer->effective_weight = server->weight;
+        peer->current_weight = 0;
+        peer->max_fails = server->max_fails;
+        peer->fail_timeout = server->fail_timeout;
+        peer->server = server->name;
+        peer->host = host;
+    }
+
+    return NGX_OK;
+}
+
+
+ngx_int_t
+ngx_http_upstream_init_round_robin_hosts(ngx_cycle_t *cycle,
+    ngx_http_upstream_srv_conf_t *us)
+{
+    ngx_uint_t                     i;
+    ngx_http_upstream_rr_host_t   *host;
+    ngx_http_upstream_rr_peers_t  *peers;
+
+    if (ngx_process != NGX_PROCESS_WORKER
+        && ngx_process != NGX_PROCESS_SINGLE)
+    {
+        return NGX_OK;
+    }
+
+    for (peers = us->peer.data; peers; peers = peers->next) {
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+        if (peers->shpool && ngx_worker != 0) {
+
+            /* peers in a shared zone are updated by the first worker only */
+
+            return NGX_OK;
+        }
+#endif
+
+        host = peers->hosts;
+
+        for (i = 0; i < peers->nhosts; i++) {
+            host[i].event.handler = ngx_http_upstream_resolve_host;
+            host[i].event.data = &host[i];
+            host[i].event.log = cycle->log;
+            host[i].event.cancelable = 1;
+
+            ngx_add_timer(&host[i].event, 1);
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_upstream_resolve_host(ngx_event_t *ev)
+{
+    ngx_resolver_ctx_t           *ctx;
+    ngx_http_upstream_rr_host_t  *host;
+
+    if (ngx_exiting) {
+        return;
+    }
+
+    host = ev->data;
+
+    ctx = ngx_resolve_start(host->upstream->resolver, NULL);
+    if (ctx == NULL) {
+        goto retry;
+    }
+
+    if (ctx == NGX_NO_RESOLVER) {
+        ngx_log_error(NGX_LOG_ERR, ev->log, 0,
+                      "no resolver defined to resolve %V", &host->name);
+        return;
+    }
+
+    ctx->name = host->name;
+    ctx->handler = ngx_http_upstream_resolve_handler;
+    ctx->data = host;
+    ctx->timeout = host->upstream->resolver_timeout;
+    ctx->cancelable = 1;
+
+    if (ngx_resolve_name(ctx) == NGX_OK) {
+        return;
+    }
+
+retry:
+
+    ngx_add_timer(ev, 10000);
+}
+
+
+static void
+ngx_http_upstream_resolve_handler(ngx_resolver_ctx_t *ctx)
+{
+    time_t                         valid;
+    ngx_event_t                   *ev;
+    ngx_http_upstream_rr_host_t   *host;
+    ngx_http_upstream_rr_peers_t  *peers;
+
+    host = ctx->data;
+    ev = &host->event;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_HTTP, ev->log, 0,
+                   "http upstream resolve \"%V\": %i, valid: %T",
+                   &host->name, ctx->state, ctx->valid);
+
+    peers = host->upstream->peer.data;
+
+    if (host->backup) {
+        peers = peers->next;
+    }
+
+    if (ctx->state) {
+        ngx_log_error(NGX_LOG_ERR, ev->log, 0,
+                      "upstream \"%V\": %V could not be resolved (%i: %s)",
+                      &host->upstream->host, &ctx->name, ctx->state,
+                      ngx_resolver_strerror(ctx->state));
+
+        if (ctx->state == NGX_RESOLVE_NXDOMAIN) {
+            ngx_http_upstream_update_host(host, peers, NULL, 0, ev->log);
+        }
+
+        /* keep the previous addresses on temporary errors */
+
+        valid = 10;
+
+    } else {
+        ngx_http_upstream_update_host(host, peers, ctx->addrs, ctx->naddrs,
+                                      ev->log);
+
+        valid = ctx->valid - ngx_time();
+
+        if (valid < 1) {
+            valid = 1;
+        }
+    }
+
+    ngx_resolve_name_done(ctx);
+
+    if (!ngx_exiting) {
+        ngx_add_timer(ev, (ngx_msec_t) valid * 1000);
+    }
+}
+
+
+/*
+ * peers with addresses still returned by the resolver keep their state,
+ * slots of the addresses which are gone are vacated, and new addresses
+ * are placed into vacant slots
+ */
+
+static void
+ngx_http_upstream_update_host(ngx_http_upstream_rr_host_t *host,
+    ngx_http_upstream_rr_peers_t *peers, ngx_addr_t *addrs, ngx_uint_t naddrs,
+    ngx_log_t *log)
+{
+    u_char                       *p;
+    socklen_t                     socklen;
+    ngx_uint_t                    i, j;
+    ngx_http_upstream_rr_peer_t  *peer, *slot;
+    u_char                        sockaddr[NGX_SOCKADDRLEN];
+
+    if (naddrs > host->max_addrs) {
+        ngx_log_error(NGX_LOG_WARN, log, 0,
+                      "upstream \"%V\": %V resolved to %ui addresses, "
+                      "only %ui are used",
+                      &host->upstream->host, &host->name, naddrs,
+                      host->max_addrs);
+
+        naddrs = host->max_addrs;
+    }
+
+    peer = &peers->peer[host->first];
+
+    ngx_http_upstream_rr_peers_wlock(peers);
+
+    for (i = 0; i < host->max_addrs; i++) {
+
+        if (peer[i].vacant) {
+            continue;
+        }
+
+        for (j = 0; j < naddrs; j++) {
+            if (ngx_cmp_sockaddr(peer[i].sockaddr, peer[i].socklen,
+                                 addrs[j].sockaddr, addrs[j].socklen, 0)
+                == NGX_OK)
+            {
+                break;
+            }
+        }
+
+        if (j < naddrs) {
+            continue;
+        }
+
+        ngx_log_error(NGX_LOG_NOTICE, log, 0,
+                      "upstream \"%V\": %V removed address %V",
+                      &host->upstream->host, &host->name, &peer[i].name);
+
+        ngx_http_upstream_reset_peer(peers, &peer[i]);
+
+        peer[i].vacant = 1;
+        peer[i].down = 1;
+    }
+
+    for (j = 0; j < naddrs; j++) {
+
+        slot = NULL;
+
+        for (i = 0; i < host->max_addrs; i++) {
+
+            if (peer[i].vacant) {
+                if (slot == NULL) {
+                    slot = &peer[i];
+                }
+
+                continue;
+            }
+
+            if (ngx_cmp_sockaddr(peer[i].sockaddr, peer[i].socklen,
+                                 addrs[j].sockaddr, addrs[j].socklen, 0)
+                == NGX_OK)
+            {
+                break;
+            }
+        }
+
+        if (i < host->max_addrs || slot == NULL) {
+            continue;
+        }
+
+        socklen = addrs[j].socklen;
+
+        ngx_memcpy(sockaddr, addrs[j].sockaddr, socklen);
+
+        switch (((struct sockaddr *) sockaddr)->sa_family) {
+#if (NGX_HAVE_INET6)
+        case AF_INET6:
+            ((struct sockaddr_in6 *) sockaddr)->sin6_port = htons(host->port);
+            break;
+#endif
+        default: /* AF_INET */
+            ((struct sockaddr_in *) sockaddr)->sin_port = htons(host->port);
+        }
+
+        p = slot->name.data;
+
+        ngx_memcpy(slot->sockaddr, sockaddr, socklen);
+        slot->socklen = socklen;
+        slot->name.len = ngx_sock_ntop(slot->sockaddr, socklen, p,
+                                       NGX_SOCKADDR_STRLEN, 1);
+
+        ngx_http_upstream_reset_peer(peers, slot);
+
+        slot->vacant = 0;
+        slot->down = host->down;
+
+        ngx_log_error(NGX_LOG_NOTICE, log, 0,
+                      "upstream \"%V\": %V added address %V",
+                      &host->upstream->host, &host->name, &slot->name);
+    }
+
+    ngx_http_upstream_rr_peers_unlock(peers);
+}
+
+
+static void
+ngx_http_upstream_reset_peer(ngx_http_upstream_rr_peers_t *peers,
+    ngx_http_upstream_rr_peer_t *peer)
+{
+    peer->current_weight = 0;
+    peer->effective_weight = peer->weight;
+    peer->fails = 0;
+    peer->accessed = 0;
+    peer->checked = 0;
+
+#if (NGX_HTTP_UPSTREAM_CHECK)
+    peer->check_next = 0;
+    peer->check_fails = 0;
+    peer->check_passes = 0;
+    peer->check_down = 0;
+#endif
+
+#if (NGX_HTTP_SSL)
+
+    if (peer->ssl_session == NULL) {
+        return;
+    }
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    if (peers->shpool) {
+        ngx_shmtx_lock(&peers->shpool->mutex);
+        ngx_slab_free_locked(peers->shpool, peer->ssl_session);
+        ngx_shmtx_unlock(&peers->shpool->mutex);
+
+        peer->ssl_session = NULL;
+        peer->ssl_session_len = 0;
+
+        return;
+    }
+#endif
+
+    ngx_ssl_free_session(peer->ssl_session);
+    peer->ssl_session = NULL;
+
+#endif
+}
+
+
 ngx_int_t
 ngx_http_upstream_init_round_robin_peer(ngx_http_request_t *r,
     ngx_http_upstream_srv_conf_t *us)
@@ -405,8 +837,7 @@ ngx_http_upstream_get_round_robin_peer(ngx_peer_connection_t *pc, void *data)
     pc->connection = NULL;
 
     peers = rrp->peers;
-
-    /* ngx_lock_mutex(peers->mutex); */
+    ngx_http_upstream_rr_peers_wlock(peers);
 
     if (peers->single) {
         peer = &peers->peer[0];
@@ -434,7 +865,9 @@ ngx_http_upstream_get_round_robin_peer(ngx_peer_connection_t *pc, void *data)
     pc->socklen = peer->socklen;
     pc->name = &peer->name;
 
-    /* ngx_unlock_mutex(peers->mutex); */
+    peer->conns++;
+
+    ngx_http_upstream_rr_peers_unlock(peers);
 
     return NGX_OK;
 
@@ -442,8 +875,6 @@ failed:
 
     if (peers->next) {
 
-        /* ngx_unlock_mutex(peers->mutex); */
-
         ngx_log_debug0(NGX_LOG_DEBUG_HTTP, pc->log, 0, "backup servers");
 
         rrp->peers = peers->next;
@@ -455,13 +886,15 @@ failed:
              rrp->tried[i] = 0;
         }
 
+        ngx_http_upstream_rr_peers_unlock(peers);
+
         rc = ngx_http_upstream_get_round_robin_peer(pc, rrp);
 
         if (rc != NGX_BUSY) {
             return rc;
         }
 
-        /* ngx_lock_mutex(peers->mutex); */
+        ngx_http_upstream_rr_peers_wlock(peers);
     }
 
     /* all peers failed, mark them as live for quick recovery */
@@ -470,7 +903,7 @@ failed:
         peers->peer[i].fails = 0;
     }
 
-    /* ngx_unlock_mutex(peers->mutex); */
+    ngx_http_upstream_rr_peers_unlock(peers);
 
     pc->name = peers->name;
 
@@ -563,18 +996,25 @@ ngx_http_upstream_free_round_robin_peer(ngx_peer_connection_t *pc, void *data,
 
     /* TODO: NGX_PEER_KEEPALIVE */
 
+    peer = &rrp->peers->peer[rrp->current];
+
+    ngx_http_upstream_rr_peers_rlock(rrp->peers);
+    ngx_http_upstream_rr_peer_lock(rrp->peers, peer);
+
     if (rrp->peers->single) {
+
+        peer->conns--;
+
+        ngx_http_upstream_rr_peer_unlock(rrp->peers, peer);
+        ngx_http_upstream_rr_peers_unlock(rrp->peers);
+
         pc->tries = 0;
         return;
     }
 
-    peer = &rrp->peers->peer[rrp->current];
-
     if (state & NGX_PEER_FAILED) {
         now = ngx_time();
 
-        /* ngx_lock_mutex(rrp->peers->mutex); */
-
         peer->fails++;
         peer->accessed = now;
         peer->checked = now;
@@ -591,8 +1031,6 @@ ngx_http_upstream_free_round_robin_peer(ngx_peer_connection_t *pc, void *data,
             peer->effective_weight = 0;
         }
 
-        /* ngx_unlock_mutex(rrp->peers->mutex); */
-
     } else {
 
         /* mark peer live if check passed */
@@ -602,11 +1040,14 @@ ngx_http_upstream_free_round_robin_peer(ngx_peer_connection_t *pc, void *data,
         }
     }
 
+    peer->conns--;
+
+    ngx_http_upstream_rr_peer_unlock(rrp->peers, peer);
+    ngx_http_upstream_rr_peers_unlock(rrp->peers);
+
     if (pc->tries) {
         pc->tries--;
     }
-
-    /* ngx_unlock_mutex(rrp->peers->mutex); */
 }
 
 
@@ -618,14 +1059,60 @@ ngx_http_upstream_set_round_robin_peer_session(ngx_peer_connection_t *pc,
 {
     ngx_http_upstream_rr_peer_data_t  *rrp = data;
 
-    ngx_int_t                     rc;
-    ngx_ssl_session_t            *ssl_session;
-    ngx_http_upstream_rr_peer_t  *peer;
+    ngx_int_t                      rc;
+    ngx_ssl_session_t             *ssl_session;
+    ngx_http_upstream_rr_peer_t   *peer;
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    int                            len;
+#if OPENSSL_VERSION_NUMBER >= 0x0090707fL
+    const
+#endif
+    u_char                        *p;
+    ngx_http_upstream_rr_peers_t  *peers;
+    u_char                         buf[NGX_SSL_MAX_SESSION_SIZE];
+#endif
 
     peer = &rrp->peers->peer[rrp->current];
 
-    /* TODO: threads only mutex */
-    /* ngx_lock_mutex(rrp->peers->mutex); */
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    peers = rrp->peers;
+
+    if (peers->shpool) {
+
+        /*
+         * sessions in the shared zone are stored serialized,
+         * as SSL_SESSION objects are local to a process
+         */
+
+        ngx_http_upstream_rr_peers_rlock(peers);
+        ngx_http_upstream_rr_peer_lock(peers, peer);
+
+        if (peer->ssl_session == NULL) {
+            ngx_http_upstream_rr_peer_unlock(peers, peer);
+            ngx_http_upstream_rr_peers_unlock(peers);
+            return NGX_OK;
+        }
+
+        len = peer->ssl_session_len;
+
+        ngx_memcpy(buf, peer->ssl_session, len);
+
+        ngx_http_upstream_rr_peer_unlock(peers, peer);
+        ngx_http_upstream_rr_peers_unlock(peers);
+
+        p = buf;
+        ssl_session = d2i_SSL_SESSION(NULL, &p, len);
+
+        rc = ngx_ssl_set_session(pc->connection, ssl_session);
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
+                       "set session: %p", ssl_session);
+
+        ngx_ssl_free_session(ssl_session);
+
+        return rc;
+    }
+#endif
 
     ssl_session = peer->ssl_session;
 
@@ -634,8 +1121,6 @@ ngx_http_upstream_set_round_robin_peer_session(ngx_peer_connection_t *pc,
     ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
                    "set session: %p", ssl_session);
 
-    /* ngx_unlock_mutex(rrp->peers->mutex); */
-
     return rc;
 }
 
@@ -646,8 +1131,75 @@ ngx_http_upstream_save_round_robin_peer_session(ngx_peer_connection_t *pc,
 {
     ngx_http_upstream_rr_peer_data_t  *rrp = data;
 
-    ngx_ssl_session_t            *old_ssl_session, *ssl_session;
-    ngx_http_upstream_rr_peer_t  *peer;
+    ngx_ssl_session_t             *old_ssl_session, *ssl_session;
+    ngx_http_upstream_rr_peer_t   *peer;
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    int                            len;
+    u_char                        *p;
+    ngx_http_upstream_rr_peers_t  *peers;
+    u_char                         buf[NGX_SSL_MAX_SESSION_SIZE];
+#endif
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    peers = rrp->peers;
+
+    if (peers->shpool) {
+
+        ssl_session = SSL_get0_session(pc->connection->ssl->connection);
+
+        if (ssl_session == NULL) {
+            return;
+        }
+
+        ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
+                       "save session: %p", ssl_session);
+
+        len = i2d_SSL_SESSION(ssl_session, NULL);
+
+        /* do not cache too big session */
+
+        if (len > NGX_SSL_MAX_SESSION_SIZE) {
+            return;
+        }
+
+        p = buf;
+        (void) i2d_SSL_SESSION(ssl_session, &p);
+
+        peer = &peers->peer[rrp->current];
+
+        ngx_http_upstream_rr_peers_rlock(peers);
+        ngx_http_upstream_rr_peer_lock(peers, peer);
+
+        if (len > peer->ssl_session_len) {
+            ngx_shmtx_lock(&peers->shpool->mutex);
+
+            if (peer->ssl_session) {
+                ngx_slab_free_locked(peers->shpool, peer->ssl_session);
+            }
+
+            peer->ssl_session = ngx_slab_alloc_locked(peers->shpool, len);
+
+            ngx_shmtx_unlock(&peers->shpool->mutex);
+
+            if (peer->ssl_session == NULL) {
+                peer->ssl_session_len = 0;
+
+                ngx_http_upstream_rr_peer_unlock(peers, peer);
+                ngx_http_upstream_rr_peers_unlock(peers);
+                return;
+            }
+        }
+
+        peer->ssl_session_len = len;
+
+        ngx_memcpy(peer->ssl_session, buf, len);
+
+        ngx_http_upstream_rr_peer_unlock(peers, peer);
+        ngx_http_upstream_rr_peers_unlock(peers);
+
+        return;
+    }
+#endif
 
     ssl_session = ngx_ssl_get_session(pc->connection);
 
@@ -660,14 +1212,9 @@ ngx_http_upstream_save_round_robin_peer_session(ngx_peer_connection_t *pc,
 
     peer = &rrp->peers->peer[rrp->current];
 
-    /* TODO: threads only mutex */
-    /* ngx_lock_mutex(rrp->peers->mutex); */
-
     old_ssl_session = peer->ssl_session;
     peer->ssl_session = ssl_session;
 
-    /* ngx_unlock_mutex(rrp->peers->mutex); */
-
     if (old_ssl_session) {
 
         ngx_log_debug1(NGX_LOG_DEBUG_HTTP, pc->log, 0,
@@ -14,6 +14,22 @@
 #include <ngx_http.h>
 
 
+/* a server with the "resolve" parameter */
+
+typedef struct {
+    ngx_str_t                       name;
+    in_port_t                       port;
+
+    ngx_uint_t                      first;
+    ngx_uint_t                      max_addrs;
+    ngx_uint_t                      down;          /* unsigned  down:1; */
+    ngx_uint_t                      backup;        /* unsigned  backup:1; */
+
+    ngx_http_upstream_srv_conf_t   *upstream;
+    ngx_event_t                     event;
+} ngx_http_upstream_rr_host_t;
+
+
 typedef struct {
     struct sockaddr                *sockaddr;
     socklen_t                       socklen;
@@ -24,6 +40,8 @@ typedef struct {
     ngx_int_t                       effective_weight;
     ngx_int_t                       weight;
 
+    ngx_uint_t                      conns;
+
     ngx_uint_t                      fails;
     time_t                          accessed;
     time_t                          checked;
@@ -33,8 +51,23 @@ typedef struct {
 
     ngx_uint_t                      down;          /* unsigned  down:1; */
 
+    ngx_http_upstream_rr_host_t    *host;
+    ngx_uint_t                      vacant;        /* unsigned  vacant:1; */
+
+#if (NGX_HTTP_UPSTREAM_CHECK)
+    ngx_msec_t                      check_next;
+    ngx_uint_t                      check_fails;
+    ngx_uint_t                      check_passes;
+    ngx_uint_t                      check_down;    /* unsigned  check_down:1; */
+#endif
+
 #if (NGX_HTTP_SSL)
-    ngx_ssl_session_t              *ssl_session;   /* local to a process */
+    void                           *ssl_session;
+    int                             ssl_session_len;
+#endif
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    ngx_atomic_t                    lock;
 #endif
 } ngx_http_upstream_rr_peer_t;
 
@@ -44,6 +77,12 @@ typedef struct ngx_http_upstream_rr_peers_s  ngx_http_upstream_rr_peers_t;
 struct ngx_http_upstream_rr_peers_s {
     ngx_uint_t                      number;
 
+#if (NGX_HTTP_UPSTREAM_ZONE)
+    ngx_slab_pool_t                *shpool;
+    ngx_atomic_t                    rwlock;
+    ngx_http_upstream_rr_peers_t   *zone_next;
+#endif
+
     ngx_uint_t                      total_weight;
 
     unsigned                        single:1;
@@ -51,12 +90,64 @@ struct ngx_http_upstream_rr_peers_s {
 
     ngx_str_t                      *name;
 
+    ngx_uint_t                      nhosts;
+    ngx_http_upstream_rr_host_t    *hosts;
+
     ngx_http_upstream_rr_peers_t   *next;
 
     ngx_http_upstream_rr_peer_t     peer[1];
 };
 
 
+#define ngx_http_upstream_rr_peers_size(n)                                    \
+    (sizeof(ngx_http_upstream_rr_peers_t)                                     \
+     + sizeof(ngx_http_upstream_rr_peer_t) * ((n) - 1))
+
+
+#if (NGX_HTTP_UPSTREAM_ZONE)
+
+#define ngx_http_upstream_rr_peers_rlock(peers)                               \
+                                                                              \
+    if (peers->shpool) {                                                      \
+        ngx_rwlock_rlock(&peers->rwlock);                                     \
+    }
+
+#define ngx_http_upstream_rr_peers_wlock(peers)                               \
+                                                                              \
+    if (peers->shpool) {                                                      \
+        ngx_rwlock_wlock(&peers->rwlock);                                     \
+    }
+
+#define ngx_http_upstream_rr_peers_unlock(peers)                              \
+                                                                              \
+    if (peers->shpool) {                                                      \
+        ngx_rwlock_unlock(&peers->rwlock);                                    \
+    }
+
+
+#define ngx_http_upstream_rr_peer_lock(peers, peer)                           \
+                                                                              \
+    if (peers->shpool) {                                                      \
+        ngx_rwlock_wlock(&peer->lock);                                        \
+    }
+
+#define ngx_http_upstream_rr_peer_unlock(peers, peer)                         \
+                                                                              \
+    if (peers->shpool) {                                                      \
+        ngx_rwlock_unlock(&peer->lock);                                       \
+    }
+
+#else
+
+#define ngx_http_upstream_rr_peers_rlock(peers)
+#define ngx_http_upstream_rr_peers_wlock(peers)
+#define ngx_http_upstream_rr_peers_unlock(peers)
+#define ngx_http_upstream_rr_peer_lock(peers, peer)
+#define ngx_http_upstream_rr_peer_unlock(peers, peer)
+
+#endif
+
+
 typedef struct {
     ngx_http_upstream_rr_peers_t   *peers;
     ngx_uint_t                      current;
@@ -69,6 +160,8 @@ ngx_int_t ngx_http_upstream_init_round_robin(ngx_conf_t *cf,
     ngx_http_upstream_srv_conf_t *us);
 ngx_int_t ngx_http_upstream_init_round_robin_peer(ngx_http_request_t *r,
     ngx_http_upstream_srv_conf_t *us);
+ngx_int_t ngx_http_upstream_init_round_robin_hosts(ngx_cycle_t *cycle,
+    ngx_http_upstream_srv_conf_t *us);
 ngx_int_t ngx_http_upstream_create_round_robin_peer(ngx_http_request_t *r,
     ngx_http_upstream_resolved_t *ur);
 ngx_int_t ngx_http_upstream_get_round_robin_peer(ngx_peer_connection_t *pc,
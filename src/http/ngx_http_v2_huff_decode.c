@@ -0,0 +1,2926 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+/*
+ * The HPACK Huffman code (RFC 7541, appendix B) is decoded four bits at
+ * a time: the states are the 256 inner nodes of the code tree, and each
+ * transition may emit at most one symbol, since the shortest code is five
+ * bits long.  "ending" marks states in which the input may end, that is
+ * the bits consumed since the last symbol are a valid padding.  A
+ * transition to the same state denotes a decoding error (EOS symbol).
+ */
+
+typedef struct {
+    u_char  next;
+    u_char  emit;
+    u_char  sym;
+    u_char  ending;
+} ngx_http_v2_huff_decode_code_t;
+
+
+static ngx_inline ngx_int_t ngx_http_v2_huff_decode_bits(u_char *state,
+    u_char *ending, ngx_uint_t bits, u_char **dst);
+
+
+static ngx_http_v2_huff_decode_code_t  ngx_http_v2_huff_decode_codes[256][16] =
+{
+    /* 0 */
+    {
+        {0x57, 0x00, 0x00, 0x00}, {0x58, 0x00, 0x00, 0x00},
+        {0x83, 0x00, 0x00, 0x00}, {0x87, 0x00, 0x00, 0x00},
+        {0x8f, 0x00, 0x00, 0x00}, {0x45, 0x00, 0x00, 0x00},
+        {0x53, 0x00, 0x00, 0x00}, {0x5a, 0x00, 0x00, 0x00},
+        {0x64, 0x00, 0x00, 0x00}, {0x84, 0x00, 0x00, 0x00},
+        {0x8a, 0x00, 0x00, 0x00}, {0x5f, 0x00, 0x00, 0x00},
+        {0x69, 0x00, 0x00, 0x00}, {0x70, 0x00, 0x00, 0x00},
+        {0x77, 0x00, 0x00, 0x00}, {0x04, 0x00, 0x00, 0x01}
+    },
+    /* 1 */
+    {
+        {0x65, 0x00, 0x00, 0x00}, {0x81, 0x00, 0x00, 0x00},
+        {0x85, 0x00, 0x00, 0x00}, {0x86, 0x00, 0x00, 0x00},
+        {0x8b, 0x00, 0x00, 0x00}, {0x8c, 0x00, 0x00, 0x00},
+        {0x8e, 0x00, 0x00, 0x00}, {0x60, 0x00, 0x00, 0x00},
+        {0x6a, 0x00, 0x00, 0x00}, {0x6d, 0x00, 0x00, 0x00},
+        {0x71, 0x00, 0x00, 0x00}, {0x74, 0x00, 0x00, 0x00},
+        {0x78, 0x00, 0x00, 0x00}, {0x88, 0x00, 0x00, 0x00},
+        {0x90, 0x00, 0x00, 0x00}, {0x05, 0x00, 0x00, 0x01}
+    },
+    /* 2 */
+    {
+        {0x6b, 0x00, 0x00, 0x00}, {0x6c, 0x00, 0x00, 0x00},
+        {0x6e, 0x00, 0x00, 0x00}, {0x6f, 0x00, 0x00, 0x00},
+        {0x72, 0x00, 0x00, 0x00}, {0x73, 0x00, 0x00, 0x00},
+        {0x75, 0x00, 0x00, 0x00}, {0x76, 0x00, 0x00, 0x00},
+        {0x79, 0x00, 0x00, 0x00}, {0x7a, 0x00, 0x00, 0x00},
+        {0x89, 0x00, 0x00, 0x00}, {0x8d, 0x00, 0x00, 0x00},
+        {0x91, 0x00, 0x00, 0x00}, {0x92, 0x00, 0x00, 0x00},
+        {0x4b, 0x00, 0x00, 0x00}, {0x06, 0x00, 0x00, 0x01}
+    },
+    /* 3 */
+    {
+        {0x00, 0x01, 0x55, 0x01}, {0x00, 0x01, 0x56, 0x01},
+        {0x00, 0x01, 0x57, 0x01}, {0x00, 0x01, 0x59, 0x01},
+        {0x00, 0x01, 0x6a, 0x01}, {0x00, 0x01, 0x6b, 0x01},
+        {0x00, 0x01, 0x71, 0x01}, {0x00, 0x01, 0x76, 0x01},
+        {0x00, 0x01, 0x77, 0x01}, {0x00, 0x01, 0x78, 0x01},
+        {0x00, 0x01, 0x79, 0x01}, {0x00, 0x01, 0x7a, 0x01},
+        {0x4c, 0x00, 0x00, 0x00}, {0x50, 0x00, 0x00, 0x00},
+        {0x7b, 0x00, 0x00, 0x00}, {0x07, 0x00, 0x00, 0x01}
+    },
+    /* 4 */
+    {
+        {0x42, 0x01, 0x77, 0x00}, {0x01, 0x01, 0x77, 0x01},
+        {0x42, 0x01, 0x78, 0x00}, {0x01, 0x01, 0x78, 0x01},
+        {0x42, 0x01, 0x79, 0x00}, {0x01, 0x01, 0x79, 0x01},
+        {0x42, 0x01, 0x7a, 0x00}, {0x01, 0x01, 0x7a, 0x01},
+        {0x00, 0x01, 0x26, 0x01}, {0x00, 0x01, 0x2a, 0x01},
+        {0x00, 0x01, 0x2c, 0x01}, {0x00, 0x01, 0x3b, 0x01},
+        {0x00, 0x01, 0x58, 0x01}, {0x00, 0x01, 0x5a, 0x01},
+        {0x47, 0x00, 0x00, 0x00}, {0x08, 0x00, 0x00, 0x00}
+    },
+    /* 5 */
+    {
+        {0x42, 0x01, 0x26, 0x00}, {0x01, 0x01, 0x26, 0x01},
+        {0x42, 0x01, 0x2a, 0x00}, {0x01, 0x01, 0x2a, 0x01},
+        {0x42, 0x01, 0x2c, 0x00}, {0x01, 0x01, 0x2c, 0x01},
+        {0x42, 0x01, 0x3b, 0x00}, {0x01, 0x01, 0x3b, 0x01},
+        {0x42, 0x01, 0x58, 0x00}, {0x01, 0x01, 0x58, 0x01},
+        {0x42, 0x01, 0x5a, 0x00}, {0x01, 0x01, 0x5a, 0x01},
+        {0x48, 0x00, 0x00, 0x00}, {0x4f, 0x00, 0x00, 0x00},
+        {0x4d, 0x00, 0x00, 0x00}, {0x09, 0x00, 0x00, 0x00}
+    },
+    /* 6 */
+    {
+        {0x55, 0x01, 0x58, 0x00}, {0x43, 0x01, 0x58, 0x00},
+        {0x5d, 0x01, 0x58, 0x00}, {0x02, 0x01, 0x58, 0x01},
+        {0x55, 0x01, 0x5a, 0x00}, {0x43, 0x01, 0x5a, 0x00},
+        {0x5d, 0x01, 0x5a, 0x00}, {0x02, 0x01, 0x5a, 0x01},
+        {0x00, 0x01, 0x21, 0x01}, {0x00, 0x01, 0x22, 0x01},
+        {0x00, 0x01, 0x28, 0x01}, {0x00, 0x01, 0x29, 0x01},
+        {0x00, 0x01, 0x3f, 0x01}, {0x4e, 0x00, 0x00, 0x00},
+        {0x49, 0x00, 0x00, 0x00}, {0x0a, 0x00, 0x00, 0x00}
+    },
+    /* 7 */
+    {
+        {0x42, 0x01, 0x21, 0x00}, {0x01, 0x01, 0x21, 0x01},
+        {0x42, 0x01, 0x22, 0x00}, {0x01, 0x01, 0x22, 0x01},
+        {0x42, 0x01, 0x28, 0x00}, {0x01, 0x01, 0x28, 0x01},
+        {0x42, 0x01, 0x29, 0x00}, {0x01, 0x01, 0x29, 0x01},
+        {0x42, 0x01, 0x3f, 0x00}, {0x01, 0x01, 0x3f, 0x01},
+        {0x00, 0x01, 0x27, 0x01}, {0x00, 0x01, 0x2b, 0x01},
+        {0x00, 0x01, 0x7c, 0x01}, {0x4a, 0x00, 0x00, 0x00},
+        {0x0b, 0x00, 0x00, 0x00}, {0x0d, 0x00, 0x00, 0x00}
+    },
+    /* 8 */
+    {
+        {0x55, 0x01, 0x3f, 0x00}, {0x43, 0x01, 0x3f, 0x00},
+        {0x5d, 0x01, 0x3f, 0x00}, {0x02, 0x01, 0x3f, 0x01},
+        {0x42, 0x01, 0x27, 0x00}, {0x01, 0x01, 0x27, 0x01},
+        {0x42, 0x01, 0x2b, 0x00}, {0x01, 0x01, 0x2b, 0x01},
+        {0x42, 0x01, 0x7c, 0x00}, {0x01, 0x01, 0x7c, 0x01},
+        {0x00, 0x01, 0x23, 0x01}, {0x00, 0x01, 0x3e, 0x01},
+        {0x0c, 0x00, 0x00, 0x00}, {0x66, 0x00, 0x00, 0x00},
+        {0x7f, 0x00, 0x00, 0x00}, {0x0e, 0x00, 0x00, 0x00}
+    },
+    /* 9 */
+    {
+        {0x55, 0x01, 0x7c, 0x00}, {0x43, 0x01, 0x7c, 0x00},
+        {0x5d, 0x01, 0x7c, 0x00}, {0x02, 0x01, 0x7c, 0x01},
+        {0x42, 0x01, 0x23, 0x00}, {0x01, 0x01, 0x23, 0x01},
+        {0x42, 0x01, 0x3e, 0x00}, {0x01, 0x01, 0x3e, 0x01},
+        {0x00, 0x01, 0x00, 0x01}, {0x00, 0x01, 0x24, 0x01},
+        {0x00, 0x01, 0x40, 0x01}, {0x00, 0x01, 0x5b, 0x01},
+        {0x00, 0x01, 0x5d, 0x01}, {0x00, 0x01, 0x7e, 0x01},
+        {0x80, 0x00, 0x00, 0x00}, {0x0f, 0x00, 0x00, 0x00}
+    },
+    /* 10 */
+    {
+        {0x42, 0x01, 0x00, 0x00}, {0x01, 0x01, 0x00, 0x01},
+        {0x42, 0x01, 0x24, 0x00}, {0x01, 0x01, 0x24, 0x01},
+        {0x42, 0x01, 0x40, 0x00}, {0x01, 0x01, 0x40, 0x01},
+        {0x42, 0x01, 0x5b, 0x00}, {0x01, 0x01, 0x5b, 0x01},
+        {0x42, 0x01, 0x5d, 0x00}, {0x01, 0x01, 0x5d, 0x01},
+        {0x42, 0x01, 0x7e, 0x00}, {0x01, 0x01, 0x7e, 0x01},
+        {0x00, 0x01, 0x5e, 0x01}, {0x00, 0x01, 0x7d, 0x01},
+        {0x62, 0x00, 0x00, 0x00}, {0x10, 0x00, 0x00, 0x00}
+    },
+    /* 11 */
+    {
+        {0x55, 0x01, 0x00, 0x00}, {0x43, 0x01, 0x00, 0x00},
+        {0x5d, 0x01, 0x00, 0x00}, {0x02, 0x01, 0x00, 0x01},
+        {0x55, 0x01, 0x24, 0x00}, {0x43, 0x01, 0x24, 0x00},
+        {0x5d, 0x01, 0x24, 0x00}, {0x02, 0x01, 0x24, 0x01},
+        {0x55, 0x01, 0x40, 0x00}, {0x43, 0x01, 0x40, 0x00},
+        {0x5d, 0x01, 0x40, 0x00}, {0x02, 0x01, 0x40, 0x01},
+        {0x55, 0x01, 0x5b, 0x00}, {0x43, 0x01, 0x5b, 0x00},
+        {0x5d, 0x01, 0x5b, 0x00}, {0x02, 0x01, 0x5b, 0x01}
+    },
+    /* 12 */
+    {
+        {0x56, 0x01, 0x00, 0x00}, {0x82, 0x01, 0x00, 0x00},
+        {0x44, 0x01, 0x00, 0x00}, {0x52, 0x01, 0x00, 0x00},
+        {0x63, 0x01, 0x00, 0x00}, {0x5e, 0x01, 0x00, 0x00},
+        {0x68, 0x01, 0x00, 0x00}, {0x03, 0x01, 0x00, 0x01},
+        {0x56, 0x01, 0x24, 0x00}, {0x82, 0x01, 0x24, 0x00},
+        {0x44, 0x01, 0x24, 0x00}, {0x52, 0x01, 0x24, 0x00},
+        {0x63, 0x01, 0x24, 0x00}, {0x5e, 0x01, 0x24, 0x00},
+        {0x68, 0x01, 0x24, 0x00}, {0x03, 0x01, 0x24, 0x01}
+    },
+    /* 13 */
+    {
+        {0x55, 0x01, 0x5d, 0x00}, {0x43, 0x01, 0x5d, 0x00},
+        {0x5d, 0x01, 0x5d, 0x00}, {0x02, 0x01, 0x5d, 0x01},
+        {0x55, 0x01, 0x7e, 0x00}, {0x43, 0x01, 0x7e, 0x00},
+        {0x5d, 0x01, 0x7e, 0x00}, {0x02, 0x01, 0x7e, 0x01},
+        {0x42, 0x01, 0x5e, 0x00}, {0x01, 0x01, 0x5e, 0x01},
+        {0x42, 0x01, 0x7d, 0x00}, {0x01, 0x01, 0x7d, 0x01},
+        {0x00, 0x01, 0x3c, 0x01}, {0x00, 0x01, 0x60, 0x01},
+        {0x00, 0x01, 0x7b, 0x01}, {0x11, 0x00, 0x00, 0x00}
+    },
+    /* 14 */
+    {
+        {0x55, 0x01, 0x5e, 0x00}, {0x43, 0x01, 0x5e, 0x00},
+        {0x5d, 0x01, 0x5e, 0x00}, {0x02, 0x01, 0x5e, 0x01},
+        {0x55, 0x01, 0x7d, 0x00}, {0x43, 0x01, 0x7d, 0x00},
+        {0x5d, 0x01, 0x7d, 0x00}, {0x02, 0x01, 0x7d, 0x01},
+        {0x42, 0x01, 0x3c, 0x00}, {0x01, 0x01, 0x3c, 0x01},
+        {0x42, 0x01, 0x60, 0x00}, {0x01, 0x01, 0x60, 0x01},
+        {0x42, 0x01, 0x7b, 0x00}, {0x01, 0x01, 0x7b, 0x01},
+        {0x7c, 0x00, 0x00, 0x00}, {0x12, 0x00, 0x00, 0x00}
+    },
+    /* 15 */
+    {
+        {0x55, 0x01, 0x3c, 0x00}, {0x43, 0x01, 0x3c, 0x00},
+        {0x5d, 0x01, 0x3c, 0x00}, {0x02, 0x01, 0x3c, 0x01},
+        {0x55, 0x01, 0x60, 0x00}, {0x43, 0x01, 0x60, 0x00},
+        {0x5d, 0x01, 0x60, 0x00}, {0x02, 0x01, 0x60, 0x01},
+        {0x55, 0x01, 0x7b, 0x00}, {0x43, 0x01, 0x7b, 0x00},
+        {0x5d, 0x01, 0x7b, 0x00}, {0x02, 0x01, 0x7b, 0x01},
+        {0x7d, 0x00, 0x00, 0x00}, {0x9b, 0x00, 0x00, 0x00},
+        {0x96, 0x00, 0x00, 0x00}, {0x13, 0x00, 0x00, 0x00}
+    },
+    /* 16 */
+    {
+        {0x56, 0x01, 0x7b, 0x00}, {0x82, 0x01, 0x7b, 0x00},
+        {0x44, 0x01, 0x7b, 0x00}, {0x52, 0x01, 0x7b, 0x00},
+        {0x63, 0x01, 0x7b, 0x00}, {0x5e, 0x01, 0x7b, 0x00},
+        {0x68, 0x01, 0x7b, 0x00}, {0x03, 0x01, 0x7b, 0x01},
+        {0x7e, 0x00, 0x00, 0x00}, {0x94, 0x00, 0x00, 0x00},
+        {0x9c, 0x00, 0x00, 0x00}, {0xaf, 0x00, 0x00, 0x00},
+        {0xc4, 0x00, 0x00, 0x00}, {0x97, 0x00, 0x00, 0x00},
+        {0x14, 0x00, 0x00, 0x00}, {0x19, 0x00, 0x00, 0x00}
+    },
+    /* 17 */
+    {
+        {0x00, 0x01, 0x5c, 0x01}, {0x00, 0x01, 0xc3, 0x01},
+        {0x00, 0x01, 0xd0, 0x01}, {0x95, 0x00, 0x00, 0x00},
+        {0x9d, 0x00, 0x00, 0x00}, {0xcc, 0x00, 0x00, 0x00},
+        {0xf1, 0x00, 0x00, 0x00}, {0xb0, 0x00, 0x00, 0x00},
+        {0xc5, 0x00, 0x00, 0x00}, {0xeb, 0x00, 0x00, 0x00},
+        {0x98, 0x00, 0x00, 0x00}, {0xb2, 0x00, 0x00, 0x00},
+        {0xc7, 0x00, 0x00, 0x00}, {0x15, 0x00, 0x00, 0x00},
+        {0xa7, 0x00, 0x00, 0x00}, {0x1a, 0x00, 0x00, 0x00}
+    },
+    /* 18 */
+    {
+        {0xc6, 0x00, 0x00, 0x00}, {0xca, 0x00, 0x00, 0x00},
+        {0xec, 0x00, 0x00, 0x00}, {0xf2, 0x00, 0x00, 0x00},
+        {0x99, 0x00, 0x00, 0x00}, {0x9e, 0x00, 0x00, 0x00},
+        {0xb3, 0x00, 0x00, 0x00}, {0xb7, 0x00, 0x00, 0x00},
+        {0xc8, 0x00, 0x00, 0x00}, {0xce, 0x00, 0x00, 0x00},
+        {0xd8, 0x00, 0x00, 0x00}, {0x16, 0x00, 0x00, 0x00},
+        {0xa8, 0x00, 0x00, 0x00}, {0xb9, 0x00, 0x00, 0x00},
+        {0x29, 0x00, 0x00, 0x00}, {0x1b, 0x00, 0x00, 0x00}
+    },
+    /* 19 */
+    {
+        {0xc9, 0x00, 0x00, 0x00}, {0xcd, 0x00, 0x00, 0x00},
+        {0xcf, 0x00, 0x00, 0x00}, {0xd2, 0x00, 0x00, 0x00},
+        {0xd9, 0x00, 0x00, 0x00}, {0xf3, 0x00, 0x00, 0x00},
+        {0x17, 0x00, 0x00, 0x00}, {0xa2, 0x00, 0x00, 0x00},
+        {0xa9, 0x00, 0x00, 0x00}, {0xad, 0x00, 0x00, 0x00},
+        {0xba, 0x00, 0x00, 0x00}, {0xc2, 0x00, 0x00, 0x00},
+        {0xd0, 0x00, 0x00, 0x00}, {0x2a, 0x00, 0x00, 0x00},
+        {0xbf, 0x00, 0x00, 0x00}, {0x1c, 0x00, 0x00, 0x00}
+    },
+    /* 20 */
+    {
+        {0x00, 0x01, 0xb2, 0x01}, {0x00, 0x01, 0xb5, 0x01},
+        {0x00, 0x01, 0xb9, 0x01}, {0x00, 0x01, 0xba, 0x01},
+        {0x00, 0x01, 0xbb, 0x01}, {0x00, 0x01, 0xbd, 0x01},
+        {0x00, 0x01, 0xbe, 0x01}, {0x00, 0x01, 0xc4, 0x01},
+        {0x00, 0x01, 0xc6, 0x01}, {0x00, 0x01, 0xe4, 0x01},
+        {0x00, 0x01, 0xe8, 0x01}, {0x00, 0x01, 0xe9, 0x01},
+        {0x18, 0x00, 0x00, 0x00}, {0xa1, 0x00, 0x00, 0x00},
+        {0xa3, 0x00, 0x00, 0x00}, {0xa4, 0x00, 0x00, 0x00}
+    },
+    /* 21 */
+    {
+        {0x42, 0x01, 0xc6, 0x00}, {0x01, 0x01, 0xc6, 0x01},
+        {0x42, 0x01, 0xe4, 0x00}, {0x01, 0x01, 0xe4, 0x01},
+        {0x42, 0x01, 0xe8, 0x00}, {0x01, 0x01, 0xe8, 0x01},
+        {0x42, 0x01, 0xe9, 0x00}, {0x01, 0x01, 0xe9, 0x01},
+        {0x00, 0x01, 0x01, 0x01}, {0x00, 0x01, 0x87, 0x01},
+        {0x00, 0x01, 0x89, 0x01}, {0x00, 0x01, 0x8a, 0x01},
+        {0x00, 0x01, 0x8b, 0x01}, {0x00, 0x01, 0x8c, 0x01},
+        {0x00, 0x01, 0x8d, 0x01}, {0x00, 0x01, 0x8f, 0x01}
+    },
+    /* 22 */
+    {
+        {0x42, 0x01, 0x01, 0x00}, {0x01, 0x01, 0x01, 0x01},
+        {0x42, 0x01, 0x87, 0x00}, {0x01, 0x01, 0x87, 0x01},
+        {0x42, 0x01, 0x89, 0x00}, {0x01, 0x01, 0x89, 0x01},
+        {0x42, 0x01, 0x8a, 0x00}, {0x01, 0x01, 0x8a, 0x01},
+        {0x42, 0x01, 0x8b, 0x00}, {0x01, 0x01, 0x8b, 0x01},
+        {0x42, 0x01, 0x8c, 0x00}, {0x01, 0x01, 0x8c, 0x01},
+        {0x42, 0x01, 0x8d, 0x00}, {0x01, 0x01, 0x8d, 0x01},
+        {0x42, 0x01, 0x8f, 0x00}, {0x01, 0x01, 0x8f, 0x01}
+    },
+    /* 23 */
+    {
+        {0x55, 0x01, 0x01, 0x00}, {0x43, 0x01, 0x01, 0x00},
+        {0x5d, 0x01, 0x01, 0x00}, {0x02, 0x01, 0x01, 0x01},
+        {0x55, 0x01, 0x87, 0x00}, {0x43, 0x01, 0x87, 0x00},
+        {0x5d, 0x01, 0x87, 0x00}, {0x02, 0x01, 0x87, 0x01},
+        {0x55, 0x01, 0x89, 0x00}, {0x43, 0x01, 0x89, 0x00},
+        {0x5d, 0x01, 0x89, 0x00}, {0x02, 0x01, 0x89, 0x01},
+        {0x55, 0x01, 0x8a, 0x00}, {0x43, 0x01, 0x8a, 0x00},
+        {0x5d, 0x01, 0x8a, 0x00}, {0x02, 0x01, 0x8a, 0x01}
+    },
+    /* 24 */
+    {
+        {0x56, 0x01, 0x01, 0x00}, {0x82, 0x01, 0x01, 0x00},
+        {0x44, 0x01, 0x01, 0x00}, {0x52, 0x01, 0x01, 0x00},
+        {0x63, 0x01, 0x01, 0x00}, {0x5e, 0x01, 0x01, 0x00},
+        {0x68, 0x01, 0x01, 0x00}, {0x03, 0x01, 0x01, 0x01},
+        {0x56, 0x01, 0x87, 0x00}, {0x82, 0x01, 0x87, 0x00},
+        {0x44, 0x01, 0x87, 0x00}, {0x52, 0x01, 0x87, 0x00},
+        {0x63, 0x01, 0x87, 0x00}, {0x5e, 0x01, 0x87, 0x00},
+        {0x68, 0x01, 0x87, 0x00}, {0x03, 0x01, 0x87, 0x01}
+    },
+    /* 25 */
+    {
+        {0xaa, 0x00, 0x00, 0x00}, {0xac, 0x00, 0x00, 0x00},
+        {0xae, 0x00, 0x00, 0x00}, {0xb5, 0x00, 0x00, 0x00},
+        {0xbb, 0x00, 0x00, 0x00}, {0xbd, 0x00, 0x00, 0x00},
+        {0xc3, 0x00, 0x00, 0x00}, {0xcb, 0x00, 0x00, 0x00},
+        {0xd1, 0x00, 0x00, 0x00}, {0xd7, 0x00, 0x00, 0x00},
+        {0x2b, 0x00, 0x00, 0x00}, {0xa5, 0x00, 0x00, 0x00},
+        {0xc0, 0x00, 0x00, 0x00}, {0xda, 0x00, 0x00, 0x00},
+        {0xd3, 0x00, 0x00, 0x00}, {0x1d, 0x00, 0x00, 0x00}
+    },
+    /* 26 */
+    {
+        {0x00, 0x01, 0xbc, 0x01}, {0x00, 0x01, 0xbf, 0x01},
+        {0x00, 0x01, 0xc5, 0x01}, {0x00, 0x01, 0xe7, 0x01},
+        {0x00, 0x01, 0xef, 0x01}, {0x2c, 0x00, 0x00, 0x00},
+        {0xa6, 0x00, 0x00, 0x00}, {0xab, 0x00, 0x00, 0x00},
+        {0xc1, 0x00, 0x00, 0x00}, {0xea, 0x00, 0x00, 0x00},
+        {0xf5, 0x00, 0x00, 0x00}, {0xdb, 0x00, 0x00, 0x00},
+        {0xd4, 0x00, 0x00, 0x00}, {0xe0, 0x00, 0x00, 0x00},
+        {0xe5, 0x00, 0x00, 0x00}, {0x1e, 0x00, 0x00, 0x00}
+    },
+    /* 27 */
+    {
+        {0x00, 0x01, 0xab, 0x01}, {0x00, 0x01, 0xce, 0x01},
+        {0x00, 0x01, 0xd7, 0x01}, {0x00, 0x01, 0xe1, 0x01},
+        {0x00, 0x01, 0xec, 0x01}, {0x00, 0x01, 0xed, 0x01},
+        {0xdc, 0x00, 0x00, 0x00}, {0xf4, 0x00, 0x00, 0x00},
+        {0xd5, 0x00, 0x00, 0x00}, {0xde, 0x00, 0x00, 0x00},
+        {0xed, 0x00, 0x00, 0x00}, {0xe1, 0x00, 0x00, 0x00},
+        {0xe6, 0x00, 0x00, 0x00}, {0xf9, 0x00, 0x00, 0x00},
+        {0x1f, 0x00, 0x00, 0x00}, {0x2d, 0x00, 0x00, 0x00}
+    },
+    /* 28 */
+    {
+        {0xd6, 0x00, 0x00, 0x00}, {0xdd, 0x00, 0x00, 0x00},
+        {0xdf, 0x00, 0x00, 0x00}, {0xe4, 0x00, 0x00, 0x00},
+        {0xee, 0x00, 0x00, 0x00}, {0xf6, 0x00, 0x00, 0x00},
+        {0xf8, 0x00, 0x00, 0x00}, {0xe2, 0x00, 0x00, 0x00},
+        {0xe7, 0x00, 0x00, 0x00}, {0xef, 0x00, 0x00, 0x00},
+        {0xfa, 0x00, 0x00, 0x00}, {0xfd, 0x00, 0x00, 0x00},
+        {0x20, 0x00, 0x00, 0x00}, {0x26, 0x00, 0x00, 0x00},
+        {0x37, 0x00, 0x00, 0x00}, {0x2e, 0x00, 0x00, 0x00}
+    },
+    /* 29 */
+    {
+        {0xe8, 0x00, 0x00, 0x00}, {0xe9, 0x00, 0x00, 0x00},
+        {0xf0, 0x00, 0x00, 0x00}, {0xf7, 0x00, 0x00, 0x00},
+        {0xfb, 0x00, 0x00, 0x00}, {0xfc, 0x00, 0x00, 0x00},
+        {0xfe, 0x00, 0x00, 0x00}, {0xff, 0x00, 0x00, 0x00},
+        {0x21, 0x00, 0x00, 0x00}, {0x23, 0x00, 0x00, 0x00},
+        {0x27, 0x00, 0x00, 0x00}, {0x34, 0x00, 0x00, 0x00},
+        {0x38, 0x00, 0x00, 0x00}, {0x3c, 0x00, 0x00, 0x00},
+        {0x3f, 0x00, 0x00, 0x00}, {0x2f, 0x00, 0x00, 0x00}
+    },
+    /* 30 */
+    {
+        {0x00, 0x01, 0xfe, 0x01}, {0x22, 0x00, 0x00, 0x00},
+        {0x24, 0x00, 0x00, 0x00}, {0x25, 0x00, 0x00, 0x00},
+        {0x28, 0x00, 0x00, 0x00}, {0x33, 0x00, 0x00, 0x00},
+        {0x35, 0x00, 0x00, 0x00}, {0x36, 0x00, 0x00, 0x00},
+        {0x39, 0x00, 0x00, 0x00}, {0x3a, 0x00, 0x00, 0x00},
+        {0x3d, 0x00, 0x00, 0x00}, {0x3e, 0x00, 0x00, 0x00},
+        {0x40, 0x00, 0x00, 0x00}, {0x41, 0x00, 0x00, 0x00},
+        {0x93, 0x00, 0x00, 0x00}, {0x30, 0x00, 0x00, 0x00}
+    },
+    /* 31 */
+    {
+        {0x42, 0x01, 0xfe, 0x00}, {0x01, 0x01, 0xfe, 0x01},
+        {0x00, 0x01, 0x02, 0x01}, {0x00, 0x01, 0x03, 0x01},
+        {0x00, 0x01, 0x04, 0x01}, {0x00, 0x01, 0x05, 0x01},
+        {0x00, 0x01, 0x06, 0x01}, {0x00, 0x01, 0x07, 0x01},
+        {0x00, 0x01, 0x08, 0x01}, {0x00, 0x01, 0x0b, 0x01},
+        {0x00, 0x01, 0x0c, 0x01}, {0x00, 0x01, 0x0e, 0x01},
+        {0x00, 0x01, 0x0f, 0x01}, {0x00, 0x01, 0x10, 0x01},
+        {0x00, 0x01, 0x11, 0x01}, {0x00, 0x01, 0x12, 0x01}
+    },
+    /* 32 */
+    {
+        {0x55, 0x01, 0xfe, 0x00}, {0x43, 0x01, 0xfe, 0x00},
+        {0x5d, 0x01, 0xfe, 0x00}, {0x02, 0x01, 0xfe, 0x01},
+        {0x42, 0x01, 0x02, 0x00}, {0x01, 0x01, 0x02, 0x01},
+        {0x42, 0x01, 0x03, 0x00}, {0x01, 0x01, 0x03, 0x01},
+        {0x42, 0x01, 0x04, 0x00}, {0x01, 0x01, 0x04, 0x01},
+        {0x42, 0x01, 0x05, 0x00}, {0x01, 0x01, 0x05, 0x01},
+        {0x42, 0x01, 0x06, 0x00}, {0x01, 0x01, 0x06, 0x01},
+        {0x42, 0x01, 0x07, 0x00}, {0x01, 0x01, 0x07, 0x01}
+    },
+    /* 33 */
+    {
+        {0x56, 0x01, 0xfe, 0x00}, {0x82, 0x01, 0xfe, 0x00},
+        {0x44, 0x01, 0xfe, 0x00}, {0x52, 0x01, 0xfe, 0x00},
+        {0x63, 0x01, 0xfe, 0x00}, {0x5e, 0x01, 0xfe, 0x00},
+        {0x68, 0x01, 0xfe, 0x00}, {0x03, 0x01, 0xfe, 0x01},
+        {0x55, 0x01, 0x02, 0x00}, {0x43, 0x01, 0x02, 0x00},
+        {0x5d, 0x01, 0x02, 0x00}, {0x02, 0x01, 0x02, 0x01},
+        {0x55, 0x01, 0x03, 0x00}, {0x43, 0x01, 0x03, 0x00},
+        {0x5d, 0x01, 0x03, 0x00}, {0x02, 0x01, 0x03, 0x01}
+    },
+    /* 34 */
+    {
+        {0x56, 0x01, 0x02, 0x00}, {0x82, 0x01, 0x02, 0x00},
+        {0x44, 0x01, 0x02, 0x00}, {0x52, 0x01, 0x02, 0x00},
+        {0x63, 0x01, 0x02, 0x00}, {0x5e, 0x01, 0x02, 0x00},
+        {0x68, 0x01, 0x02, 0x00}, {0x03, 0x01, 0x02, 0x01},
+        {0x56, 0x01, 0x03, 0x00}, {0x82, 0x01, 0x03, 0x00},
+        {0x44, 0x01, 0x03, 0x00}, {0x52, 0x01, 0x03, 0x00},
+        {0x63, 0x01, 0x03, 0x00}, {0x5e, 0x01, 0x03, 0x00},
+        {0x68, 0x01, 0x03, 0x00}, {0x03, 0x01, 0x03, 0x01}
+    },
+    /* 35 */
+    {
+        {0x55, 0x01, 0x04, 0x00}, {0x43, 0x01, 0x04, 0x00},
+        {0x5d, 0x01, 0x04, 0x00}, {0x02, 0x01, 0x04, 0x01},
+        {0x55, 0x01, 0x05, 0x00}, {0x43, 0x01, 0x05, 0x00},
+        {0x5d, 0x01, 0x05, 0x00}, {0x02, 0x01, 0x05, 0x01},
+        {0x55, 0x01, 0x06, 0x00}, {0x43, 0x01, 0x06, 0x00},
+        {0x5d, 0x01, 0x06, 0x00}, {0x02, 0x01, 0x06, 0x01},
+        {0x55, 0x01, 0x07, 0x00}, {0x43, 0x01, 0x07, 0x00},
+        {0x5d, 0x01, 0x07, 0x00}, {0x02, 0x01, 0x07, 0x01}
+    },
+    /* 36 */
+    {
+        {0x56, 0x01, 0x04, 0x00}, {0x82, 0x01, 0x04, 0x00},
+        {0x44, 0x01, 0x04, 0x00}, {0x52, 0x01, 0x04, 0x00},
+        {0x63, 0x01, 0x04, 0x00}, {0x5e, 0x01, 0x04, 0x00},
+        {0x68, 0x01, 0x04, 0x00}, {0x03, 0x01, 0x04, 0x01},
+        {0x56, 0x01, 0x05, 0x00}, {0x82, 0x01, 0x05, 0x00},
+        {0x44, 0x01, 0x05, 0x00}, {0x52, 0x01, 0x05, 0x00},
+        {0x63, 0x01, 0x05, 0x00}, {0x5e, 0x01, 0x05, 0x00},
+        {0x68, 0x01, 0x05, 0x00}, {0x03, 0x01, 0x05, 0x01}
+    },
+    /* 37 */
+    {
+        {0x56, 0x01, 0x06, 0x00}, {0x82, 0x01, 0x06, 0x00},
+        {0x44, 0x01, 0x06, 0x00}, {0x52, 0x01, 0x06, 0x00},
+        {0x63, 0x01, 0x06, 0x00}, {0x5e, 0x01, 0x06, 0x00},
+        {0x68, 0x01, 0x06, 0x00}, {0x03, 0x01, 0x06, 0x01},
+        {0x56, 0x01, 0x07, 0x00}, {0x82, 0x01, 0x07, 0x00},
+        {0x44, 0x01, 0x07, 0x00}, {0x52, 0x01, 0x07, 0x00},
+        {0x63, 0x01, 0x07, 0x00}, {0x5e, 0x01, 0x07, 0x00},
+        {0x68, 0x01, 0x07, 0x00}, {0x03, 0x01, 0x07, 0x01}
+    },
+    /* 38 */
+    {
+        {0x42, 0x01, 0x08, 0x00}, {0x01, 0x01, 0x08, 0x01},
+        {0x42, 0x01, 0x0b, 0x00}, {0x01, 0x01, 0x0b, 0x01},
+        {0x42, 0x01, 0x0c, 0x00}, {0x01, 0x01, 0x0c, 0x01},
+        {0x42, 0x01, 0x0e, 0x00}, {0x01, 0x01, 0x0e, 0x01},
+        {0x42, 0x01, 0x0f, 0x00}, {0x01, 0x01, 0x0f, 0x01},
+        {0x42, 0x01, 0x10, 0x00}, {0x01, 0x01, 0x10, 0x01},
+        {0x42, 0x01, 0x11, 0x00}, {0x01, 0x01, 0x11, 0x01},
+        {0x42, 0x01, 0x12, 0x00}, {0x01, 0x01, 0x12, 0x01}
+    },
+    /* 39 */
+    {
+        {0x55, 0x01, 0x08, 0x00}, {0x43, 0x01, 0x08, 0x00},
+        {0x5d, 0x01, 0x08, 0x00}, {0x02, 0x01, 0x08, 0x01},
+        {0x55, 0x01, 0x0b, 0x00}, {0x43, 0x01, 0x0b, 0x00},
+        {0x5d, 0x01, 0x0b, 0x00}, {0x02, 0x01, 0x0b, 0x01},
+        {0x55, 0x01, 0x0c, 0x00}, {0x43, 0x01, 0x0c, 0x00},
+        {0x5d, 0x01, 0x0c, 0x00}, {0x02, 0x01, 0x0c, 0x01},
+        {0x55, 0x01, 0x0e, 0x00}, {0x43, 0x01, 0x0e, 0x00},
+        {0x5d, 0x01, 0x0e, 0x00}, {0x02, 0x01, 0x0e, 0x01}
+    },
+    /* 40 */
+    {
+        {0x56, 0x01, 0x08, 0x00}, {0x82, 0x01, 0x08, 0x00},
+        {0x44, 0x01, 0x08, 0x00}, {0x52, 0x01, 0x08, 0x00},
+        {0x63, 0x01, 0x08, 0x00}, {0x5e, 0x01, 0x08, 0x00},
+        {0x68, 0x01, 0x08, 0x00}, {0x03, 0x01, 0x08, 0x01},
+        {0x56, 0x01, 0x0b, 0x00}, {0x82, 0x01, 0x0b, 0x00},
+        {0x44, 0x01, 0x0b, 0x00}, {0x52, 0x01, 0x0b, 0x00},
+        {0x63, 0x01, 0x0b, 0x00}, {0x5e, 0x01, 0x0b, 0x00},
+        {0x68, 0x01, 0x0b, 0x00}, {0x03, 0x01, 0x0b, 0x01}
+    },
+    /* 41 */
+    {
+        {0x42, 0x01, 0xbc, 0x00}, {0x01, 0x01, 0xbc, 0x01},
+        {0x42, 0x01, 0xbf, 0x00}, {0x01, 0x01, 0xbf, 0x01},
+        {0x42, 0x01, 0xc5, 0x00}, {0x01, 0x01, 0xc5, 0x01},
+        {0x42, 0x01, 0xe7, 0x00}, {0x01, 0x01, 0xe7, 0x01},
+        {0x42, 0x01, 0xef, 0x00}, {0x01, 0x01, 0xef, 0x01},
+        {0x00, 0x01, 0x09, 0x01}, {0x00, 0x01, 0x8e, 0x01},
+        {0x00, 0x01, 0x90, 0x01}, {0x00, 0x01, 0x91, 0x01},
+        {0x00, 0x01, 0x94, 0x01}, {0x00, 0x01, 0x9f, 0x01}
+    },
+    /* 42 */
+    {
+        {0x55, 0x01, 0xef, 0x00}, {0x43, 0x01, 0xef, 0x00},
+        {0x5d, 0x01, 0xef, 0x00}, {0x02, 0x01, 0xef, 0x01},
+        {0x42, 0x01, 0x09, 0x00}, {0x01, 0x01, 0x09, 0x01},
+        {0x42, 0x01, 0x8e, 0x00}, {0x01, 0x01, 0x8e, 0x01},
+        {0x42, 0x01, 0x90, 0x00}, {0x01, 0x01, 0x90, 0x01},
+        {0x42, 0x01, 0x91, 0x00}, {0x01, 0x01, 0x91, 0x01},
+        {0x42, 0x01, 0x94, 0x00}, {0x01, 0x01, 0x94, 0x01},
+        {0x42, 0x01, 0x9f, 0x00}, {0x01, 0x01, 0x9f, 0x01}
+    },
+    /* 43 */
+    {
+        {0x56, 0x01, 0xef, 0x00}, {0x82, 0x01, 0xef, 0x00},
+        {0x44, 0x01, 0xef, 0x00}, {0x52, 0x01, 0xef, 0x00},
+        {0x63, 0x01, 0xef, 0x00}, {0x5e, 0x01, 0xef, 0x00},
+        {0x68, 0x01, 0xef, 0x00}, {0x03, 0x01, 0xef, 0x01},
+        {0x55, 0x01, 0x09, 0x00}, {0x43, 0x01, 0x09, 0x00},
+        {0x5d, 0x01, 0x09, 0x00}, {0x02, 0x01, 0x09, 0x01},
+        {0x55, 0x01, 0x8e, 0x00}, {0x43, 0x01, 0x8e, 0x00},
+        {0x5d, 0x01, 0x8e, 0x00}, {0x02, 0x01, 0x8e, 0x01}
+    },
+    /* 44 */
+    {
+        {0x56, 0x01, 0x09, 0x00}, {0x82, 0x01, 0x09, 0x00},
+        {0x44, 0x01, 0x09, 0x00}, {0x52, 0x01, 0x09, 0x00},
+        {0x63, 0x01, 0x09, 0x00}, {0x5e, 0x01, 0x09, 0x00},
+        {0x68, 0x01, 0x09, 0x00}, {0x03, 0x01, 0x09, 0x01},
+        {0x56, 0x01, 0x8e, 0x00}, {0x82, 0x01, 0x8e, 0x00},
+        {0x44, 0x01, 0x8e, 0x00}, {0x52, 0x01, 0x8e, 0x00},
+        {0x63, 0x01, 0x8e, 0x00}, {0x5e, 0x01, 0x8e, 0x00},
+        {0x68, 0x01, 0x8e, 0x00}, {0x03, 0x01, 0x8e, 0x01}
+    },
+    /* 45 */
+    {
+        {0x00, 0x01, 0x13, 0x01}, {0x00, 0x01, 0x14, 0x01},
+        {0x00, 0x01, 0x15, 0x01}, {0x00, 0x01, 0x17, 0x01},
+        {0x00, 0x01, 0x18, 0x01}, {0x00, 0x01, 0x19, 0x01},
+        {0x00, 0x01, 0x1a, 0x01}, {0x00, 0x01, 0x1b, 0x01},
+        {0x00, 0x01, 0x1c, 0x01}, {0x00, 0x01, 0x1d, 0x01},
+        {0x00, 0x01, 0x1e, 0x01}, {0x00, 0x01, 0x1f, 0x01},
+        {0x00, 0x01, 0x7f, 0x01}, {0x00, 0x01, 0xdc, 0x01},
+        {0x00, 0x01, 0xf9, 0x01}, {0x31, 0x00, 0x00, 0x00}
+    },
+    /* 46 */
+    {
+        {0x42, 0x01, 0x1c, 0x00}, {0x01, 0x01, 0x1c, 0x01},
+        {0x42, 0x01, 0x1d, 0x00}, {0x01, 0x01, 0x1d, 0x01},
+        {0x42, 0x01, 0x1e, 0x00}, {0x01, 0x01, 0x1e, 0x01},
+        {0x42, 0x01, 0x1f, 0x00}, {0x01, 0x01, 0x1f, 0x01},
+        {0x42, 0x01, 0x7f, 0x00}, {0x01, 0x01, 0x7f, 0x01},
+        {0x42, 0x01, 0xdc, 0x00}, {0x01, 0x01, 0xdc, 0x01},
+        {0x42, 0x01, 0xf9, 0x00}, {0x01, 0x01, 0xf9, 0x01},
+        {0x32, 0x00, 0x00, 0x00}, {0x3b, 0x00, 0x00, 0x00}
+    },
+    /* 47 */
+    {
+        {0x55, 0x01, 0x7f, 0x00}, {0x43, 0x01, 0x7f, 0x00},
+        {0x5d, 0x01, 0x7f, 0x00}, {0x02, 0x01, 0x7f, 0x01},
+        {0x55, 0x01, 0xdc, 0x00}, {0x43, 0x01, 0xdc, 0x00},
+        {0x5d, 0x01, 0xdc, 0x00}, {0x02, 0x01, 0xdc, 0x01},
+        {0x55, 0x01, 0xf9, 0x00}, {0x43, 0x01, 0xf9, 0x00},
+        {0x5d, 0x01, 0xf9, 0x00}, {0x02, 0x01, 0xf9, 0x01},
+        {0x00, 0x01, 0x0a, 0x01}, {0x00, 0x01, 0x0d, 0x01},
+        {0x00, 0x01, 0x16, 0x01}, {0x2f, 0x00, 0x00, 0x00}
+    },
+    /* 48 */
+    {
+        {0x56, 0x01, 0xf9, 0x00}, {0x82, 0x01, 0xf9, 0x00},
+        {0x44, 0x01, 0xf9, 0x00}, {0x52, 0x01, 0xf9, 0x00},
+        {0x63, 0x01, 0xf9, 0x00}, {0x5e, 0x01, 0xf9, 0x00},
+        {0x68, 0x01, 0xf9, 0x00}, {0x03, 0x01, 0xf9, 0x01},
+        {0x42, 0x01, 0x0a, 0x00}, {0x01, 0x01, 0x0a, 0x01},
+        {0x42, 0x01, 0x0d, 0x00}, {0x01, 0x01, 0x0d, 0x01},
+        {0x42, 0x01, 0x16, 0x00}, {0x01, 0x01, 0x16, 0x01},
+        {0x30, 0x00, 0x00, 0x00}, {0x30, 0x00, 0x00, 0x00}
+    },
+    /* 49 */
+    {
+        {0x55, 0x01, 0x0a, 0x00}, {0x43, 0x01, 0x0a, 0x00},
+        {0x5d, 0x01, 0x0a, 0x00}, {0x02, 0x01, 0x0a, 0x01},
+        {0x55, 0x01, 0x0d, 0x00}, {0x43, 0x01, 0x0d, 0x00},
+        {0x5d, 0x01, 0x0d, 0x00}, {0x02, 0x01, 0x0d, 0x01},
+        {0x55, 0x01, 0x16, 0x00}, {0x43, 0x01, 0x16, 0x00},
+        {0x5d, 0x01, 0x16, 0x00}, {0x02, 0x01, 0x16, 0x01},
+        {0x31, 0x00, 0x00, 0x00}, {0x31, 0x00, 0x00, 0x00},
+        {0x31, 0x00, 0x00, 0x00}, {0x31, 0x00, 0x00, 0x00}
+    },
+    /* 50 */
+    {
+        {0x56, 0x01, 0x0a, 0x00}, {0x82, 0x01, 0x0a, 0x00},
+        {0x44, 0x01, 0x0a, 0x00}, {0x52, 0x01, 0x0a, 0x00},
+        {0x63, 0x01, 0x0a, 0x00}, {0x5e, 0x01, 0x0a, 0x00},
+        {0x68, 0x01, 0x0a, 0x00}, {0x03, 0x01, 0x0a, 0x01},
+        {0x56, 0x01, 0x0d, 0x00}, {0x82, 0x01, 0x0d, 0x00},
+        {0x44, 0x01, 0x0d, 0x00}, {0x52, 0x01, 0x0d, 0x00},
+        {0x63, 0x01, 0x0d, 0x00}, {0x5e, 0x01, 0x0d, 0x00},
+        {0x68, 0x01, 0x0d, 0x00}, {0x03, 0x01, 0x0d, 0x01}
+    },
+    /* 51 */
+    {
+        {0x56, 0x01, 0x0c, 0x00}, {0x82, 0x01, 0x0c, 0x00},
+        {0x44, 0x01, 0x0c, 0x00}, {0x52, 0x01, 0x0c, 0x00},
+        {0x63, 0x01, 0x0c, 0x00}, {0x5e, 0x01, 0x0c, 0x00},
+        {0x68, 0x01, 0x0c, 0x00}, {0x03, 0x01, 0x0c, 0x01},
+        {0x56, 0x01, 0x0e, 0x00}, {0x82, 0x01, 0x0e, 0x00},
+        {0x44, 0x01, 0x0e, 0x00}, {0x52, 0x01, 0x0e, 0x00},
+        {0x63, 0x01, 0x0e, 0x00}, {0x5e, 0x01, 0x0e, 0x00},
+        {0x68, 0x01, 0x0e, 0x00}, {0x03, 0x01, 0x0e, 0x01}
+    },
+    /* 52 */
+    {
+        {0x55, 0x01, 0x0f, 0x00}, {0x43, 0x01, 0x0f, 0x00},
+        {0x5d, 0x01, 0x0f, 0x00}, {0x02, 0x01, 0x0f, 0x01},
+        {0x55, 0x01, 0x10, 0x00}, {0x43, 0x01, 0x10, 0x00},
+        {0x5d, 0x01, 0x10, 0x00}, {0x02, 0x01, 0x10, 0x01},
+        {0x55, 0x01, 0x11, 0x00}, {0x43, 0x01, 0x11, 0x00},
+        {0x5d, 0x01, 0x11, 0x00}, {0x02, 0x01, 0x11, 0x01},
+        {0x55, 0x01, 0x12, 0x00}, {0x43, 0x01, 0x12, 0x00},
+        {0x5d, 0x01, 0x12, 0x00}, {0x02, 0x01, 0x12, 0x01}
+    },
+    /* 53 */
+    {
+        {0x56, 0x01, 0x0f, 0x00}, {0x82, 0x01, 0x0f, 0x00},
+        {0x44, 0x01, 0x0f, 0x00}, {0x52, 0x01, 0x0f, 0x00},
+        {0x63, 0x01, 0x0f, 0x00}, {0x5e, 0x01, 0x0f, 0x00},
+        {0x68, 0x01, 0x0f, 0x00}, {0x03, 0x01, 0x0f, 0x01},
+        {0x56, 0x01, 0x10, 0x00}, {0x82, 0x01, 0x10, 0x00},
+        {0x44, 0x01, 0x10, 0x00}, {0x52, 0x01, 0x10, 0x00},
+        {0x63, 0x01, 0x10, 0x00}, {0x5e, 0x01, 0x10, 0x00},
+        {0x68, 0x01, 0x10, 0x00}, {0x03, 0x01, 0x10, 0x01}
+    },
+    /* 54 */
+    {
+        {0x56, 0x01, 0x11, 0x00}, {0x82, 0x01, 0x11, 0x00},
+        {0x44, 0x01, 0x11, 0x00}, {0x52, 0x01, 0x11, 0x00},
+        {0x63, 0x01, 0x11, 0x00}, {0x5e, 0x01, 0x11, 0x00},
+        {0x68, 0x01, 0x11, 0x00}, {0x03, 0x01, 0x11, 0x01},
+        {0x56, 0x01, 0x12, 0x00}, {0x82, 0x01, 0x12, 0x00},
+        {0x44, 0x01, 0x12, 0x00}, {0x52, 0x01, 0x12, 0x00},
+        {0x63, 0x01, 0x12, 0x00}, {0x5e, 0x01, 0x12, 0x00},
+        {0x68, 0x01, 0x12, 0x00}, {0x03, 0x01, 0x12, 0x01}
+    },
+    /* 55 */
+    {
+        {0x42, 0x01, 0x13, 0x00}, {0x01, 0x01, 0x13, 0x01},
+        {0x42, 0x01, 0x14, 0x00}, {0x01, 0x01, 0x14, 0x01},
+        {0x42, 0x01, 0x15, 0x00}, {0x01, 0x01, 0x15, 0x01},
+        {0x42, 0x01, 0x17, 0x00}, {0x01, 0x01, 0x17, 0x01},
+        {0x42, 0x01, 0x18, 0x00}, {0x01, 0x01, 0x18, 0x01},
+        {0x42, 0x01, 0x19, 0x00}, {0x01, 0x01, 0x19, 0x01},
+        {0x42, 0x01, 0x1a, 0x00}, {0x01, 0x01, 0x1a, 0x01},
+        {0x42, 0x01, 0x1b, 0x00}, {0x01, 0x01, 0x1b, 0x01}
+    },
+    /* 56 */
+    {
+        {0x55, 0x01, 0x13, 0x00}, {0x43, 0x01, 0x13, 0x00},
+        {0x5d, 0x01, 0x13, 0x00}, {0x02, 0x01, 0x13, 0x01},
+        {0x55, 0x01, 0x14, 0x00}, {0x43, 0x01, 0x14, 0x00},
+        {0x5d, 0x01, 0x14, 0x00}, {0x02, 0x01, 0x14, 0x01},
+        {0x55, 0x01, 0x15, 0x00}, {0x43, 0x01, 0x15, 0x00},
+        {0x5d, 0x01, 0x15, 0x00}, {0x02, 0x01, 0x15, 0x01},
+        {0x55, 0x01, 0x17, 0x00}, {0x43, 0x01, 0x17, 0x00},
+        {0x5d, 0x01, 0x17, 0x00}, {0x02, 0x01, 0x17, 0x01}
+    },
+    /* 57 */
+    {
+        {0x56, 0x01, 0x13, 0x00}, {0x82, 0x01, 0x13, 0x00},
+        {0x44, 0x01, 0x13, 0x00}, {0x52, 0x01, 0x13, 0x00},
+        {0x63, 0x01, 0x13, 0x00}, {0x5e, 0x01, 0x13, 0x00},
+        {0x68, 0x01, 0x13, 0x00}, {0x03, 0x01, 0x13, 0x01},
+        {0x56, 0x01, 0x14, 0x00}, {0x82, 0x01, 0x14, 0x00},
+        {0x44, 0x01, 0x14, 0x00}, {0x52, 0x01, 0x14, 0x00},
+        {0x63, 0x01, 0x14, 0x00}, {0x5e, 0x01, 0x14, 0x00},
+        {0x68, 0x01, 0x14, 0x00}, {0x03, 0x01, 0x14, 0x01}
+    },
+    /* 58 */
+    {
+        {0x56, 0x01, 0x15, 0x00}, {0x82, 0x01, 0x15, 0x00},
+        {0x44, 0x01, 0x15, 0x00}, {0x52, 0x01, 0x15, 0x00},
+        {0x63, 0x01, 0x15, 0x00}, {0x5e, 0x01, 0x15, 0x00},
+        {0x68, 0x01, 0x15, 0x00}, {0x03, 0x01, 0x15, 0x01},
+        {0x56, 0x01, 0x17, 0x00}, {0x82, 0x01, 0x17, 0x00},
+        {0x44, 0x01, 0x17, 0x00}, {0x52, 0x01, 0x17, 0x00},
+        {0x63, 0x01, 0x17, 0x00}, {0x5e, 0x01, 0x17, 0x00},
+        {0x68, 0x01, 0x17, 0x00}, {0x03, 0x01, 0x17, 0x01}
+    },
+    /* 59 */
+    {
+        {0x56, 0x01, 0x16, 0x00}, {0x82, 0x01, 0x16, 0x00},
+        {0x44, 0x01, 0x16, 0x00}, {0x52, 0x01, 0x16, 0x00},
+        {0x63, 0x01, 0x16, 0x00}, {0x5e, 0x01, 0x16, 0x00},
+        {0x68, 0x01, 0x16, 0x00}, {0x03, 0x01, 0x16, 0x01},
+        {0x3b, 0x00, 0x00, 0x00}, {0x3b, 0x00, 0x00, 0x00},
+        {0x3b, 0x00, 0x00, 0x00}, {0x3b, 0x00, 0x00, 0x00},
+        {0x3b, 0x00, 0x00, 0x00}, {0x3b, 0x00, 0x00, 0x00},
+        {0x3b, 0x00, 0x00, 0x00}, {0x3b, 0x00, 0x00, 0x00}
+    },
+    /* 60 */
+    {
+        {0x55, 0x01, 0x18, 0x00}, {0x43, 0x01, 0x18, 0x00},
+        {0x5d, 0x01, 0x18, 0x00}, {0x02, 0x01, 0x18, 0x01},
+        {0x55, 0x01, 0x19, 0x00}, {0x43, 0x01, 0x19, 0x00},
+        {0x5d, 0x01, 0x19, 0x00}, {0x02, 0x01, 0x19, 0x01},
+        {0x55, 0x01, 0x1a, 0x00}, {0x43, 0x01, 0x1a, 0x00},
+        {0x5d, 0x01, 0x1a, 0x00}, {0x02, 0x01, 0x1a, 0x01},
+        {0x55, 0x01, 0x1b, 0x00}, {0x43, 0x01, 0x1b, 0x00},
+        {0x5d, 0x01, 0x1b, 0x00}, {0x02, 0x01, 0x1b, 0x01}
+    },
+    /* 61 */
+    {
+        {0x56, 0x01, 0x18, 0x00}, {0x82, 0x01, 0x18, 0x00},
+        {0x44, 0x01, 0x18, 0x00}, {0x52, 0x01, 0x18, 0x00},
+        {0x63, 0x01, 0x18, 0x00}, {0x5e, 0x01, 0x18, 0x00},
+        {0x68, 0x01, 0x18, 0x00}, {0x03, 0x01, 0x18, 0x01},
+        {0x56, 0x01, 0x19, 0x00}, {0x82, 0x01, 0x19, 0x00},
+        {0x44, 0x01, 0x19, 0x00}, {0x52, 0x01, 0x19, 0x00},
+        {0x63, 0x01, 0x19, 0x00}, {0x5e, 0x01, 0x19, 0x00},
+        {0x68, 0x01, 0x19, 0x00}, {0x03, 0x01, 0x19, 0x01}
+    },
+    /* 62 */
+    {
+        {0x56, 0x01, 0x1a, 0x00}, {0x82, 0x01, 0x1a, 0x00},
+        {0x44, 0x01, 0x1a, 0x00}, {0x52, 0x01, 0x1a, 0x00},
+        {0x63, 0x01, 0x1a, 0x00}, {0x5e, 0x01, 0x1a, 0x00},
+        {0x68, 0x01, 0x1a, 0x00}, {0x03, 0x01, 0x1a, 0x01},
+        {0x56, 0x01, 0x1b, 0x00}, {0x82, 0x01, 0x1b, 0x00},
+        {0x44, 0x01, 0x1b, 0x00}, {0x52, 0x01, 0x1b, 0x00},
+        {0x63, 0x01, 0x1b, 0x00}, {0x5e, 0x01, 0x1b, 0x00},
+        {0x68, 0x01, 0x1b, 0x00}, {0x03, 0x01, 0x1b, 0x01}
+    },
+    /* 63 */
+    {
+        {0x55, 0x01, 0x1c, 0x00}, {0x43, 0x01, 0x1c, 0x00},
+        {0x5d, 0x01, 0x1c, 0x00}, {0x02, 0x01, 0x1c, 0x01},
+        {0x55, 0x01, 0x1d, 0x00}, {0x43, 0x01, 0x1d, 0x00},
+        {0x5d, 0x01, 0x1d, 0x00}, {0x02, 0x01, 0x1d, 0x01},
+        {0x55, 0x01, 0x1e, 0x00}, {0x43, 0x01, 0x1e, 0x00},
+        {0x5d, 0x01, 0x1e, 0x00}, {0x02, 0x01, 0x1e, 0x01},
+        {0x55, 0x01, 0x1f, 0x00}, {0x43, 0x01, 0x1f, 0x00},
+        {0x5d, 0x01, 0x1f, 0x00}, {0x02, 0x01, 0x1f, 0x01}
+    },
+    /* 64 */
+    {
+        {0x56, 0x01, 0x1c, 0x00}, {0x82, 0x01, 0x1c, 0x00},
+        {0x44, 0x01, 0x1c, 0x00}, {0x52, 0x01, 0x1c, 0x00},
+        {0x63, 0x01, 0x1c, 0x00}, {0x5e, 0x01, 0x1c, 0x00},
+        {0x68, 0x01, 0x1c, 0x00}, {0x03, 0x01, 0x1c, 0x01},
+        {0x56, 0x01, 0x1d, 0x00}, {0x82, 0x01, 0x1d, 0x00},
+        {0x44, 0x01, 0x1d, 0x00}, {0x52, 0x01, 0x1d, 0x00},
+        {0x63, 0x01, 0x1d, 0x00}, {0x5e, 0x01, 0x1d, 0x00},
+        {0x68, 0x01, 0x1d, 0x00}, {0x03, 0x01, 0x1d, 0x01}
+    },
+    /* 65 */
+    {
+        {0x56, 0x01, 0x1e, 0x00}, {0x82, 0x01, 0x1e, 0x00},
+        {0x44, 0x01, 0x1e, 0x00}, {0x52, 0x01, 0x1e, 0x00},
+        {0x63, 0x01, 0x1e, 0x00}, {0x5e, 0x01, 0x1e, 0x00},
+        {0x68, 0x01, 0x1e, 0x00}, {0x03, 0x01, 0x1e, 0x01},
+        {0x56, 0x01, 0x1f, 0x00}, {0x82, 0x01, 0x1f, 0x00},
+        {0x44, 0x01, 0x1f, 0x00}, {0x52, 0x01, 0x1f, 0x00},
+        {0x63, 0x01, 0x1f, 0x00}, {0x5e, 0x01, 0x1f, 0x00},
+        {0x68, 0x01, 0x1f, 0x00}, {0x03, 0x01, 0x1f, 0x01}
+    },
+    /* 66 */
+    {
+        {0x00, 0x01, 0x30, 0x01}, {0x00, 0x01, 0x31, 0x01},
+        {0x00, 0x01, 0x32, 0x01}, {0x00, 0x01, 0x61, 0x01},
+        {0x00, 0x01, 0x63, 0x01}, {0x00, 0x01, 0x65, 0x01},
+        {0x00, 0x01, 0x69, 0x01}, {0x00, 0x01, 0x6f, 0x01},
+        {0x00, 0x01, 0x73, 0x01}, {0x00, 0x01, 0x74, 0x01},
+        {0x46, 0x00, 0x00, 0x00}, {0x51, 0x00, 0x00, 0x00},
+        {0x54, 0x00, 0x00, 0x00}, {0x59, 0x00, 0x00, 0x00},
+        {0x5b, 0x00, 0x00, 0x00}, {0x5c, 0x00, 0x00, 0x00}
+    },
+    /* 67 */
+    {
+        {0x42, 0x01, 0x73, 0x00}, {0x01, 0x01, 0x73, 0x01},
+        {0x42, 0x01, 0x74, 0x00}, {0x01, 0x01, 0x74, 0x01},
+        {0x00, 0x01, 0x20, 0x01}, {0x00, 0x01, 0x25, 0x01},
+        {0x00, 0x01, 0x2d, 0x01}, {0x00, 0x01, 0x2e, 0x01},
+        {0x00, 0x01, 0x2f, 0x01}, {0x00, 0x01, 0x33, 0x01},
+        {0x00, 0x01, 0x34, 0x01}, {0x00, 0x01, 0x35, 0x01},
+        {0x00, 0x01, 0x36, 0x01}, {0x00, 0x01, 0x37, 0x01},
+        {0x00, 0x01, 0x38, 0x01}, {0x00, 0x01, 0x39, 0x01}
+    },
+    /* 68 */
+    {
+        {0x55, 0x01, 0x73, 0x00}, {0x43, 0x01, 0x73, 0x00},
+        {0x5d, 0x01, 0x73, 0x00}, {0x02, 0x01, 0x73, 0x01},
+        {0x55, 0x01, 0x74, 0x00}, {0x43, 0x01, 0x74, 0x00},
+        {0x5d, 0x01, 0x74, 0x00}, {0x02, 0x01, 0x74, 0x01},
+        {0x42, 0x01, 0x20, 0x00}, {0x01, 0x01, 0x20, 0x01},
+        {0x42, 0x01, 0x25, 0x00}, {0x01, 0x01, 0x25, 0x01},
+        {0x42, 0x01, 0x2d, 0x00}, {0x01, 0x01, 0x2d, 0x01},
+        {0x42, 0x01, 0x2e, 0x00}, {0x01, 0x01, 0x2e, 0x01}
+    },
+    /* 69 */
+    {
+        {0x55, 0x01, 0x20, 0x00}, {0x43, 0x01, 0x20, 0x00},
+        {0x5d, 0x01, 0x20, 0x00}, {0x02, 0x01, 0x20, 0x01},
+        {0x55, 0x01, 0x25, 0x00}, {0x43, 0x01, 0x25, 0x00},
+        {0x5d, 0x01, 0x25, 0x00}, {0x02, 0x01, 0x25, 0x01},
+        {0x55, 0x01, 0x2d, 0x00}, {0x43, 0x01, 0x2d, 0x00},
+        {0x5d, 0x01, 0x2d, 0x00}, {0x02, 0x01, 0x2d, 0x01},
+        {0x55, 0x01, 0x2e, 0x00}, {0x43, 0x01, 0x2e, 0x00},
+        {0x5d, 0x01, 0x2e, 0x00}, {0x02, 0x01, 0x2e, 0x01}
+    },
+    /* 70 */
+    {
+        {0x56, 0x01, 0x20, 0x00}, {0x82, 0x01, 0x20, 0x00},
+        {0x44, 0x01, 0x20, 0x00}, {0x52, 0x01, 0x20, 0x00},
+        {0x63, 0x01, 0x20, 0x00}, {0x5e, 0x01, 0x20, 0x00},
+        {0x68, 0x01, 0x20, 0x00}, {0x03, 0x01, 0x20, 0x01},
+        {0x56, 0x01, 0x25, 0x00}, {0x82, 0x01, 0x25, 0x00},
+        {0x44, 0x01, 0x25, 0x00}, {0x52, 0x01, 0x25, 0x00},
+        {0x63, 0x01, 0x25, 0x00}, {0x5e, 0x01, 0x25, 0x00},
+        {0x68, 0x01, 0x25, 0x00}, {0x03, 0x01, 0x25, 0x01}
+    },
+    /* 71 */
+    {
+        {0x55, 0x01, 0x21, 0x00}, {0x43, 0x01, 0x21, 0x00},
+        {0x5d, 0x01, 0x21, 0x00}, {0x02, 0x01, 0x21, 0x01},
+        {0x55, 0x01, 0x22, 0x00}, {0x43, 0x01, 0x22, 0x00},
+        {0x5d, 0x01, 0x22, 0x00}, {0x02, 0x01, 0x22, 0x01},
+        {0x55, 0x01, 0x28, 0x00}, {0x43, 0x01, 0x28, 0x00},
+        {0x5d, 0x01, 0x28, 0x00}, {0x02, 0x01, 0x28, 0x01},
+        {0x55, 0x01, 0x29, 0x00}, {0x43, 0x01, 0x29, 0x00},
+        {0x5d, 0x01, 0x29, 0x00}, {0x02, 0x01, 0x29, 0x01}
+    },
+    /* 72 */
+    {
+        {0x56, 0x01, 0x21, 0x00}, {0x82, 0x01, 0x21, 0x00},
+        {0x44, 0x01, 0x21, 0x00}, {0x52, 0x01, 0x21, 0x00},
+        {0x63, 0x01, 0x21, 0x00}, {0x5e, 0x01, 0x21, 0x00},
+        {0x68, 0x01, 0x21, 0x00}, {0x03, 0x01, 0x21, 0x01},
+        {0x56, 0x01, 0x22, 0x00}, {0x82, 0x01, 0x22, 0x00},
+        {0x44, 0x01, 0x22, 0x00}, {0x52, 0x01, 0x22, 0x00},
+        {0x63, 0x01, 0x22, 0x00}, {0x5e, 0x01, 0x22, 0x00},
+        {0x68, 0x01, 0x22, 0x00}, {0x03, 0x01, 0x22, 0x01}
+    },
+    /* 73 */
+    {
+        {0x56, 0x01, 0x7c, 0x00}, {0x82, 0x01, 0x7c, 0x00},
+        {0x44, 0x01, 0x7c, 0x00}, {0x52, 0x01, 0x7c, 0x00},
+        {0x63, 0x01, 0x7c, 0x00}, {0x5e, 0x01, 0x7c, 0x00},
+        {0x68, 0x01, 0x7c, 0x00}, {0x03, 0x01, 0x7c, 0x01},
+        {0x55, 0x01, 0x23, 0x00}, {0x43, 0x01, 0x23, 0x00},
+        {0x5d, 0x01, 0x23, 0x00}, {0x02, 0x01, 0x23, 0x01},
+        {0x55, 0x01, 0x3e, 0x00}, {0x43, 0x01, 0x3e, 0x00},
+        {0x5d, 0x01, 0x3e, 0x00}, {0x02, 0x01, 0x3e, 0x01}
+    },
+    /* 74 */
+    {
+        {0x56, 0x01, 0x23, 0x00}, {0x82, 0x01, 0x23, 0x00},
+        {0x44, 0x01, 0x23, 0x00}, {0x52, 0x01, 0x23, 0x00},
+        {0x63, 0x01, 0x23, 0x00}, {0x5e, 0x01, 0x23, 0x00},
+        {0x68, 0x01, 0x23, 0x00}, {0x03, 0x01, 0x23, 0x01},
+        {0x56, 0x01, 0x3e, 0x00}, {0x82, 0x01, 0x3e, 0x00},
+        {0x44, 0x01, 0x3e, 0x00}, {0x52, 0x01, 0x3e, 0x00},
+        {0x63, 0x01, 0x3e, 0x00}, {0x5e, 0x01, 0x3e, 0x00},
+        {0x68, 0x01, 0x3e, 0x00}, {0x03, 0x01, 0x3e, 0x01}
+    },
+    /* 75 */
+    {
+        {0x55, 0x01, 0x26, 0x00}, {0x43, 0x01, 0x26, 0x00},
+        {0x5d, 0x01, 0x26, 0x00}, {0x02, 0x01, 0x26, 0x01},
+        {0x55, 0x01, 0x2a, 0x00}, {0x43, 0x01, 0x2a, 0x00},
+        {0x5d, 0x01, 0x2a, 0x00}, {0x02, 0x01, 0x2a, 0x01},
+        {0x55, 0x01, 0x2c, 0x00}, {0x43, 0x01, 0x2c, 0x00},
+        {0x5d, 0x01, 0x2c, 0x00}, {0x02, 0x01, 0x2c, 0x01},
+        {0x55, 0x01, 0x3b, 0x00}, {0x43, 0x01, 0x3b, 0x00},
+        {0x5d, 0x01, 0x3b, 0x00}, {0x02, 0x01, 0x3b, 0x01}
+    },
+    /* 76 */
+    {
+        {0x56, 0x01, 0x26, 0x00}, {0x82, 0x01, 0x26, 0x00},
+        {0x44, 0x01, 0x26, 0x00}, {0x52, 0x01, 0x26, 0x00},
+        {0x63, 0x01, 0x26, 0x00}, {0x5e, 0x01, 0x26, 0x00},
+        {0x68, 0x01, 0x26, 0x00}, {0x03, 0x01, 0x26, 0x01},
+        {0x56, 0x01, 0x2a, 0x00}, {0x82, 0x01, 0x2a, 0x00},
+        {0x44, 0x01, 0x2a, 0x00}, {0x52, 0x01, 0x2a, 0x00},
+        {0x63, 0x01, 0x2a, 0x00}, {0x5e, 0x01, 0x2a, 0x00},
+        {0x68, 0x01, 0x2a, 0x00}, {0x03, 0x01, 0x2a, 0x01}
+    },
+    /* 77 */
+    {
+        {0x56, 0x01, 0x3f, 0x00}, {0x82, 0x01, 0x3f, 0x00},
+        {0x44, 0x01, 0x3f, 0x00}, {0x52, 0x01, 0x3f, 0x00},
+        {0x63, 0x01, 0x3f, 0x00}, {0x5e, 0x01, 0x3f, 0x00},
+        {0x68, 0x01, 0x3f, 0x00}, {0x03, 0x01, 0x3f, 0x01},
+        {0x55, 0x01, 0x27, 0x00}, {0x43, 0x01, 0x27, 0x00},
+        {0x5d, 0x01, 0x27, 0x00}, {0x02, 0x01, 0x27, 0x01},
+        {0x55, 0x01, 0x2b, 0x00}, {0x43, 0x01, 0x2b, 0x00},
+        {0x5d, 0x01, 0x2b, 0x00}, {0x02, 0x01, 0x2b, 0x01}
+    },
+    /* 78 */
+    {
+        {0x56, 0x01, 0x27, 0x00}, {0x82, 0x01, 0x27, 0x00},
+        {0x44, 0x01, 0x27, 0x00}, {0x52, 0x01, 0x27, 0x00},
+        {0x63, 0x01, 0x27, 0x00}, {0x5e, 0x01, 0x27, 0x00},
+        {0x68, 0x01, 0x27, 0x00}, {0x03, 0x01, 0x27, 0x01},
+        {0x56, 0x01, 0x2b, 0x00}, {0x82, 0x01, 0x2b, 0x00},
+        {0x44, 0x01, 0x2b, 0x00}, {0x52, 0x01, 0x2b, 0x00},
+        {0x63, 0x01, 0x2b, 0x00}, {0x5e, 0x01, 0x2b, 0x00},
+        {0x68, 0x01, 0x2b, 0x00}, {0x03, 0x01, 0x2b, 0x01}
+    },
+    /* 79 */
+    {
+        {0x56, 0x01, 0x28, 0x00}, {0x82, 0x01, 0x28, 0x00},
+        {0x44, 0x01, 0x28, 0x00}, {0x52, 0x01, 0x28, 0x00},
+        {0x63, 0x01, 0x28, 0x00}, {0x5e, 0x01, 0x28, 0x00},
+        {0x68, 0x01, 0x28, 0x00}, {0x03, 0x01, 0x28, 0x01},
+        {0x56, 0x01, 0x29, 0x00}, {0x82, 0x01, 0x29, 0x00},
+        {0x44, 0x01, 0x29, 0x00}, {0x52, 0x01, 0x29, 0x00},
+        {0x63, 0x01, 0x29, 0x00}, {0x5e, 0x01, 0x29, 0x00},
+        {0x68, 0x01, 0x29, 0x00}, {0x03, 0x01, 0x29, 0x01}
+    },
+    /* 80 */
+    {
+        {0x56, 0x01, 0x2c, 0x00}, {0x82, 0x01, 0x2c, 0x00},
+        {0x44, 0x01, 0x2c, 0x00}, {0x52, 0x01, 0x2c, 0x00},
+        {0x63, 0x01, 0x2c, 0x00}, {0x5e, 0x01, 0x2c, 0x00},
+        {0x68, 0x01, 0x2c, 0x00}, {0x03, 0x01, 0x2c, 0x01},
+        {0x56, 0x01, 0x3b, 0x00}, {0x82, 0x01, 0x3b, 0x00},
+        {0x44, 0x01, 0x3b, 0x00}, {0x52, 0x01, 0x3b, 0x00},
+        {0x63, 0x01, 0x3b, 0x00}, {0x5e, 0x01, 0x3b, 0x00},
+        {0x68, 0x01, 0x3b, 0x00}, {0x03, 0x01, 0x3b, 0x01}
+    },
+    /* 81 */
+    {
+        {0x56, 0x01, 0x2d, 0x00}, {0x82, 0x01, 0x2d, 0x00},
+        {0x44, 0x01, 0x2d, 0x00}, {0x52, 0x01, 0x2d, 0x00},
+        {0x63, 0x01, 0x2d, 0x00}, {0x5e, 0x01, 0x2d, 0x00},
+        {0x68, 0x01, 0x2d, 0x00}, {0x03, 0x01, 0x2d, 0x01},
+        {0x56, 0x01, 0x2e, 0x00}, {0x82, 0x01, 0x2e, 0x00},
+        {0x44, 0x01, 0x2e, 0x00}, {0x52, 0x01, 0x2e, 0x00},
+        {0x63, 0x01, 0x2e, 0x00}, {0x5e, 0x01, 0x2e, 0x00},
+        {0x68, 0x01, 0x2e, 0x00}, {0x03, 0x01, 0x2e, 0x01}
+    },
+    /* 82 */
+    {
+        {0x42, 0x01, 0x2f, 0x00}, {0x01, 0x01, 0x2f, 0x01},
+        {0x42, 0x01, 0x33, 0x00}, {0x01, 0x01, 0x33, 0x01},
+        {0x42, 0x01, 0x34, 0x00}, {0x01, 0x01, 0x34, 0x01},
+        {0x42, 0x01, 0x35, 0x00}, {0x01, 0x01, 0x35, 0x01},
+        {0x42, 0x01, 0x36, 0x00}, {0x01, 0x01, 0x36, 0x01},
+        {0x42, 0x01, 0x37, 0x00}, {0x01, 0x01, 0x37, 0x01},
+        {0x42, 0x01, 0x38, 0x00}, {0x01, 0x01, 0x38, 0x01},
+        {0x42, 0x01, 0x39, 0x00}, {0x01, 0x01, 0x39, 0x01}
+    },
+    /* 83 */
+    {
+        {0x55, 0x01, 0x2f, 0x00}, {0x43, 0x01, 0x2f, 0x00},
+        {0x5d, 0x01, 0x2f, 0x00}, {0x02, 0x01, 0x2f, 0x01},
+        {0x55, 0x01, 0x33, 0x00}, {0x43, 0x01, 0x33, 0x00},
+        {0x5d, 0x01, 0x33, 0x00}, {0x02, 0x01, 0x33, 0x01},
+        {0x55, 0x01, 0x34, 0x00}, {0x43, 0x01, 0x34, 0x00},
+        {0x5d, 0x01, 0x34, 0x00}, {0x02, 0x01, 0x34, 0x01},
+        {0x55, 0x01, 0x35, 0x00}, {0x43, 0x01, 0x35, 0x00},
+        {0x5d, 0x01, 0x35, 0x00}, {0x02, 0x01, 0x35, 0x01}
+    },
+    /* 84 */
+    {
+        {0x56, 0x01, 0x2f, 0x00}, {0x82, 0x01, 0x2f, 0x00},
+        {0x44, 0x01, 0x2f, 0x00}, {0x52, 0x01, 0x2f, 0x00},
+        {0x63, 0x01, 0x2f, 0x00}, {0x5e, 0x01, 0x2f, 0x00},
+        {0x68, 0x01, 0x2f, 0x00}, {0x03, 0x01, 0x2f, 0x01},
+        {0x56, 0x01, 0x33, 0x00}, {0x82, 0x01, 0x33, 0x00},
+        {0x44, 0x01, 0x33, 0x00}, {0x52, 0x01, 0x33, 0x00},
+        {0x63, 0x01, 0x33, 0x00}, {0x5e, 0x01, 0x33, 0x00},
+        {0x68, 0x01, 0x33, 0x00}, {0x03, 0x01, 0x33, 0x01}
+    },
+    /* 85 */
+    {
+        {0x42, 0x01, 0x30, 0x00}, {0x01, 0x01, 0x30, 0x01},
+        {0x42, 0x01, 0x31, 0x00}, {0x01, 0x01, 0x31, 0x01},
+        {0x42, 0x01, 0x32, 0x00}, {0x01, 0x01, 0x32, 0x01},
+        {0x42, 0x01, 0x61, 0x00}, {0x01, 0x01, 0x61, 0x01},
+        {0x42, 0x01, 0x63, 0x00}, {0x01, 0x01, 0x63, 0x01},
+        {0x42, 0x01, 0x65, 0x00}, {0x01, 0x01, 0x65, 0x01},
+        {0x42, 0x01, 0x69, 0x00}, {0x01, 0x01, 0x69, 0x01},
+        {0x42, 0x01, 0x6f, 0x00}, {0x01, 0x01, 0x6f, 0x01}
+    },
+    /* 86 */
+    {
+        {0x55, 0x01, 0x30, 0x00}, {0x43, 0x01, 0x30, 0x00},
+        {0x5d, 0x01, 0x30, 0x00}, {0x02, 0x01, 0x30, 0x01},
+        {0x55, 0x01, 0x31, 0x00}, {0x43, 0x01, 0x31, 0x00},
+        {0x5d, 0x01, 0x31, 0x00}, {0x02, 0x01, 0x31, 0x01},
+        {0x55, 0x01, 0x32, 0x00}, {0x43, 0x01, 0x32, 0x00},
+        {0x5d, 0x01, 0x32, 0x00}, {0x02, 0x01, 0x32, 0x01},
+        {0x55, 0x01, 0x61, 0x00}, {0x43, 0x01, 0x61, 0x00},
+        {0x5d, 0x01, 0x61, 0x00}, {0x02, 0x01, 0x61, 0x01}
+    },
+    /* 87 */
+    {
+        {0x56, 0x01, 0x30, 0x00}, {0x82, 0x01, 0x30, 0x00},
+        {0x44, 0x01, 0x30, 0x00}, {0x52, 0x01, 0x30, 0x00},
+        {0x63, 0x01, 0x30, 0x00}, {0x5e, 0x01, 0x30, 0x00},
+        {0x68, 0x01, 0x30, 0x00}, {0x03, 0x01, 0x30, 0x01},
+        {0x56, 0x01, 0x31, 0x00}, {0x82, 0x01, 0x31, 0x00},
+        {0x44, 0x01, 0x31, 0x00}, {0x52, 0x01, 0x31, 0x00},
+        {0x63, 0x01, 0x31, 0x00}, {0x5e, 0x01, 0x31, 0x00},
+        {0x68, 0x01, 0x31, 0x00}, {0x03, 0x01, 0x31, 0x01}
+    },
+    /* 88 */
+    {
+        {0x56, 0x01, 0x32, 0x00}, {0x82, 0x01, 0x32, 0x00},
+        {0x44, 0x01, 0x32, 0x00}, {0x52, 0x01, 0x32, 0x00},
+        {0x63, 0x01, 0x32, 0x00}, {0x5e, 0x01, 0x32, 0x00},
+        {0x68, 0x01, 0x32, 0x00}, {0x03, 0x01, 0x32, 0x01},
+        {0x56, 0x01, 0x61, 0x00}, {0x82, 0x01, 0x61, 0x00},
+        {0x44, 0x01, 0x61, 0x00}, {0x52, 0x01, 0x61, 0x00},
+        {0x63, 0x01, 0x61, 0x00}, {0x5e, 0x01, 0x61, 0x00},
+        {0x68, 0x01, 0x61, 0x00}, {0x03, 0x01, 0x61, 0x01}
+    },
+    /* 89 */
+    {
+        {0x56, 0x01, 0x34, 0x00}, {0x82, 0x01, 0x34, 0x00},
+        {0x44, 0x01, 0x34, 0x00}, {0x52, 0x01, 0x34, 0x00},
+        {0x63, 0x01, 0x34, 0x00}, {0x5e, 0x01, 0x34, 0x00},
+        {0x68, 0x01, 0x34, 0x00}, {0x03, 0x01, 0x34, 0x01},
+        {0x56, 0x01, 0x35, 0x00}, {0x82, 0x01, 0x35, 0x00},
+        {0x44, 0x01, 0x35, 0x00}, {0x52, 0x01, 0x35, 0x00},
+        {0x63, 0x01, 0x35, 0x00}, {0x5e, 0x01, 0x35, 0x00},
+        {0x68, 0x01, 0x35, 0x00}, {0x03, 0x01, 0x35, 0x01}
+    },
+    /* 90 */
+    {
+        {0x55, 0x01, 0x36, 0x00}, {0x43, 0x01, 0x36, 0x00},
+        {0x5d, 0x01, 0x36, 0x00}, {0x02, 0x01, 0x36, 0x01},
+        {0x55, 0x01, 0x37, 0x00}, {0x43, 0x01, 0x37, 0x00},
+        {0x5d, 0x01, 0x37, 0x00}, {0x02, 0x01, 0x37, 0x01},
+        {0x55, 0x01, 0x38, 0x00}, {0x43, 0x01, 0x38, 0x00},
+        {0x5d, 0x01, 0x38, 0x00}, {0x02, 0x01, 0x38, 0x01},
+        {0x55, 0x01, 0x39, 0x00}, {0x43, 0x01, 0x39, 0x00},
+        {0x5d, 0x01, 0x39, 0x00}, {0x02, 0x01, 0x39, 0x01}
+    },
+    /* 91 */
+    {
+        {0x56, 0x01, 0x36, 0x00}, {0x82, 0x01, 0x36, 0x00},
+        {0x44, 0x01, 0x36, 0x00}, {0x52, 0x01, 0x36, 0x00},
+        {0x63, 0x01, 0x36, 0x00}, {0x5e, 0x01, 0x36, 0x00},
+        {0x68, 0x01, 0x36, 0x00}, {0x03, 0x01, 0x36, 0x01},
+        {0x56, 0x01, 0x37, 0x00}, {0x82, 0x01, 0x37, 0x00},
+        {0x44, 0x01, 0x37, 0x00}, {0x52, 0x01, 0x37, 0x00},
+        {0x63, 0x01, 0x37, 0x00}, {0x5e, 0x01, 0x37, 0x00},
+        {0x68, 0x01, 0x37, 0x00}, {0x03, 0x01, 0x37, 0x01}
+    },
+    /* 92 */
+    {
+        {0x56, 0x01, 0x38, 0x00}, {0x82, 0x01, 0x38, 0x00},
+        {0x44, 0x01, 0x38, 0x00}, {0x52, 0x01, 0x38, 0x00},
+        {0x63, 0x01, 0x38, 0x00}, {0x5e, 0x01, 0x38, 0x00},
+        {0x68, 0x01, 0x38, 0x00}, {0x03, 0x01, 0x38, 0x01},
+        {0x56, 0x01, 0x39, 0x00}, {0x82, 0x01, 0x39, 0x00},
+        {0x44, 0x01, 0x39, 0x00}, {0x52, 0x01, 0x39, 0x00},
+        {0x63, 0x01, 0x39, 0x00}, {0x5e, 0x01, 0x39, 0x00},
+        {0x68, 0x01, 0x39, 0x00}, {0x03, 0x01, 0x39, 0x01}
+    },
+    /* 93 */
+    {
+        {0x00, 0x01, 0x3d, 0x01}, {0x00, 0x01, 0x41, 0x01},
+        {0x00, 0x01, 0x5f, 0x01}, {0x00, 0x01, 0x62, 0x01},
+        {0x00, 0x01, 0x64, 0x01}, {0x00, 0x01, 0x66, 0x01},
+        {0x00, 0x01, 0x67, 0x01}, {0x00, 0x01, 0x68, 0x01},
+        {0x00, 0x01, 0x6c, 0x01}, {0x00, 0x01, 0x6d, 0x01},
+        {0x00, 0x01, 0x6e, 0x01}, {0x00, 0x01, 0x70, 0x01},
+        {0x00, 0x01, 0x72, 0x01}, {0x00, 0x01, 0x75, 0x01},
+        {0x61, 0x00, 0x00, 0x00}, {0x67, 0x00, 0x00, 0x00}
+    },
+    /* 94 */
+    {
+        {0x42, 0x01, 0x6c, 0x00}, {0x01, 0x01, 0x6c, 0x01},
+        {0x42, 0x01, 0x6d, 0x00}, {0x01, 0x01, 0x6d, 0x01},
+        {0x42, 0x01, 0x6e, 0x00}, {0x01, 0x01, 0x6e, 0x01},
+        {0x42, 0x01, 0x70, 0x00}, {0x01, 0x01, 0x70, 0x01},
+        {0x42, 0x01, 0x72, 0x00}, {0x01, 0x01, 0x72, 0x01},
+        {0x42, 0x01, 0x75, 0x00}, {0x01, 0x01, 0x75, 0x01},
+        {0x00, 0x01, 0x3a, 0x01}, {0x00, 0x01, 0x42, 0x01},
+        {0x00, 0x01, 0x43, 0x01}, {0x00, 0x01, 0x44, 0x01}
+    },
+    /* 95 */
+    {
+        {0x55, 0x01, 0x72, 0x00}, {0x43, 0x01, 0x72, 0x00},
+        {0x5d, 0x01, 0x72, 0x00}, {0x02, 0x01, 0x72, 0x01},
+        {0x55, 0x01, 0x75, 0x00}, {0x43, 0x01, 0x75, 0x00},
+        {0x5d, 0x01, 0x75, 0x00}, {0x02, 0x01, 0x75, 0x01},
+        {0x42, 0x01, 0x3a, 0x00}, {0x01, 0x01, 0x3a, 0x01},
+        {0x42, 0x01, 0x42, 0x00}, {0x01, 0x01, 0x42, 0x01},
+        {0x42, 0x01, 0x43, 0x00}, {0x01, 0x01, 0x43, 0x01},
+        {0x42, 0x01, 0x44, 0x00}, {0x01, 0x01, 0x44, 0x01}
+    },
+    /* 96 */
+    {
+        {0x55, 0x01, 0x3a, 0x00}, {0x43, 0x01, 0x3a, 0x00},
+        {0x5d, 0x01, 0x3a, 0x00}, {0x02, 0x01, 0x3a, 0x01},
+        {0x55, 0x01, 0x42, 0x00}, {0x43, 0x01, 0x42, 0x00},
+        {0x5d, 0x01, 0x42, 0x00}, {0x02, 0x01, 0x42, 0x01},
+        {0x55, 0x01, 0x43, 0x00}, {0x43, 0x01, 0x43, 0x00},
+        {0x5d, 0x01, 0x43, 0x00}, {0x02, 0x01, 0x43, 0x01},
+        {0x55, 0x01, 0x44, 0x00}, {0x43, 0x01, 0x44, 0x00},
+        {0x5d, 0x01, 0x44, 0x00}, {0x02, 0x01, 0x44, 0x01}
+    },
+    /* 97 */
+    {
+        {0x56, 0x01, 0x3a, 0x00}, {0x82, 0x01, 0x3a, 0x00},
+        {0x44, 0x01, 0x3a, 0x00}, {0x52, 0x01, 0x3a, 0x00},
+        {0x63, 0x01, 0x3a, 0x00}, {0x5e, 0x01, 0x3a, 0x00},
+        {0x68, 0x01, 0x3a, 0x00}, {0x03, 0x01, 0x3a, 0x01},
+        {0x56, 0x01, 0x42, 0x00}, {0x82, 0x01, 0x42, 0x00},
+        {0x44, 0x01, 0x42, 0x00}, {0x52, 0x01, 0x42, 0x00},
+        {0x63, 0x01, 0x42, 0x00}, {0x5e, 0x01, 0x42, 0x00},
+        {0x68, 0x01, 0x42, 0x00}, {0x03, 0x01, 0x42, 0x01}
+    },
+    /* 98 */
+    {
+        {0x56, 0x01, 0x3c, 0x00}, {0x82, 0x01, 0x3c, 0x00},
+        {0x44, 0x01, 0x3c, 0x00}, {0x52, 0x01, 0x3c, 0x00},
+        {0x63, 0x01, 0x3c, 0x00}, {0x5e, 0x01, 0x3c, 0x00},
+        {0x68, 0x01, 0x3c, 0x00}, {0x03, 0x01, 0x3c, 0x01},
+        {0x56, 0x01, 0x60, 0x00}, {0x82, 0x01, 0x60, 0x00},
+        {0x44, 0x01, 0x60, 0x00}, {0x52, 0x01, 0x60, 0x00},
+        {0x63, 0x01, 0x60, 0x00}, {0x5e, 0x01, 0x60, 0x00},
+        {0x68, 0x01, 0x60, 0x00}, {0x03, 0x01, 0x60, 0x01}
+    },
+    /* 99 */
+    {
+        {0x42, 0x01, 0x3d, 0x00}, {0x01, 0x01, 0x3d, 0x01},
+        {0x42, 0x01, 0x41, 0x00}, {0x01, 0x01, 0x41, 0x01},
+        {0x42, 0x01, 0x5f, 0x00}, {0x01, 0x01, 0x5f, 0x01},
+        {0x42, 0x01, 0x62, 0x00}, {0x01, 0x01, 0x62, 0x01},
+        {0x42, 0x01, 0x64, 0x00}, {0x01, 0x01, 0x64, 0x01},
+        {0x42, 0x01, 0x66, 0x00}, {0x01, 0x01, 0x66, 0x01},
+        {0x42, 0x01, 0x67, 0x00}, {0x01, 0x01, 0x67, 0x01},
+        {0x42, 0x01, 0x68, 0x00}, {0x01, 0x01, 0x68, 0x01}
+    },
+    /* 100 */
+    {
+        {0x55, 0x01, 0x3d, 0x00}, {0x43, 0x01, 0x3d, 0x00},
+        {0x5d, 0x01, 0x3d, 0x00}, {0x02, 0x01, 0x3d, 0x01},
+        {0x55, 0x01, 0x41, 0x00}, {0x43, 0x01, 0x41, 0x00},
+        {0x5d, 0x01, 0x41, 0x00}, {0x02, 0x01, 0x41, 0x01},
+        {0x55, 0x01, 0x5f, 0x00}, {0x43, 0x01, 0x5f, 0x00},
+        {0x5d, 0x01, 0x5f, 0x00}, {0x02, 0x01, 0x5f, 0x01},
+        {0x55, 0x01, 0x62, 0x00}, {0x43, 0x01, 0x62, 0x00},
+        {0x5d, 0x01, 0x62, 0x00}, {0x02, 0x01, 0x62, 0x01}
+    },
+    /* 101 */
+    {
+        {0x56, 0x01, 0x3d, 0x00}, {0x82, 0x01, 0x3d, 0x00},
+        {0x44, 0x01, 0x3d, 0x00}, {0x52, 0x01, 0x3d, 0x00},
+        {0x63, 0x01, 0x3d, 0x00}, {0x5e, 0x01, 0x3d, 0x00},
+        {0x68, 0x01, 0x3d, 0x00}, {0x03, 0x01, 0x3d, 0x01},
+        {0x56, 0x01, 0x41, 0x00}, {0x82, 0x01, 0x41, 0x00},
+        {0x44, 0x01, 0x41, 0x00}, {0x52, 0x01, 0x41, 0x00},
+        {0x63, 0x01, 0x41, 0x00}, {0x5e, 0x01, 0x41, 0x00},
+        {0x68, 0x01, 0x41, 0x00}, {0x03, 0x01, 0x41, 0x01}
+    },
+    /* 102 */
+    {
+        {0x56, 0x01, 0x40, 0x00}, {0x82, 0x01, 0x40, 0x00},
+        {0x44, 0x01, 0x40, 0x00}, {0x52, 0x01, 0x40, 0x00},
+        {0x63, 0x01, 0x40, 0x00}, {0x5e, 0x01, 0x40, 0x00},
+        {0x68, 0x01, 0x40, 0x00}, {0x03, 0x01, 0x40, 0x01},
+        {0x56, 0x01, 0x5b, 0x00}, {0x82, 0x01, 0x5b, 0x00},
+        {0x44, 0x01, 0x5b, 0x00}, {0x52, 0x01, 0x5b, 0x00},
+        {0x63, 0x01, 0x5b, 0x00}, {0x5e, 0x01, 0x5b, 0x00},
+        {0x68, 0x01, 0x5b, 0x00}, {0x03, 0x01, 0x5b, 0x01}
+    },
+    /* 103 */
+    {
+        {0x56, 0x01, 0x43, 0x00}, {0x82, 0x01, 0x43, 0x00},
+        {0x44, 0x01, 0x43, 0x00}, {0x52, 0x01, 0x43, 0x00},
+        {0x63, 0x01, 0x43, 0x00}, {0x5e, 0x01, 0x43, 0x00},
+        {0x68, 0x01, 0x43, 0x00}, {0x03, 0x01, 0x43, 0x01},
+        {0x56, 0x01, 0x44, 0x00}, {0x82, 0x01, 0x44, 0x00},
+        {0x44, 0x01, 0x44, 0x00}, {0x52, 0x01, 0x44, 0x00},
+        {0x63, 0x01, 0x44, 0x00}, {0x5e, 0x01, 0x44, 0x00},
+        {0x68, 0x01, 0x44, 0x00}, {0x03, 0x01, 0x44, 0x01}
+    },
+    /* 104 */
+    {
+        {0x00, 0x01, 0x45, 0x01}, {0x00, 0x01, 0x46, 0x01},
+        {0x00, 0x01, 0x47, 0x01}, {0x00, 0x01, 0x48, 0x01},
+        {0x00, 0x01, 0x49, 0x01}, {0x00, 0x01, 0x4a, 0x01},
+        {0x00, 0x01, 0x4b, 0x01}, {0x00, 0x01, 0x4c, 0x01},
+        {0x00, 0x01, 0x4d, 0x01}, {0x00, 0x01, 0x4e, 0x01},
+        {0x00, 0x01, 0x4f, 0x01}, {0x00, 0x01, 0x50, 0x01},
+        {0x00, 0x01, 0x51, 0x01}, {0x00, 0x01, 0x52, 0x01},
+        {0x00, 0x01, 0x53, 0x01}, {0x00, 0x01, 0x54, 0x01}
+    },
+    /* 105 */
+    {
+        {0x42, 0x01, 0x45, 0x00}, {0x01, 0x01, 0x45, 0x01},
+        {0x42, 0x01, 0x46, 0x00}, {0x01, 0x01, 0x46, 0x01},
+        {0x42, 0x01, 0x47, 0x00}, {0x01, 0x01, 0x47, 0x01},
+        {0x42, 0x01, 0x48, 0x00}, {0x01, 0x01, 0x48, 0x01},
+        {0x42, 0x01, 0x49, 0x00}, {0x01, 0x01, 0x49, 0x01},
+        {0x42, 0x01, 0x4a, 0x00}, {0x01, 0x01, 0x4a, 0x01},
+        {0x42, 0x01, 0x4b, 0x00}, {0x01, 0x01, 0x4b, 0x01},
+        {0x42, 0x01, 0x4c, 0x00}, {0x01, 0x01, 0x4c, 0x01}
+    },
+    /* 106 */
+    {
+        {0x55, 0x01, 0x45, 0x00}, {0x43, 0x01, 0x45, 0x00},
+        {0x5d, 0x01, 0x45, 0x00}, {0x02, 0x01, 0x45, 0x01},
+        {0x55, 0x01, 0x46, 0x00}, {0x43, 0x01, 0x46, 0x00},
+        {0x5d, 0x01, 0x46, 0x00}, {0x02, 0x01, 0x46, 0x01},
+        {0x55, 0x01, 0x47, 0x00}, {0x43, 0x01, 0x47, 0x00},
+        {0x5d, 0x01, 0x47, 0x00}, {0x02, 0x01, 0x47, 0x01},
+        {0x55, 0x01, 0x48, 0x00}, {0x43, 0x01, 0x48, 0x00},
+        {0x5d, 0x01, 0x48, 0x00}, {0x02, 0x01, 0x48, 0x01}
+    },
+    /* 107 */
+    {
+        {0x56, 0x01, 0x45, 0x00}, {0x82, 0x01, 0x45, 0x00},
+        {0x44, 0x01, 0x45, 0x00}, {0x52, 0x01, 0x45, 0x00},
+        {0x63, 0x01, 0x45, 0x00}, {0x5e, 0x01, 0x45, 0x00},
+        {0x68, 0x01, 0x45, 0x00}, {0x03, 0x01, 0x45, 0x01},
+        {0x56, 0x01, 0x46, 0x00}, {0x82, 0x01, 0x46, 0x00},
+        {0x44, 0x01, 0x46, 0x00}, {0x52, 0x01, 0x46, 0x00},
+        {0x63, 0x01, 0x46, 0x00}, {0x5e, 0x01, 0x46, 0x00},
+        {0x68, 0x01, 0x46, 0x00}, {0x03, 0x01, 0x46, 0x01}
+    },
+    /* 108 */
+    {
+        {0x56, 0x01, 0x47, 0x00}, {0x82, 0x01, 0x47, 0x00},
+        {0x44, 0x01, 0x47, 0x00}, {0x52, 0x01, 0x47, 0x00},
+        {0x63, 0x01, 0x47, 0x00}, {0x5e, 0x01, 0x47, 0x00},
+        {0x68, 0x01, 0x47, 0x00}, {0x03, 0x01, 0x47, 0x01},
+        {0x56, 0x01, 0x48, 0x00}, {0x82, 0x01, 0x48, 0x00},
+        {0x44, 0x01, 0x48, 0x00}, {0x52, 0x01, 0x48, 0x00},
+        {0x63, 0x01, 0x48, 0x00}, {0x5e, 0x01, 0x48, 0x00},
+        {0x68, 0x01, 0x48, 0x00}, {0x03, 0x01, 0x48, 0x01}
+    },
+    /* 109 */
+    {
+        {0x55, 0x01, 0x49, 0x00}, {0x43, 0x01, 0x49, 0x00},
+        {0x5d, 0x01, 0x49, 0x00}, {0x02, 0x01, 0x49, 0x01},
+        {0x55, 0x01, 0x4a, 0x00}, {0x43, 0x01, 0x4a, 0x00},
+        {0x5d, 0x01, 0x4a, 0x00}, {0x02, 0x01, 0x4a, 0x01},
+        {0x55, 0x01, 0x4b, 0x00}, {0x43, 0x01, 0x4b, 0x00},
+        {0x5d, 0x01, 0x4b, 0x00}, {0x02, 0x01, 0x4b, 0x01},
+        {0x55, 0x01, 0x4c, 0x00}, {0x43, 0x01, 0x4c, 0x00},
+        {0x5d, 0x01, 0x4c, 0x00}, {0x02, 0x01, 0x4c, 0x01}
+    },
+    /* 110 */
+    {
+        {0x56, 0x01, 0x49, 0x00}, {0x82, 0x01, 0x49, 0x00},
+        {0x44, 0x01, 0x49, 0x00}, {0x52, 0x01, 0x49, 0x00},
+        {0x63, 0x01, 0x49, 0x00}, {0x5e, 0x01, 0x49, 0x00},
+        {0x68, 0x01, 0x49, 0x00}, {0x03, 0x01, 0x49, 0x01},
+        {0x56, 0x01, 0x4a, 0x00}, {0x82, 0x01, 0x4a, 0x00},
+        {0x44, 0x01, 0x4a, 0x00}, {0x52, 0x01, 0x4a, 0x00},
+        {0x63, 0x01, 0x4a, 0x00}, {0x5e, 0x01, 0x4a, 0x00},
+        {0x68, 0x01, 0x4a, 0x00}, {0x03, 0x01, 0x4a, 0x01}
+    },
+    /* 111 */
+    {
+        {0x56, 0x01, 0x4b, 0x00}, {0x82, 0x01, 0x4b, 0x00},
+        {0x44, 0x01, 0x4b, 0x00}, {0x52, 0x01, 0x4b, 0x00},
+        {0x63, 0x01, 0x4b, 0x00}, {0x5e, 0x01, 0x4b, 0x00},
+        {0x68, 0x01, 0x4b, 0x00}, {0x03, 0x01, 0x4b, 0x01},
+        {0x56, 0x01, 0x4c, 0x00}, {0x82, 0x01, 0x4c, 0x00},
+        {0x44, 0x01, 0x4c, 0x00}, {0x52, 0x01, 0x4c, 0x00},
+        {0x63, 0x01, 0x4c, 0x00}, {0x5e, 0x01, 0x4c, 0x00},
+        {0x68, 0x01, 0x4c, 0x00}, {0x03, 0x01, 0x4c, 0x01}
+    },
+    /* 112 */
+    {
+        {0x42, 0x01, 0x4d, 0x00}, {0x01, 0x01, 0x4d, 0x01},
+        {0x42, 0x01, 0x4e, 0x00}, {0x01, 0x01, 0x4e, 0x01},
+        {0x42, 0x01, 0x4f, 0x00}, {0x01, 0x01, 0x4f, 0x01},
+        {0x42, 0x01, 0x50, 0x00}, {0x01, 0x01, 0x50, 0x01},
+        {0x42, 0x01, 0x51, 0x00}, {0x01, 0x01, 0x51, 0x01},
+        {0x42, 0x01, 0x52, 0x00}, {0x01, 0x01, 0x52, 0x01},
+        {0x42, 0x01, 0x53, 0x00}, {0x01, 0x01, 0x53, 0x01},
+        {0x42, 0x01, 0x54, 0x00}, {0x01, 0x01, 0x54, 0x01}
+    },
+    /* 113 */
+    {
+        {0x55, 0x01, 0x4d, 0x00}, {0x43, 0x01, 0x4d, 0x00},
+        {0x5d, 0x01, 0x4d, 0x00}, {0x02, 0x01, 0x4d, 0x01},
+        {0x55, 0x01, 0x4e, 0x00}, {0x43, 0x01, 0x4e, 0x00},
+        {0x5d, 0x01, 0x4e, 0x00}, {0x02, 0x01, 0x4e, 0x01},
+        {0x55, 0x01, 0x4f, 0x00}, {0x43, 0x01, 0x4f, 0x00},
+        {0x5d, 0x01, 0x4f, 0x00}, {0x02, 0x01, 0x4f, 0x01},
+        {0x55, 0x01, 0x50, 0x00}, {0x43, 0x01, 0x50, 0x00},
+        {0x5d, 0x01, 0x50, 0x00}, {0x02, 0x01, 0x50, 0x01}
+    },
+    /* 114 */
+    {
+        {0x56, 0x01, 0x4d, 0x00}, {0x82, 0x01, 0x4d, 0x00},
+        {0x44, 0x01, 0x4d, 0x00}, {0x52, 0x01, 0x4d, 0x00},
+        {0x63, 0x01, 0x4d, 0x00}, {0x5e, 0x01, 0x4d, 0x00},
+        {0x68, 0x01, 0x4d, 0x00}, {0x03, 0x01, 0x4d, 0x01},
+        {0x56, 0x01, 0x4e, 0x00}, {0x82, 0x01, 0x4e, 0x00},
+        {0x44, 0x01, 0x4e, 0x00}, {0x52, 0x01, 0x4e, 0x00},
+        {0x63, 0x01, 0x4e, 0x00}, {0x5e, 0x01, 0x4e, 0x00},
+        {0x68, 0x01, 0x4e, 0x00}, {0x03, 0x01, 0x4e, 0x01}
+    },
+    /* 115 */
+    {
+        {0x56, 0x01, 0x4f, 0x00}, {0x82, 0x01, 0x4f, 0x00},
+        {0x44, 0x01, 0x4f, 0x00}, {0x52, 0x01, 0x4f, 0x00},
+        {0x63, 0x01, 0x4f, 0x00}, {0x5e, 0x01, 0x4f, 0x00},
+        {0x68, 0x01, 0x4f, 0x00}, {0x03, 0x01, 0x4f, 0x01},
+        {0x56, 0x01, 0x50, 0x00}, {0x82, 0x01, 0x50, 0x00},
+        {0x44, 0x01, 0x50, 0x00}, {0x52, 0x01, 0x50, 0x00},
+        {0x63, 0x01, 0x50, 0x00}, {0x5e, 0x01, 0x50, 0x00},
+        {0x68, 0x01, 0x50, 0x00}, {0x03, 0x01, 0x50, 0x01}
+    },
+    /* 116 */
+    {
+        {0x55, 0x01, 0x51, 0x00}, {0x43, 0x01, 0x51, 0x00},
+        {0x5d, 0x01, 0x51, 0x00}, {0x02, 0x01, 0x51, 0x01},
+        {0x55, 0x01, 0x52, 0x00}, {0x43, 0x01, 0x52, 0x00},
+        {0x5d, 0x01, 0x52, 0x00}, {0x02, 0x01, 0x52, 0x01},
+        {0x55, 0x01, 0x53, 0x00}, {0x43, 0x01, 0x53, 0x00},
+        {0x5d, 0x01, 0x53, 0x00}, {0x02, 0x01, 0x53, 0x01},
+        {0x55, 0x01, 0x54, 0x00}, {0x43, 0x01, 0x54, 0x00},
+        {0x5d, 0x01, 0x54, 0x00}, {0x02, 0x01, 0x54, 0x01}
+    },
+    /* 117 */
+    {
+        {0x56, 0x01, 0x51, 0x00}, {0x82, 0x01, 0x51, 0x00},
+        {0x44, 0x01, 0x51, 0x00}, {0x52, 0x01, 0x51, 0x00},
+        {0x63, 0x01, 0x51, 0x00}, {0x5e, 0x01, 0x51, 0x00},
+        {0x68, 0x01, 0x51, 0x00}, {0x03, 0x01, 0x51, 0x01},
+        {0x56, 0x01, 0x52, 0x00}, {0x82, 0x01, 0x52, 0x00},
+        {0x44, 0x01, 0x52, 0x00}, {0x52, 0x01, 0x52, 0x00},
+        {0x63, 0x01, 0x52, 0x00}, {0x5e, 0x01, 0x52, 0x00},
+        {0x68, 0x01, 0x52, 0x00}, {0x03, 0x01, 0x52, 0x01}
+    },
+    /* 118 */
+    {
+        {0x56, 0x01, 0x53, 0x00}, {0x82, 0x01, 0x53, 0x00},
+        {0x44, 0x01, 0x53, 0x00}, {0x52, 0x01, 0x53, 0x00},
+        {0x63, 0x01, 0x53, 0x00}, {0x5e, 0x01, 0x53, 0x00},
+        {0x68, 0x01, 0x53, 0x00}, {0x03, 0x01, 0x53, 0x01},
+        {0x56, 0x01, 0x54, 0x00}, {0x82, 0x01, 0x54, 0x00},
+        {0x44, 0x01, 0x54, 0x00}, {0x52, 0x01, 0x54, 0x00},
+        {0x63, 0x01, 0x54, 0x00}, {0x5e, 0x01, 0x54, 0x00},
+        {0x68, 0x01, 0x54, 0x00}, {0x03, 0x01, 0x54, 0x01}
+    },
+    /* 119 */
+    {
+        {0x42, 0x01, 0x55, 0x00}, {0x01, 0x01, 0x55, 0x01},
+        {0x42, 0x01, 0x56, 0x00}, {0x01, 0x01, 0x56, 0x01},
+        {0x42, 0x01, 0x57, 0x00}, {0x01, 0x01, 0x57, 0x01},
+        {0x42, 0x01, 0x59, 0x00}, {0x01, 0x01, 0x59, 0x01},
+        {0x42, 0x01, 0x6a, 0x00}, {0x01, 0x01, 0x6a, 0x01},
+        {0x42, 0x01, 0x6b, 0x00}, {0x01, 0x01, 0x6b, 0x01},
+        {0x42, 0x01, 0x71, 0x00}, {0x01, 0x01, 0x71, 0x01},
+        {0x42, 0x01, 0x76, 0x00}, {0x01, 0x01, 0x76, 0x01}
+    },
+    /* 120 */
+    {
+        {0x55, 0x01, 0x55, 0x00}, {0x43, 0x01, 0x55, 0x00},
+        {0x5d, 0x01, 0x55, 0x00}, {0x02, 0x01, 0x55, 0x01},
+        {0x55, 0x01, 0x56, 0x00}, {0x43, 0x01, 0x56, 0x00},
+        {0x5d, 0x01, 0x56, 0x00}, {0x02, 0x01, 0x56, 0x01},
+        {0x55, 0x01, 0x57, 0x00}, {0x43, 0x01, 0x57, 0x00},
+        {0x5d, 0x01, 0x57, 0x00}, {0x02, 0x01, 0x57, 0x01},
+        {0x55, 0x01, 0x59, 0x00}, {0x43, 0x01, 0x59, 0x00},
+        {0x5d, 0x01, 0x59, 0x00}, {0x02, 0x01, 0x59, 0x01}
+    },
+    /* 121 */
+    {
+        {0x56, 0x01, 0x55, 0x00}, {0x82, 0x01, 0x55, 0x00},
+        {0x44, 0x01, 0x55, 0x00}, {0x52, 0x01, 0x55, 0x00},
+        {0x63, 0x01, 0x55, 0x00}, {0x5e, 0x01, 0x55, 0x00},
+        {0x68, 0x01, 0x55, 0x00}, {0x03, 0x01, 0x55, 0x01},
+        {0x56, 0x01, 0x56, 0x00}, {0x82, 0x01, 0x56, 0x00},
+        {0x44, 0x01, 0x56, 0x00}, {0x52, 0x01, 0x56, 0x00},
+        {0x63, 0x01, 0x56, 0x00}, {0x5e, 0x01, 0x56, 0x00},
+        {0x68, 0x01, 0x56, 0x00}, {0x03, 0x01, 0x56, 0x01}
+    },
+    /* 122 */
+    {
+        {0x56, 0x01, 0x57, 0x00}, {0x82, 0x01, 0x57, 0x00},
+        {0x44, 0x01, 0x57, 0x00}, {0x52, 0x01, 0x57, 0x00},
+        {0x63, 0x01, 0x57, 0x00}, {0x5e, 0x01, 0x57, 0x00},
+        {0x68, 0x01, 0x57, 0x00}, {0x03, 0x01, 0x57, 0x01},
+        {0x56, 0x01, 0x59, 0x00}, {0x82, 0x01, 0x59, 0x00},
+        {0x44, 0x01, 0x59, 0x00}, {0x52, 0x01, 0x59, 0x00},
+        {0x63, 0x01, 0x59, 0x00}, {0x5e, 0x01, 0x59, 0x00},
+        {0x68, 0x01, 0x59, 0x00}, {0x03, 0x01, 0x59, 0x01}
+    },
+    /* 123 */
+    {
+        {0x56, 0x01, 0x58, 0x00}, {0x82, 0x01, 0x58, 0x00},
+        {0x44, 0x01, 0x58, 0x00}, {0x52, 0x01, 0x58, 0x00},
+        {0x63, 0x01, 0x58, 0x00}, {0x5e, 0x01, 0x58, 0x00},
+        {0x68, 0x01, 0x58, 0x00}, {0x03, 0x01, 0x58, 0x01},
+        {0x56, 0x01, 0x5a, 0x00}, {0x82, 0x01, 0x5a, 0x00},
+        {0x44, 0x01, 0x5a, 0x00}, {0x52, 0x01, 0x5a, 0x00},
+        {0x63, 0x01, 0x5a, 0x00}, {0x5e, 0x01, 0x5a, 0x00},
+        {0x68, 0x01, 0x5a, 0x00}, {0x03, 0x01, 0x5a, 0x01}
+    },
+    /* 124 */
+    {
+        {0x42, 0x01, 0x5c, 0x00}, {0x01, 0x01, 0x5c, 0x01},
+        {0x42, 0x01, 0xc3, 0x00}, {0x01, 0x01, 0xc3, 0x01},
+        {0x42, 0x01, 0xd0, 0x00}, {0x01, 0x01, 0xd0, 0x01},
+        {0x00, 0x01, 0x80, 0x01}, {0x00, 0x01, 0x82, 0x01},
+        {0x00, 0x01, 0x83, 0x01}, {0x00, 0x01, 0xa2, 0x01},
+        {0x00, 0x01, 0xb8, 0x01}, {0x00, 0x01, 0xc2, 0x01},
+        {0x00, 0x01, 0xe0, 0x01}, {0x00, 0x01, 0xe2, 0x01},
+        {0xb1, 0x00, 0x00, 0x00}, {0xbc, 0x00, 0x00, 0x00}
+    },
+    /* 125 */
+    {
+        {0x55, 0x01, 0x5c, 0x00}, {0x43, 0x01, 0x5c, 0x00},
+        {0x5d, 0x01, 0x5c, 0x00}, {0x02, 0x01, 0x5c, 0x01},
+        {0x55, 0x01, 0xc3, 0x00}, {0x43, 0x01, 0xc3, 0x00},
+        {0x5d, 0x01, 0xc3, 0x00}, {0x02, 0x01, 0xc3, 0x01},
+        {0x55, 0x01, 0xd0, 0x00}, {0x43, 0x01, 0xd0, 0x00},
+        {0x5d, 0x01, 0xd0, 0x00}, {0x02, 0x01, 0xd0, 0x01},
+        {0x42, 0x01, 0x80, 0x00}, {0x01, 0x01, 0x80, 0x01},
+        {0x42, 0x01, 0x82, 0x00}, {0x01, 0x01, 0x82, 0x01}
+    },
+    /* 126 */
+    {
+        {0x56, 0x01, 0x5c, 0x00}, {0x82, 0x01, 0x5c, 0x00},
+        {0x44, 0x01, 0x5c, 0x00}, {0x52, 0x01, 0x5c, 0x00},
+        {0x63, 0x01, 0x5c, 0x00}, {0x5e, 0x01, 0x5c, 0x00},
+        {0x68, 0x01, 0x5c, 0x00}, {0x03, 0x01, 0x5c, 0x01},
+        {0x56, 0x01, 0xc3, 0x00}, {0x82, 0x01, 0xc3, 0x00},
+        {0x44, 0x01, 0xc3, 0x00}, {0x52, 0x01, 0xc3, 0x00},
+        {0x63, 0x01, 0xc3, 0x00}, {0x5e, 0x01, 0xc3, 0x00},
+        {0x68, 0x01, 0xc3, 0x00}, {0x03, 0x01, 0xc3, 0x01}
+    },
+    /* 127 */
+    {
+        {0x56, 0x01, 0x5d, 0x00}, {0x82, 0x01, 0x5d, 0x00},
+        {0x44, 0x01, 0x5d, 0x00}, {0x52, 0x01, 0x5d, 0x00},
+        {0x63, 0x01, 0x5d, 0x00}, {0x5e, 0x01, 0x5d, 0x00},
+        {0x68, 0x01, 0x5d, 0x00}, {0x03, 0x01, 0x5d, 0x01},
+        {0x56, 0x01, 0x7e, 0x00}, {0x82, 0x01, 0x7e, 0x00},
+        {0x44, 0x01, 0x7e, 0x00}, {0x52, 0x01, 0x7e, 0x00},
+        {0x63, 0x01, 0x7e, 0x00}, {0x5e, 0x01, 0x7e, 0x00},
+        {0x68, 0x01, 0x7e, 0x00}, {0x03, 0x01, 0x7e, 0x01}
+    },
+    /* 128 */
+    {
+        {0x56, 0x01, 0x5e, 0x00}, {0x82, 0x01, 0x5e, 0x00},
+        {0x44, 0x01, 0x5e, 0x00}, {0x52, 0x01, 0x5e, 0x00},
+        {0x63, 0x01, 0x5e, 0x00}, {0x5e, 0x01, 0x5e, 0x00},
+        {0x68, 0x01, 0x5e, 0x00}, {0x03, 0x01, 0x5e, 0x01},
+        {0x56, 0x01, 0x7d, 0x00}, {0x82, 0x01, 0x7d, 0x00},
+        {0x44, 0x01, 0x7d, 0x00}, {0x52, 0x01, 0x7d, 0x00},
+        {0x63, 0x01, 0x7d, 0x00}, {0x5e, 0x01, 0x7d, 0x00},
+        {0x68, 0x01, 0x7d, 0x00}, {0x03, 0x01, 0x7d, 0x01}
+    },
+    /* 129 */
+    {
+        {0x56, 0x01, 0x5f, 0x00}, {0x82, 0x01, 0x5f, 0x00},
+        {0x44, 0x01, 0x5f, 0x00}, {0x52, 0x01, 0x5f, 0x00},
+        {0x63, 0x01, 0x5f, 0x00}, {0x5e, 0x01, 0x5f, 0x00},
+        {0x68, 0x01, 0x5f, 0x00}, {0x03, 0x01, 0x5f, 0x01},
+        {0x56, 0x01, 0x62, 0x00}, {0x82, 0x01, 0x62, 0x00},
+        {0x44, 0x01, 0x62, 0x00}, {0x52, 0x01, 0x62, 0x00},
+        {0x63, 0x01, 0x62, 0x00}, {0x5e, 0x01, 0x62, 0x00},
+        {0x68, 0x01, 0x62, 0x00}, {0x03, 0x01, 0x62, 0x01}
+    },
+    /* 130 */
+    {
+        {0x55, 0x01, 0x63, 0x00}, {0x43, 0x01, 0x63, 0x00},
+        {0x5d, 0x01, 0x63, 0x00}, {0x02, 0x01, 0x63, 0x01},
+        {0x55, 0x01, 0x65, 0x00}, {0x43, 0x01, 0x65, 0x00},
+        {0x5d, 0x01, 0x65, 0x00}, {0x02, 0x01, 0x65, 0x01},
+        {0x55, 0x01, 0x69, 0x00}, {0x43, 0x01, 0x69, 0x00},
+        {0x5d, 0x01, 0x69, 0x00}, {0x02, 0x01, 0x69, 0x01},
+        {0x55, 0x01, 0x6f, 0x00}, {0x43, 0x01, 0x6f, 0x00},
+        {0x5d, 0x01, 0x6f, 0x00}, {0x02, 0x01, 0x6f, 0x01}
+    },
+    /* 131 */
+    {
+        {0x56, 0x01, 0x63, 0x00}, {0x82, 0x01, 0x63, 0x00},
+        {0x44, 0x01, 0x63, 0x00}, {0x52, 0x01, 0x63, 0x00},
+        {0x63, 0x01, 0x63, 0x00}, {0x5e, 0x01, 0x63, 0x00},
+        {0x68, 0x01, 0x63, 0x00}, {0x03, 0x01, 0x63, 0x01},
+        {0x56, 0x01, 0x65, 0x00}, {0x82, 0x01, 0x65, 0x00},
+        {0x44, 0x01, 0x65, 0x00}, {0x52, 0x01, 0x65, 0x00},
+        {0x63, 0x01, 0x65, 0x00}, {0x5e, 0x01, 0x65, 0x00},
+        {0x68, 0x01, 0x65, 0x00}, {0x03, 0x01, 0x65, 0x01}
+    },
+    /* 132 */
+    {
+        {0x55, 0x01, 0x64, 0x00}, {0x43, 0x01, 0x64, 0x00},
+        {0x5d, 0x01, 0x64, 0x00}, {0x02, 0x01, 0x64, 0x01},
+        {0x55, 0x01, 0x66, 0x00}, {0x43, 0x01, 0x66, 0x00},
+        {0x5d, 0x01, 0x66, 0x00}, {0x02, 0x01, 0x66, 0x01},
+        {0x55, 0x01, 0x67, 0x00}, {0x43, 0x01, 0x67, 0x00},
+        {0x5d, 0x01, 0x67, 0x00}, {0x02, 0x01, 0x67, 0x01},
+        {0x55, 0x01, 0x68, 0x00}, {0x43, 0x01, 0x68, 0x00},
+        {0x5d, 0x01, 0x68, 0x00}, {0x02, 0x01, 0x68, 0x01}
+    },
+    /* 133 */
+    {
+        {0x56, 0x01, 0x64, 0x00}, {0x82, 0x01, 0x64, 0x00},
+        {0x44, 0x01, 0x64, 0x00}, {0x52, 0x01, 0x64, 0x00},
+        {0x63, 0x01, 0x64, 0x00}, {0x5e, 0x01, 0x64, 0x00},
+        {0x68, 0x01, 0x64, 0x00}, {0x03, 0x01, 0x64, 0x01},
+        {0x56, 0x01, 0x66, 0x00}, {0x82, 0x01, 0x66, 0x00},
+        {0x44, 0x01, 0x66, 0x00}, {0x52, 0x01, 0x66, 0x00},
+        {0x63, 0x01, 0x66, 0x00}, {0x5e, 0x01, 0x66, 0x00},
+        {0x68, 0x01, 0x66, 0x00}, {0x03, 0x01, 0x66, 0x01}
+    },
+    /* 134 */
+    {
+        {0x56, 0x01, 0x67, 0x00}, {0x82, 0x01, 0x67, 0x00},
+        {0x44, 0x01, 0x67, 0x00}, {0x52, 0x01, 0x67, 0x00},
+        {0x63, 0x01, 0x67, 0x00}, {0x5e, 0x01, 0x67, 0x00},
+        {0x68, 0x01, 0x67, 0x00}, {0x03, 0x01, 0x67, 0x01},
+        {0x56, 0x01, 0x68, 0x00}, {0x82, 0x01, 0x68, 0x00},
+        {0x44, 0x01, 0x68, 0x00}, {0x52, 0x01, 0x68, 0x00},
+        {0x63, 0x01, 0x68, 0x00}, {0x5e, 0x01, 0x68, 0x00},
+        {0x68, 0x01, 0x68, 0x00}, {0x03, 0x01, 0x68, 0x01}
+    },
+    /* 135 */
+    {
+        {0x56, 0x01, 0x69, 0x00}, {0x82, 0x01, 0x69, 0x00},
+        {0x44, 0x01, 0x69, 0x00}, {0x52, 0x01, 0x69, 0x00},
+        {0x63, 0x01, 0x69, 0x00}, {0x5e, 0x01, 0x69, 0x00},
+        {0x68, 0x01, 0x69, 0x00}, {0x03, 0x01, 0x69, 0x01},
+        {0x56, 0x01, 0x6f, 0x00}, {0x82, 0x01, 0x6f, 0x00},
+        {0x44, 0x01, 0x6f, 0x00}, {0x52, 0x01, 0x6f, 0x00},
+        {0x63, 0x01, 0x6f, 0x00}, {0x5e, 0x01, 0x6f, 0x00},
+        {0x68, 0x01, 0x6f, 0x00}, {0x03, 0x01, 0x6f, 0x01}
+    },
+    /* 136 */
+    {
+        {0x55, 0x01, 0x6a, 0x00}, {0x43, 0x01, 0x6a, 0x00},
+        {0x5d, 0x01, 0x6a, 0x00}, {0x02, 0x01, 0x6a, 0x01},
+        {0x55, 0x01, 0x6b, 0x00}, {0x43, 0x01, 0x6b, 0x00},
+        {0x5d, 0x01, 0x6b, 0x00}, {0x02, 0x01, 0x6b, 0x01},
+        {0x55, 0x01, 0x71, 0x00}, {0x43, 0x01, 0x71, 0x00},
+        {0x5d, 0x01, 0x71, 0x00}, {0x02, 0x01, 0x71, 0x01},
+        {0x55, 0x01, 0x76, 0x00}, {0x43, 0x01, 0x76, 0x00},
+        {0x5d, 0x01, 0x76, 0x00}, {0x02, 0x01, 0x76, 0x01}
+    },
+    /* 137 */
+    {
+        {0x56, 0x01, 0x6a, 0x00}, {0x82, 0x01, 0x6a, 0x00},
+        {0x44, 0x01, 0x6a, 0x00}, {0x52, 0x01, 0x6a, 0x00},
+        {0x63, 0x01, 0x6a, 0x00}, {0x5e, 0x01, 0x6a, 0x00},
+        {0x68, 0x01, 0x6a, 0x00}, {0x03, 0x01, 0x6a, 0x01},
+        {0x56, 0x01, 0x6b, 0x00}, {0x82, 0x01, 0x6b, 0x00},
+        {0x44, 0x01, 0x6b, 0x00}, {0x52, 0x01, 0x6b, 0x00},
+        {0x63, 0x01, 0x6b, 0x00}, {0x5e, 0x01, 0x6b, 0x00},
+        {0x68, 0x01, 0x6b, 0x00}, {0x03, 0x01, 0x6b, 0x01}
+    },
+    /* 138 */
+    {
+        {0x55, 0x01, 0x6c, 0x00}, {0x43, 0x01, 0x6c, 0x00},
+        {0x5d, 0x01, 0x6c, 0x00}, {0x02, 0x01, 0x6c, 0x01},
+        {0x55, 0x01, 0x6d, 0x00}, {0x43, 0x01, 0x6d, 0x00},
+        {0x5d, 0x01, 0x6d, 0x00}, {0x02, 0x01, 0x6d, 0x01},
+        {0x55, 0x01, 0x6e, 0x00}, {0x43, 0x01, 0x6e, 0x00},
+        {0x5d, 0x01, 0x6e, 0x00}, {0x02, 0x01, 0x6e, 0x01},
+        {0x55, 0x01, 0x70, 0x00}, {0x43, 0x01, 0x70, 0x00},
+        {0x5d, 0x01, 0x70, 0x00}, {0x02, 0x01, 0x70, 0x01}
+    },
+    /* 139 */
+    {
+        {0x56, 0x01, 0x6c, 0x00}, {0x82, 0x01, 0x6c, 0x00},
+        {0x44, 0x01, 0x6c, 0x00}, {0x52, 0x01, 0x6c, 0x00},
+        {0x63, 0x01, 0x6c, 0x00}, {0x5e, 0x01, 0x6c, 0x00},
+        {0x68, 0x01, 0x6c, 0x00}, {0x03, 0x01, 0x6c, 0x01},
+        {0x56, 0x01, 0x6d, 0x00}, {0x82, 0x01, 0x6d, 0x00},
+        {0x44, 0x01, 0x6d, 0x00}, {0x52, 0x01, 0x6d, 0x00},
+        {0x63, 0x01, 0x6d, 0x00}, {0x5e, 0x01, 0x6d, 0x00},
+        {0x68, 0x01, 0x6d, 0x00}, {0x03, 0x01, 0x6d, 0x01}
+    },
+    /* 140 */
+    {
+        {0x56, 0x01, 0x6e, 0x00}, {0x82, 0x01, 0x6e, 0x00},
+        {0x44, 0x01, 0x6e, 0x00}, {0x52, 0x01, 0x6e, 0x00},
+        {0x63, 0x01, 0x6e, 0x00}, {0x5e, 0x01, 0x6e, 0x00},
+        {0x68, 0x01, 0x6e, 0x00}, {0x03, 0x01, 0x6e, 0x01},
+        {0x56, 0x01, 0x70, 0x00}, {0x82, 0x01, 0x70, 0x00},
+        {0x44, 0x01, 0x70, 0x00}, {0x52, 0x01, 0x70, 0x00},
+        {0x63, 0x01, 0x70, 0x00}, {0x5e, 0x01, 0x70, 0x00},
+        {0x68, 0x01, 0x70, 0x00}, {0x03, 0x01, 0x70, 0x01}
+    },
+    /* 141 */
+    {
+        {0x56, 0x01, 0x71, 0x00}, {0x82, 0x01, 0x71, 0x00},
+        {0x44, 0x01, 0x71, 0x00}, {0x52, 0x01, 0x71, 0x00},
+        {0x63, 0x01, 0x71, 0x00}, {0x5e, 0x01, 0x71, 0x00},
+        {0x68, 0x01, 0x71, 0x00}, {0x03, 0x01, 0x71, 0x01},
+        {0x56, 0x01, 0x76, 0x00}, {0x82, 0x01, 0x76, 0x00},
+        {0x44, 0x01, 0x76, 0x00}, {0x52, 0x01, 0x76, 0x00},
+        {0x63, 0x01, 0x76, 0x00}, {0x5e, 0x01, 0x76, 0x00},
+        {0x68, 0x01, 0x76, 0x00}, {0x03, 0x01, 0x76, 0x01}
+    },
+    /* 142 */
+    {
+        {0x56, 0x01, 0x72, 0x00}, {0x82, 0x01, 0x72, 0x00},
+        {0x44, 0x01, 0x72, 0x00}, {0x52, 0x01, 0x72, 0x00},
+        {0x63, 0x01, 0x72, 0x00}, {0x5e, 0x01, 0x72, 0x00},
+        {0x68, 0x01, 0x72, 0x00}, {0x03, 0x01, 0x72, 0x01},
+        {0x56, 0x01, 0x75, 0x00}, {0x82, 0x01, 0x75, 0x00},
+        {0x44, 0x01, 0x75, 0x00}, {0x52, 0x01, 0x75, 0x00},
+        {0x63, 0x01, 0x75, 0x00}, {0x5e, 0x01, 0x75, 0x00},
+        {0x68, 0x01, 0x75, 0x00}, {0x03, 0x01, 0x75, 0x01}
+    },
+    /* 143 */
+    {
+        {0x56, 0x01, 0x73, 0x00}, {0x82, 0x01, 0x73, 0x00},
+        {0x44, 0x01, 0x73, 0x00}, {0x52, 0x01, 0x73, 0x00},
+        {0x63, 0x01, 0x73, 0x00}, {0x5e, 0x01, 0x73, 0x00},
+        {0x68, 0x01, 0x73, 0x00}, {0x03, 0x01, 0x73, 0x01},
+        {0x56, 0x01, 0x74, 0x00}, {0x82, 0x01, 0x74, 0x00},
+        {0x44, 0x01, 0x74, 0x00}, {0x52, 0x01, 0x74, 0x00},
+        {0x63, 0x01, 0x74, 0x00}, {0x5e, 0x01, 0x74, 0x00},
+        {0x68, 0x01, 0x74, 0x00}, {0x03, 0x01, 0x74, 0x01}
+    },
+    /* 144 */
+    {
+        {0x55, 0x01, 0x77, 0x00}, {0x43, 0x01, 0x77, 0x00},
+        {0x5d, 0x01, 0x77, 0x00}, {0x02, 0x01, 0x77, 0x01},
+        {0x55, 0x01, 0x78, 0x00}, {0x43, 0x01, 0x78, 0x00},
+        {0x5d, 0x01, 0x78, 0x00}, {0x02, 0x01, 0x78, 0x01},
+        {0x55, 0x01, 0x79, 0x00}, {0x43, 0x01, 0x79, 0x00},
+        {0x5d, 0x01, 0x79, 0x00}, {0x02, 0x01, 0x79, 0x01},
+        {0x55, 0x01, 0x7a, 0x00}, {0x43, 0x01, 0x7a, 0x00},
+        {0x5d, 0x01, 0x7a, 0x00}, {0x02, 0x01, 0x7a, 0x01}
+    },
+    /* 145 */
+    {
+        {0x56, 0x01, 0x77, 0x00}, {0x82, 0x01, 0x77, 0x00},
+        {0x44, 0x01, 0x77, 0x00}, {0x52, 0x01, 0x77, 0x00},
+        {0x63, 0x01, 0x77, 0x00}, {0x5e, 0x01, 0x77, 0x00},
+        {0x68, 0x01, 0x77, 0x00}, {0x03, 0x01, 0x77, 0x01},
+        {0x56, 0x01, 0x78, 0x00}, {0x82, 0x01, 0x78, 0x00},
+        {0x44, 0x01, 0x78, 0x00}, {0x52, 0x01, 0x78, 0x00},
+        {0x63, 0x01, 0x78, 0x00}, {0x5e, 0x01, 0x78, 0x00},
+        {0x68, 0x01, 0x78, 0x00}, {0x03, 0x01, 0x78, 0x01}
+    },
+    /* 146 */
+    {
+        {0x56, 0x01, 0x79, 0x00}, {0x82, 0x01, 0x79, 0x00},
+        {0x44, 0x01, 0x79, 0x00}, {0x52, 0x01, 0x79, 0x00},
+        {0x63, 0x01, 0x79, 0x00}, {0x5e, 0x01, 0x79, 0x00},
+        {0x68, 0x01, 0x79, 0x00}, {0x03, 0x01, 0x79, 0x01},
+        {0x56, 0x01, 0x7a, 0x00}, {0x82, 0x01, 0x7a, 0x00},
+        {0x44, 0x01, 0x7a, 0x00}, {0x52, 0x01, 0x7a, 0x00},
+        {0x63, 0x01, 0x7a, 0x00}, {0x5e, 0x01, 0x7a, 0x00},
+        {0x68, 0x01, 0x7a, 0x00}, {0x03, 0x01, 0x7a, 0x01}
+    },
+    /* 147 */
+    {
+        {0x56, 0x01, 0x7f, 0x00}, {0x82, 0x01, 0x7f, 0x00},
+        {0x44, 0x01, 0x7f, 0x00}, {0x52, 0x01, 0x7f, 0x00},
+        {0x63, 0x01, 0x7f, 0x00}, {0x5e, 0x01, 0x7f, 0x00},
+        {0x68, 0x01, 0x7f, 0x00}, {0x03, 0x01, 0x7f, 0x01},
+        {0x56, 0x01, 0xdc, 0x00}, {0x82, 0x01, 0xdc, 0x00},
+        {0x44, 0x01, 0xdc, 0x00}, {0x52, 0x01, 0xdc, 0x00},
+        {0x63, 0x01, 0xdc, 0x00}, {0x5e, 0x01, 0xdc, 0x00},
+        {0x68, 0x01, 0xdc, 0x00}, {0x03, 0x01, 0xdc, 0x01}
+    },
+    /* 148 */
+    {
+        {0x56, 0x01, 0xd0, 0x00}, {0x82, 0x01, 0xd0, 0x00},
+        {0x44, 0x01, 0xd0, 0x00}, {0x52, 0x01, 0xd0, 0x00},
+        {0x63, 0x01, 0xd0, 0x00}, {0x5e, 0x01, 0xd0, 0x00},
+        {0x68, 0x01, 0xd0, 0x00}, {0x03, 0x01, 0xd0, 0x01},
+        {0x55, 0x01, 0x80, 0x00}, {0x43, 0x01, 0x80, 0x00},
+        {0x5d, 0x01, 0x80, 0x00}, {0x02, 0x01, 0x80, 0x01},
+        {0x55, 0x01, 0x82, 0x00}, {0x43, 0x01, 0x82, 0x00},
+        {0x5d, 0x01, 0x82, 0x00}, {0x02, 0x01, 0x82, 0x01}
+    },
+    /* 149 */
+    {
+        {0x56, 0x01, 0x80, 0x00}, {0x82, 0x01, 0x80, 0x00},
+        {0x44, 0x01, 0x80, 0x00}, {0x52, 0x01, 0x80, 0x00},
+        {0x63, 0x01, 0x80, 0x00}, {0x5e, 0x01, 0x80, 0x00},
+        {0x68, 0x01, 0x80, 0x00}, {0x03, 0x01, 0x80, 0x01},
+        {0x56, 0x01, 0x82, 0x00}, {0x82, 0x01, 0x82, 0x00},
+        {0x44, 0x01, 0x82, 0x00}, {0x52, 0x01, 0x82, 0x00},
+        {0x63, 0x01, 0x82, 0x00}, {0x5e, 0x01, 0x82, 0x00},
+        {0x68, 0x01, 0x82, 0x00}, {0x03, 0x01, 0x82, 0x01}
+    },
+    /* 150 */
+    {
+        {0x00, 0x01, 0xb0, 0x01}, {0x00, 0x01, 0xb1, 0x01},
+        {0x00, 0x01, 0xb3, 0x01}, {0x00, 0x01, 0xd1, 0x01},
+        {0x00, 0x01, 0xd8, 0x01}, {0x00, 0x01, 0xd9, 0x01},
+        {0x00, 0x01, 0xe3, 0x01}, {0x00, 0x01, 0xe5, 0x01},
+        {0x00, 0x01, 0xe6, 0x01}, {0x9a, 0x00, 0x00, 0x00},
+        {0x9f, 0x00, 0x00, 0x00}, {0xa0, 0x00, 0x00, 0x00},
+        {0xb4, 0x00, 0x00, 0x00}, {0xb6, 0x00, 0x00, 0x00},
+        {0xb8, 0x00, 0x00, 0x00}, {0xbe, 0x00, 0x00, 0x00}
+    },
+    /* 151 */
+    {
+        {0x42, 0x01, 0xe6, 0x00}, {0x01, 0x01, 0xe6, 0x01},
+        {0x00, 0x01, 0x81, 0x01}, {0x00, 0x01, 0x84, 0x01},
+        {0x00, 0x01, 0x85, 0x01}, {0x00, 0x01, 0x86, 0x01},
+        {0x00, 0x01, 0x88, 0x01}, {0x00, 0x01, 0x92, 0x01},
+        {0x00, 0x01, 0x9a, 0x01}, {0x00, 0x01, 0x9c, 0x01},
+        {0x00, 0x01, 0xa0, 0x01}, {0x00, 0x01, 0xa3, 0x01},
+        {0x00, 0x01, 0xa4, 0x01}, {0x00, 0x01, 0xa9, 0x01},
+        {0x00, 0x01, 0xaa, 0x01}, {0x00, 0x01, 0xad, 0x01}
+    },
+    /* 152 */
+    {
+        {0x55, 0x01, 0xe6, 0x00}, {0x43, 0x01, 0xe6, 0x00},
+        {0x5d, 0x01, 0xe6, 0x00}, {0x02, 0x01, 0xe6, 0x01},
+        {0x42, 0x01, 0x81, 0x00}, {0x01, 0x01, 0x81, 0x01},
+        {0x42, 0x01, 0x84, 0x00}, {0x01, 0x01, 0x84, 0x01},
+        {0x42, 0x01, 0x85, 0x00}, {0x01, 0x01, 0x85, 0x01},
+        {0x42, 0x01, 0x86, 0x00}, {0x01, 0x01, 0x86, 0x01},
+        {0x42, 0x01, 0x88, 0x00}, {0x01, 0x01, 0x88, 0x01},
+        {0x42, 0x01, 0x92, 0x00}, {0x01, 0x01, 0x92, 0x01}
+    },
+    /* 153 */
+    {
+        {0x56, 0x01, 0xe6, 0x00}, {0x82, 0x01, 0xe6, 0x00},
+        {0x44, 0x01, 0xe6, 0x00}, {0x52, 0x01, 0xe6, 0x00},
+        {0x63, 0x01, 0xe6, 0x00}, {0x5e, 0x01, 0xe6, 0x00},
+        {0x68, 0x01, 0xe6, 0x00}, {0x03, 0x01, 0xe6, 0x01},
+        {0x55, 0x01, 0x81, 0x00}, {0x43, 0x01, 0x81, 0x00},
+        {0x5d, 0x01, 0x81, 0x00}, {0x02, 0x01, 0x81, 0x01},
+        {0x55, 0x01, 0x84, 0x00}, {0x43, 0x01, 0x84, 0x00},
+        {0x5d, 0x01, 0x84, 0x00}, {0x02, 0x01, 0x84, 0x01}
+    },
+    /* 154 */
+    {
+        {0x56, 0x01, 0x81, 0x00}, {0x82, 0x01, 0x81, 0x00},
+        {0x44, 0x01, 0x81, 0x00}, {0x52, 0x01, 0x81, 0x00},
+        {0x63, 0x01, 0x81, 0x00}, {0x5e, 0x01, 0x81, 0x00},
+        {0x68, 0x01, 0x81, 0x00}, {0x03, 0x01, 0x81, 0x01},
+        {0x56, 0x01, 0x84, 0x00}, {0x82, 0x01, 0x84, 0x00},
+        {0x44, 0x01, 0x84, 0x00}, {0x52, 0x01, 0x84, 0x00},
+        {0x63, 0x01, 0x84, 0x00}, {0x5e, 0x01, 0x84, 0x00},
+        {0x68, 0x01, 0x84, 0x00}, {0x03, 0x01, 0x84, 0x01}
+    },
+    /* 155 */
+    {
+        {0x42, 0x01, 0x83, 0x00}, {0x01, 0x01, 0x83, 0x01},
+        {0x42, 0x01, 0xa2, 0x00}, {0x01, 0x01, 0xa2, 0x01},
+        {0x42, 0x01, 0xb8, 0x00}, {0x01, 0x01, 0xb8, 0x01},
+        {0x42, 0x01, 0xc2, 0x00}, {0x01, 0x01, 0xc2, 0x01},
+        {0x42, 0x01, 0xe0, 0x00}, {0x01, 0x01, 0xe0, 0x01},
+        {0x42, 0x01, 0xe2, 0x00}, {0x01, 0x01, 0xe2, 0x01},
+        {0x00, 0x01, 0x99, 0x01}, {0x00, 0x01, 0xa1, 0x01},
+        {0x00, 0x01, 0xa7, 0x01}, {0x00, 0x01, 0xac, 0x01}
+    },
+    /* 156 */
+    {
+        {0x55, 0x01, 0x83, 0x00}, {0x43, 0x01, 0x83, 0x00},
+        {0x5d, 0x01, 0x83, 0x00}, {0x02, 0x01, 0x83, 0x01},
+        {0x55, 0x01, 0xa2, 0x00}, {0x43, 0x01, 0xa2, 0x00},
+        {0x5d, 0x01, 0xa2, 0x00}, {0x02, 0x01, 0xa2, 0x01},
+        {0x55, 0x01, 0xb8, 0x00}, {0x43, 0x01, 0xb8, 0x00},
+        {0x5d, 0x01, 0xb8, 0x00}, {0x02, 0x01, 0xb8, 0x01},
+        {0x55, 0x01, 0xc2, 0x00}, {0x43, 0x01, 0xc2, 0x00},
+        {0x5d, 0x01, 0xc2, 0x00}, {0x02, 0x01, 0xc2, 0x01}
+    },
+    /* 157 */
+    {
+        {0x56, 0x01, 0x83, 0x00}, {0x82, 0x01, 0x83, 0x00},
+        {0x44, 0x01, 0x83, 0x00}, {0x52, 0x01, 0x83, 0x00},
+        {0x63, 0x01, 0x83, 0x00}, {0x5e, 0x01, 0x83, 0x00},
+        {0x68, 0x01, 0x83, 0x00}, {0x03, 0x01, 0x83, 0x01},
+        {0x56, 0x01, 0xa2, 0x00}, {0x82, 0x01, 0xa2, 0x00},
+        {0x44, 0x01, 0xa2, 0x00}, {0x52, 0x01, 0xa2, 0x00},
+        {0x63, 0x01, 0xa2, 0x00}, {0x5e, 0x01, 0xa2, 0x00},
+        {0x68, 0x01, 0xa2, 0x00}, {0x03, 0x01, 0xa2, 0x01}
+    },
+    /* 158 */
+    {
+        {0x55, 0x01, 0x85, 0x00}, {0x43, 0x01, 0x85, 0x00},
+        {0x5d, 0x01, 0x85, 0x00}, {0x02, 0x01, 0x85, 0x01},
+        {0x55, 0x01, 0x86, 0x00}, {0x43, 0x01, 0x86, 0x00},
+        {0x5d, 0x01, 0x86, 0x00}, {0x02, 0x01, 0x86, 0x01},
+        {0x55, 0x01, 0x88, 0x00}, {0x43, 0x01, 0x88, 0x00},
+        {0x5d, 0x01, 0x88, 0x00}, {0x02, 0x01, 0x88, 0x01},
+        {0x55, 0x01, 0x92, 0x00}, {0x43, 0x01, 0x92, 0x00},
+        {0x5d, 0x01, 0x92, 0x00}, {0x02, 0x01, 0x92, 0x01}
+    },
+    /* 159 */
+    {
+        {0x56, 0x01, 0x85, 0x00}, {0x82, 0x01, 0x85, 0x00},
+        {0x44, 0x01, 0x85, 0x00}, {0x52, 0x01, 0x85, 0x00},
+        {0x63, 0x01, 0x85, 0x00}, {0x5e, 0x01, 0x85, 0x00},
+        {0x68, 0x01, 0x85, 0x00}, {0x03, 0x01, 0x85, 0x01},
+        {0x56, 0x01, 0x86, 0x00}, {0x82, 0x01, 0x86, 0x00},
+        {0x44, 0x01, 0x86, 0x00}, {0x52, 0x01, 0x86, 0x00},
+        {0x63, 0x01, 0x86, 0x00}, {0x5e, 0x01, 0x86, 0x00},
+        {0x68, 0x01, 0x86, 0x00}, {0x03, 0x01, 0x86, 0x01}
+    },
+    /* 160 */
+    {
+        {0x56, 0x01, 0x88, 0x00}, {0x82, 0x01, 0x88, 0x00},
+        {0x44, 0x01, 0x88, 0x00}, {0x52, 0x01, 0x88, 0x00},
+        {0x63, 0x01, 0x88, 0x00}, {0x5e, 0x01, 0x88, 0x00},
+        {0x68, 0x01, 0x88, 0x00}, {0x03, 0x01, 0x88, 0x01},
+        {0x56, 0x01, 0x92, 0x00}, {0x82, 0x01, 0x92, 0x00},
+        {0x44, 0x01, 0x92, 0x00}, {0x52, 0x01, 0x92, 0x00},
+        {0x63, 0x01, 0x92, 0x00}, {0x5e, 0x01, 0x92, 0x00},
+        {0x68, 0x01, 0x92, 0x00}, {0x03, 0x01, 0x92, 0x01}
+    },
+    /* 161 */
+    {
+        {0x56, 0x01, 0x89, 0x00}, {0x82, 0x01, 0x89, 0x00},
+        {0x44, 0x01, 0x89, 0x00}, {0x52, 0x01, 0x89, 0x00},
+        {0x63, 0x01, 0x89, 0x00}, {0x5e, 0x01, 0x89, 0x00},
+        {0x68, 0x01, 0x89, 0x00}, {0x03, 0x01, 0x89, 0x01},
+        {0x56, 0x01, 0x8a, 0x00}, {0x82, 0x01, 0x8a, 0x00},
+        {0x44, 0x01, 0x8a, 0x00}, {0x52, 0x01, 0x8a, 0x00},
+        {0x63, 0x01, 0x8a, 0x00}, {0x5e, 0x01, 0x8a, 0x00},
+        {0x68, 0x01, 0x8a, 0x00}, {0x03, 0x01, 0x8a, 0x01}
+    },
+    /* 162 */
+    {
+        {0x55, 0x01, 0x8b, 0x00}, {0x43, 0x01, 0x8b, 0x00},
+        {0x5d, 0x01, 0x8b, 0x00}, {0x02, 0x01, 0x8b, 0x01},
+        {0x55, 0x01, 0x8c, 0x00}, {0x43, 0x01, 0x8c, 0x00},
+        {0x5d, 0x01, 0x8c, 0x00}, {0x02, 0x01, 0x8c, 0x01},
+        {0x55, 0x01, 0x8d, 0x00}, {0x43, 0x01, 0x8d, 0x00},
+        {0x5d, 0x01, 0x8d, 0x00}, {0x02, 0x01, 0x8d, 0x01},
+        {0x55, 0x01, 0x8f, 0x00}, {0x43, 0x01, 0x8f, 0x00},
+        {0x5d, 0x01, 0x8f, 0x00}, {0x02, 0x01, 0x8f, 0x01}
+    },
+    /* 163 */
+    {
+        {0x56, 0x01, 0x8b, 0x00}, {0x82, 0x01, 0x8b, 0x00},
+        {0x44, 0x01, 0x8b, 0x00}, {0x52, 0x01, 0x8b, 0x00},
+        {0x63, 0x01, 0x8b, 0x00}, {0x5e, 0x01, 0x8b, 0x00},
+        {0x68, 0x01, 0x8b, 0x00}, {0x03, 0x01, 0x8b, 0x01},
+        {0x56, 0x01, 0x8c, 0x00}, {0x82, 0x01, 0x8c, 0x00},
+        {0x44, 0x01, 0x8c, 0x00}, {0x52, 0x01, 0x8c, 0x00},
+        {0x63, 0x01, 0x8c, 0x00}, {0x5e, 0x01, 0x8c, 0x00},
+        {0x68, 0x01, 0x8c, 0x00}, {0x03, 0x01, 0x8c, 0x01}
+    },
+    /* 164 */
+    {
+        {0x56, 0x01, 0x8d, 0x00}, {0x82, 0x01, 0x8d, 0x00},
+        {0x44, 0x01, 0x8d, 0x00}, {0x52, 0x01, 0x8d, 0x00},
+        {0x63, 0x01, 0x8d, 0x00}, {0x5e, 0x01, 0x8d, 0x00},
+        {0x68, 0x01, 0x8d, 0x00}, {0x03, 0x01, 0x8d, 0x01},
+        {0x56, 0x01, 0x8f, 0x00}, {0x82, 0x01, 0x8f, 0x00},
+        {0x44, 0x01, 0x8f, 0x00}, {0x52, 0x01, 0x8f, 0x00},
+        {0x63, 0x01, 0x8f, 0x00}, {0x5e, 0x01, 0x8f, 0x00},
+        {0x68, 0x01, 0x8f, 0x00}, {0x03, 0x01, 0x8f, 0x01}
+    },
+    /* 165 */
+    {
+        {0x55, 0x01, 0x90, 0x00}, {0x43, 0x01, 0x90, 0x00},
+        {0x5d, 0x01, 0x90, 0x00}, {0x02, 0x01, 0x90, 0x01},
+        {0x55, 0x01, 0x91, 0x00}, {0x43, 0x01, 0x91, 0x00},
+        {0x5d, 0x01, 0x91, 0x00}, {0x02, 0x01, 0x91, 0x01},
+        {0x55, 0x01, 0x94, 0x00}, {0x43, 0x01, 0x94, 0x00},
+        {0x5d, 0x01, 0x94, 0x00}, {0x02, 0x01, 0x94, 0x01},
+        {0x55, 0x01, 0x9f, 0x00}, {0x43, 0x01, 0x9f, 0x00},
+        {0x5d, 0x01, 0x9f, 0x00}, {0x02, 0x01, 0x9f, 0x01}
+    },
+    /* 166 */
+    {
+        {0x56, 0x01, 0x90, 0x00}, {0x82, 0x01, 0x90, 0x00},
+        {0x44, 0x01, 0x90, 0x00}, {0x52, 0x01, 0x90, 0x00},
+        {0x63, 0x01, 0x90, 0x00}, {0x5e, 0x01, 0x90, 0x00},
+        {0x68, 0x01, 0x90, 0x00}, {0x03, 0x01, 0x90, 0x01},
+        {0x56, 0x01, 0x91, 0x00}, {0x82, 0x01, 0x91, 0x00},
+        {0x44, 0x01, 0x91, 0x00}, {0x52, 0x01, 0x91, 0x00},
+        {0x63, 0x01, 0x91, 0x00}, {0x5e, 0x01, 0x91, 0x00},
+        {0x68, 0x01, 0x91, 0x00}, {0x03, 0x01, 0x91, 0x01}
+    },
+    /* 167 */
+    {
+        {0x00, 0x01, 0x93, 0x01}, {0x00, 0x01, 0x95, 0x01},
+        {0x00, 0x01, 0x96, 0x01}, {0x00, 0x01, 0x97, 0x01},
+        {0x00, 0x01, 0x98, 0x01}, {0x00, 0x01, 0x9b, 0x01},
+        {0x00, 0x01, 0x9d, 0x01}, {0x00, 0x01, 0x9e, 0x01},
+        {0x00, 0x01, 0xa5, 0x01}, {0x00, 0x01, 0xa6, 0x01},
+        {0x00, 0x01, 0xa8, 0x01}, {0x00, 0x01, 0xae, 0x01},
+        {0x00, 0x01, 0xaf, 0x01}, {0x00, 0x01, 0xb4, 0x01},
+        {0x00, 0x01, 0xb6, 0x01}, {0x00, 0x01, 0xb7, 0x01}
+    },
+    /* 168 */
+    {
+        {0x42, 0x01, 0x93, 0x00}, {0x01, 0x01, 0x93, 0x01},
+        {0x42, 0x01, 0x95, 0x00}, {0x01, 0x01, 0x95, 0x01},
+        {0x42, 0x01, 0x96, 0x00}, {0x01, 0x01, 0x96, 0x01},
+        {0x42, 0x01, 0x97, 0x00}, {0x01, 0x01, 0x97, 0x01},
+        {0x42, 0x01, 0x98, 0x00}, {0x01, 0x01, 0x98, 0x01},
+        {0x42, 0x01, 0x9b, 0x00}, {0x01, 0x01, 0x9b, 0x01},
+        {0x42, 0x01, 0x9d, 0x00}, {0x01, 0x01, 0x9d, 0x01},
+        {0x42, 0x01, 0x9e, 0x00}, {0x01, 0x01, 0x9e, 0x01}
+    },
+    /* 169 */
+    {
+        {0x55, 0x01, 0x93, 0x00}, {0x43, 0x01, 0x93, 0x00},
+        {0x5d, 0x01, 0x93, 0x00}, {0x02, 0x01, 0x93, 0x01},
+        {0x55, 0x01, 0x95, 0x00}, {0x43, 0x01, 0x95, 0x00},
+        {0x5d, 0x01, 0x95, 0x00}, {0x02, 0x01, 0x95, 0x01},
+        {0x55, 0x01, 0x96, 0x00}, {0x43, 0x01, 0x96, 0x00},
+        {0x5d, 0x01, 0x96, 0x00}, {0x02, 0x01, 0x96, 0x01},
+        {0x55, 0x01, 0x97, 0x00}, {0x43, 0x01, 0x97, 0x00},
+        {0x5d, 0x01, 0x97, 0x00}, {0x02, 0x01, 0x97, 0x01}
+    },
+    /* 170 */
+    {
+        {0x56, 0x01, 0x93, 0x00}, {0x82, 0x01, 0x93, 0x00},
+        {0x44, 0x01, 0x93, 0x00}, {0x52, 0x01, 0x93, 0x00},
+        {0x63, 0x01, 0x93, 0x00}, {0x5e, 0x01, 0x93, 0x00},
+        {0x68, 0x01, 0x93, 0x00}, {0x03, 0x01, 0x93, 0x01},
+        {0x56, 0x01, 0x95, 0x00}, {0x82, 0x01, 0x95, 0x00},
+        {0x44, 0x01, 0x95, 0x00}, {0x52, 0x01, 0x95, 0x00},
+        {0x63, 0x01, 0x95, 0x00}, {0x5e, 0x01, 0x95, 0x00},
+        {0x68, 0x01, 0x95, 0x00}, {0x03, 0x01, 0x95, 0x01}
+    },
+    /* 171 */
+    {
+        {0x56, 0x01, 0x94, 0x00}, {0x82, 0x01, 0x94, 0x00},
+        {0x44, 0x01, 0x94, 0x00}, {0x52, 0x01, 0x94, 0x00},
+        {0x63, 0x01, 0x94, 0x00}, {0x5e, 0x01, 0x94, 0x00},
+        {0x68, 0x01, 0x94, 0x00}, {0x03, 0x01, 0x94, 0x01},
+        {0x56, 0x01, 0x9f, 0x00}, {0x82, 0x01, 0x9f, 0x00},
+        {0x44, 0x01, 0x9f, 0x00}, {0x52, 0x01, 0x9f, 0x00},
+        {0x63, 0x01, 0x9f, 0x00}, {0x5e, 0x01, 0x9f, 0x00},
+        {0x68, 0x01, 0x9f, 0x00}, {0x03, 0x01, 0x9f, 0x01}
+    },
+    /* 172 */
+    {
+        {0x56, 0x01, 0x96, 0x00}, {0x82, 0x01, 0x96, 0x00},
+        {0x44, 0x01, 0x96, 0x00}, {0x52, 0x01, 0x96, 0x00},
+        {0x63, 0x01, 0x96, 0x00}, {0x5e, 0x01, 0x96, 0x00},
+        {0x68, 0x01, 0x96, 0x00}, {0x03, 0x01, 0x96, 0x01},
+        {0x56, 0x01, 0x97, 0x00}, {0x82, 0x01, 0x97, 0x00},
+        {0x44, 0x01, 0x97, 0x00}, {0x52, 0x01, 0x97, 0x00},
+        {0x63, 0x01, 0x97, 0x00}, {0x5e, 0x01, 0x97, 0x00},
+        {0x68, 0x01, 0x97, 0x00}, {0x03, 0x01, 0x97, 0x01}
+    },
+    /* 173 */
+    {
+        {0x55, 0x01, 0x98, 0x00}, {0x43, 0x01, 0x98, 0x00},
+        {0x5d, 0x01, 0x98, 0x00}, {0x02, 0x01, 0x98, 0x01},
+        {0x55, 0x01, 0x9b, 0x00}, {0x43, 0x01, 0x9b, 0x00},
+        {0x5d, 0x01, 0x9b, 0x00}, {0x02, 0x01, 0x9b, 0x01},
+        {0x55, 0x01, 0x9d, 0x00}, {0x43, 0x01, 0x9d, 0x00},
+        {0x5d, 0x01, 0x9d, 0x00}, {0x02, 0x01, 0x9d, 0x01},
+        {0x55, 0x01, 0x9e, 0x00}, {0x43, 0x01, 0x9e, 0x00},
+        {0x5d, 0x01, 0x9e, 0x00}, {0x02, 0x01, 0x9e, 0x01}
+    },
+    /* 174 */
+    {
+        {0x56, 0x01, 0x98, 0x00}, {0x82, 0x01, 0x98, 0x00},
+        {0x44, 0x01, 0x98, 0x00}, {0x52, 0x01, 0x98, 0x00},
+        {0x63, 0x01, 0x98, 0x00}, {0x5e, 0x01, 0x98, 0x00},
+        {0x68, 0x01, 0x98, 0x00}, {0x03, 0x01, 0x98, 0x01},
+        {0x56, 0x01, 0x9b, 0x00}, {0x82, 0x01, 0x9b, 0x00},
+        {0x44, 0x01, 0x9b, 0x00}, {0x52, 0x01, 0x9b, 0x00},
+        {0x63, 0x01, 0x9b, 0x00}, {0x5e, 0x01, 0x9b, 0x00},
+        {0x68, 0x01, 0x9b, 0x00}, {0x03, 0x01, 0x9b, 0x01}
+    },
+    /* 175 */
+    {
+        {0x55, 0x01, 0xe0, 0x00}, {0x43, 0x01, 0xe0, 0x00},
+        {0x5d, 0x01, 0xe0, 0x00}, {0x02, 0x01, 0xe0, 0x01},
+        {0x55, 0x01, 0xe2, 0x00}, {0x43, 0x01, 0xe2, 0x00},
+        {0x5d, 0x01, 0xe2, 0x00}, {0x02, 0x01, 0xe2, 0x01},
+        {0x42, 0x01, 0x99, 0x00}, {0x01, 0x01, 0x99, 0x01},
+        {0x42, 0x01, 0xa1, 0x00}, {0x01, 0x01, 0xa1, 0x01},
+        {0x42, 0x01, 0xa7, 0x00}, {0x01, 0x01, 0xa7, 0x01},
+        {0x42, 0x01, 0xac, 0x00}, {0x01, 0x01, 0xac, 0x01}
+    },
+    /* 176 */
+    {
+        {0x55, 0x01, 0x99, 0x00}, {0x43, 0x01, 0x99, 0x00},
+        {0x5d, 0x01, 0x99, 0x00}, {0x02, 0x01, 0x99, 0x01},
+        {0x55, 0x01, 0xa1, 0x00}, {0x43, 0x01, 0xa1, 0x00},
+        {0x5d, 0x01, 0xa1, 0x00}, {0x02, 0x01, 0xa1, 0x01},
+        {0x55, 0x01, 0xa7, 0x00}, {0x43, 0x01, 0xa7, 0x00},
+        {0x5d, 0x01, 0xa7, 0x00}, {0x02, 0x01, 0xa7, 0x01},
+        {0x55, 0x01, 0xac, 0x00}, {0x43, 0x01, 0xac, 0x00},
+        {0x5d, 0x01, 0xac, 0x00}, {0x02, 0x01, 0xac, 0x01}
+    },
+    /* 177 */
+    {
+        {0x56, 0x01, 0x99, 0x00}, {0x82, 0x01, 0x99, 0x00},
+        {0x44, 0x01, 0x99, 0x00}, {0x52, 0x01, 0x99, 0x00},
+        {0x63, 0x01, 0x99, 0x00}, {0x5e, 0x01, 0x99, 0x00},
+        {0x68, 0x01, 0x99, 0x00}, {0x03, 0x01, 0x99, 0x01},
+        {0x56, 0x01, 0xa1, 0x00}, {0x82, 0x01, 0xa1, 0x00},
+        {0x44, 0x01, 0xa1, 0x00}, {0x52, 0x01, 0xa1, 0x00},
+        {0x63, 0x01, 0xa1, 0x00}, {0x5e, 0x01, 0xa1, 0x00},
+        {0x68, 0x01, 0xa1, 0x00}, {0x03, 0x01, 0xa1, 0x01}
+    },
+    /* 178 */
+    {
+        {0x42, 0x01, 0x9a, 0x00}, {0x01, 0x01, 0x9a, 0x01},
+        {0x42, 0x01, 0x9c, 0x00}, {0x01, 0x01, 0x9c, 0x01},
+        {0x42, 0x01, 0xa0, 0x00}, {0x01, 0x01, 0xa0, 0x01},
+        {0x42, 0x01, 0xa3, 0x00}, {0x01, 0x01, 0xa3, 0x01},
+        {0x42, 0x01, 0xa4, 0x00}, {0x01, 0x01, 0xa4, 0x01},
+        {0x42, 0x01, 0xa9, 0x00}, {0x01, 0x01, 0xa9, 0x01},
+        {0x42, 0x01, 0xaa, 0x00}, {0x01, 0x01, 0xaa, 0x01},
+        {0x42, 0x01, 0xad, 0x00}, {0x01, 0x01, 0xad, 0x01}
+    },
+    /* 179 */
+    {
+        {0x55, 0x01, 0x9a, 0x00}, {0x43, 0x01, 0x9a, 0x00},
+        {0x5d, 0x01, 0x9a, 0x00}, {0x02, 0x01, 0x9a, 0x01},
+        {0x55, 0x01, 0x9c, 0x00}, {0x43, 0x01, 0x9c, 0x00},
+        {0x5d, 0x01, 0x9c, 0x00}, {0x02, 0x01, 0x9c, 0x01},
+        {0x55, 0x01, 0xa0, 0x00}, {0x43, 0x01, 0xa0, 0x00},
+        {0x5d, 0x01, 0xa0, 0x00}, {0x02, 0x01, 0xa0, 0x01},
+        {0x55, 0x01, 0xa3, 0x00}, {0x43, 0x01, 0xa3, 0x00},
+        {0x5d, 0x01, 0xa3, 0x00}, {0x02, 0x01, 0xa3, 0x01}
+    },
+    /* 180 */
+    {
+        {0x56, 0x01, 0x9a, 0x00}, {0x82, 0x01, 0x9a, 0x00},
+        {0x44, 0x01, 0x9a, 0x00}, {0x52, 0x01, 0x9a, 0x00},
+        {0x63, 0x01, 0x9a, 0x00}, {0x5e, 0x01, 0x9a, 0x00},
+        {0x68, 0x01, 0x9a, 0x00}, {0x03, 0x01, 0x9a, 0x01},
+        {0x56, 0x01, 0x9c, 0x00}, {0x82, 0x01, 0x9c, 0x00},
+        {0x44, 0x01, 0x9c, 0x00}, {0x52, 0x01, 0x9c, 0x00},
+        {0x63, 0x01, 0x9c, 0x00}, {0x5e, 0x01, 0x9c, 0x00},
+        {0x68, 0x01, 0x9c, 0x00}, {0x03, 0x01, 0x9c, 0x01}
+    },
+    /* 181 */
+    {
+        {0x56, 0x01, 0x9d, 0x00}, {0x82, 0x01, 0x9d, 0x00},
+        {0x44, 0x01, 0x9d, 0x00}, {0x52, 0x01, 0x9d, 0x00},
+        {0x63, 0x01, 0x9d, 0x00}, {0x5e, 0x01, 0x9d, 0x00},
+        {0x68, 0x01, 0x9d, 0x00}, {0x03, 0x01, 0x9d, 0x01},
+        {0x56, 0x01, 0x9e, 0x00}, {0x82, 0x01, 0x9e, 0x00},
+        {0x44, 0x01, 0x9e, 0x00}, {0x52, 0x01, 0x9e, 0x00},
+        {0x63, 0x01, 0x9e, 0x00}, {0x5e, 0x01, 0x9e, 0x00},
+        {0x68, 0x01, 0x9e, 0x00}, {0x03, 0x01, 0x9e, 0x01}
+    },
+    /* 182 */
+    {
+        {0x56, 0x01, 0xa0, 0x00}, {0x82, 0x01, 0xa0, 0x00},
+        {0x44, 0x01, 0xa0, 0x00}, {0x52, 0x01, 0xa0, 0x00},
+        {0x63, 0x01, 0xa0, 0x00}, {0x5e, 0x01, 0xa0, 0x00},
+        {0x68, 0x01, 0xa0, 0x00}, {0x03, 0x01, 0xa0, 0x01},
+        {0x56, 0x01, 0xa3, 0x00}, {0x82, 0x01, 0xa3, 0x00},
+        {0x44, 0x01, 0xa3, 0x00}, {0x52, 0x01, 0xa3, 0x00},
+        {0x63, 0x01, 0xa3, 0x00}, {0x5e, 0x01, 0xa3, 0x00},
+        {0x68, 0x01, 0xa3, 0x00}, {0x03, 0x01, 0xa3, 0x01}
+    },
+    /* 183 */
+    {
+        {0x55, 0x01, 0xa4, 0x00}, {0x43, 0x01, 0xa4, 0x00},
+        {0x5d, 0x01, 0xa4, 0x00}, {0x02, 0x01, 0xa4, 0x01},
+        {0x55, 0x01, 0xa9, 0x00}, {0x43, 0x01, 0xa9, 0x00},
+        {0x5d, 0x01, 0xa9, 0x00}, {0x02, 0x01, 0xa9, 0x01},
+        {0x55, 0x01, 0xaa, 0x00}, {0x43, 0x01, 0xaa, 0x00},
+        {0x5d, 0x01, 0xaa, 0x00}, {0x02, 0x01, 0xaa, 0x01},
+        {0x55, 0x01, 0xad, 0x00}, {0x43, 0x01, 0xad, 0x00},
+        {0x5d, 0x01, 0xad, 0x00}, {0x02, 0x01, 0xad, 0x01}
+    },
+    /* 184 */
+    {
+        {0x56, 0x01, 0xa4, 0x00}, {0x82, 0x01, 0xa4, 0x00},
+        {0x44, 0x01, 0xa4, 0x00}, {0x52, 0x01, 0xa4, 0x00},
+        {0x63, 0x01, 0xa4, 0x00}, {0x5e, 0x01, 0xa4, 0x00},
+        {0x68, 0x01, 0xa4, 0x00}, {0x03, 0x01, 0xa4, 0x01},
+        {0x56, 0x01, 0xa9, 0x00}, {0x82, 0x01, 0xa9, 0x00},
+        {0x44, 0x01, 0xa9, 0x00}, {0x52, 0x01, 0xa9, 0x00},
+        {0x63, 0x01, 0xa9, 0x00}, {0x5e, 0x01, 0xa9, 0x00},
+        {0x68, 0x01, 0xa9, 0x00}, {0x03, 0x01, 0xa9, 0x01}
+    },
+    /* 185 */
+    {
+        {0x42, 0x01, 0xa5, 0x00}, {0x01, 0x01, 0xa5, 0x01},
+        {0x42, 0x01, 0xa6, 0x00}, {0x01, 0x01, 0xa6, 0x01},
+        {0x42, 0x01, 0xa8, 0x00}, {0x01, 0x01, 0xa8, 0x01},
+        {0x42, 0x01, 0xae, 0x00}, {0x01, 0x01, 0xae, 0x01},
+        {0x42, 0x01, 0xaf, 0x00}, {0x01, 0x01, 0xaf, 0x01},
+        {0x42, 0x01, 0xb4, 0x00}, {0x01, 0x01, 0xb4, 0x01},
+        {0x42, 0x01, 0xb6, 0x00}, {0x01, 0x01, 0xb6, 0x01},
+        {0x42, 0x01, 0xb7, 0x00}, {0x01, 0x01, 0xb7, 0x01}
+    },
+    /* 186 */
+    {
+        {0x55, 0x01, 0xa5, 0x00}, {0x43, 0x01, 0xa5, 0x00},
+        {0x5d, 0x01, 0xa5, 0x00}, {0x02, 0x01, 0xa5, 0x01},
+        {0x55, 0x01, 0xa6, 0x00}, {0x43, 0x01, 0xa6, 0x00},
+        {0x5d, 0x01, 0xa6, 0x00}, {0x02, 0x01, 0xa6, 0x01},
+        {0x55, 0x01, 0xa8, 0x00}, {0x43, 0x01, 0xa8, 0x00},
+        {0x5d, 0x01, 0xa8, 0x00}, {0x02, 0x01, 0xa8, 0x01},
+        {0x55, 0x01, 0xae, 0x00}, {0x43, 0x01, 0xae, 0x00},
+        {0x5d, 0x01, 0xae, 0x00}, {0x02, 0x01, 0xae, 0x01}
+    },
+    /* 187 */
+    {
+        {0x56, 0x01, 0xa5, 0x00}, {0x82, 0x01, 0xa5, 0x00},
+        {0x44, 0x01, 0xa5, 0x00}, {0x52, 0x01, 0xa5, 0x00},
+        {0x63, 0x01, 0xa5, 0x00}, {0x5e, 0x01, 0xa5, 0x00},
+        {0x68, 0x01, 0xa5, 0x00}, {0x03, 0x01, 0xa5, 0x01},
+        {0x56, 0x01, 0xa6, 0x00}, {0x82, 0x01, 0xa6, 0x00},
+        {0x44, 0x01, 0xa6, 0x00}, {0x52, 0x01, 0xa6, 0x00},
+        {0x63, 0x01, 0xa6, 0x00}, {0x5e, 0x01, 0xa6, 0x00},
+        {0x68, 0x01, 0xa6, 0x00}, {0x03, 0x01, 0xa6, 0x01}
+    },
+    /* 188 */
+    {
+        {0x56, 0x01, 0xa7, 0x00}, {0x82, 0x01, 0xa7, 0x00},
+        {0x44, 0x01, 0xa7, 0x00}, {0x52, 0x01, 0xa7, 0x00},
+        {0x63, 0x01, 0xa7, 0x00}, {0x5e, 0x01, 0xa7, 0x00},
+        {0x68, 0x01, 0xa7, 0x00}, {0x03, 0x01, 0xa7, 0x01},
+        {0x56, 0x01, 0xac, 0x00}, {0x82, 0x01, 0xac, 0x00},
+        {0x44, 0x01, 0xac, 0x00}, {0x52, 0x01, 0xac, 0x00},
+        {0x63, 0x01, 0xac, 0x00}, {0x5e, 0x01, 0xac, 0x00},
+        {0x68, 0x01, 0xac, 0x00}, {0x03, 0x01, 0xac, 0x01}
+    },
+    /* 189 */
+    {
+        {0x56, 0x01, 0xa8, 0x00}, {0x82, 0x01, 0xa8, 0x00},
+        {0x44, 0x01, 0xa8, 0x00}, {0x52, 0x01, 0xa8, 0x00},
+        {0x63, 0x01, 0xa8, 0x00}, {0x5e, 0x01, 0xa8, 0x00},
+        {0x68, 0x01, 0xa8, 0x00}, {0x03, 0x01, 0xa8, 0x01},
+        {0x56, 0x01, 0xae, 0x00}, {0x82, 0x01, 0xae, 0x00},
+        {0x44, 0x01, 0xae, 0x00}, {0x52, 0x01, 0xae, 0x00},
+        {0x63, 0x01, 0xae, 0x00}, {0x5e, 0x01, 0xae, 0x00},
+        {0x68, 0x01, 0xae, 0x00}, {0x03, 0x01, 0xae, 0x01}
+    },
+    /* 190 */
+    {
+        {0x56, 0x01, 0xaa, 0x00}, {0x82, 0x01, 0xaa, 0x00},
+        {0x44, 0x01, 0xaa, 0x00}, {0x52, 0x01, 0xaa, 0x00},
+        {0x63, 0x01, 0xaa, 0x00}, {0x5e, 0x01, 0xaa, 0x00},
+        {0x68, 0x01, 0xaa, 0x00}, {0x03, 0x01, 0xaa, 0x01},
+        {0x56, 0x01, 0xad, 0x00}, {0x82, 0x01, 0xad, 0x00},
+        {0x44, 0x01, 0xad, 0x00}, {0x52, 0x01, 0xad, 0x00},
+        {0x63, 0x01, 0xad, 0x00}, {0x5e, 0x01, 0xad, 0x00},
+        {0x68, 0x01, 0xad, 0x00}, {0x03, 0x01, 0xad, 0x01}
+    },
+    /* 191 */
+    {
+        {0x42, 0x01, 0xab, 0x00}, {0x01, 0x01, 0xab, 0x01},
+        {0x42, 0x01, 0xce, 0x00}, {0x01, 0x01, 0xce, 0x01},
+        {0x42, 0x01, 0xd7, 0x00}, {0x01, 0x01, 0xd7, 0x01},
+        {0x42, 0x01, 0xe1, 0x00}, {0x01, 0x01, 0xe1, 0x01},
+        {0x42, 0x01, 0xec, 0x00}, {0x01, 0x01, 0xec, 0x01},
+        {0x42, 0x01, 0xed, 0x00}, {0x01, 0x01, 0xed, 0x01},
+        {0x00, 0x01, 0xc7, 0x01}, {0x00, 0x01, 0xcf, 0x01},
+        {0x00, 0x01, 0xea, 0x01}, {0x00, 0x01, 0xeb, 0x01}
+    },
+    /* 192 */
+    {
+        {0x55, 0x01, 0xab, 0x00}, {0x43, 0x01, 0xab, 0x00},
+        {0x5d, 0x01, 0xab, 0x00}, {0x02, 0x01, 0xab, 0x01},
+        {0x55, 0x01, 0xce, 0x00}, {0x43, 0x01, 0xce, 0x00},
+        {0x5d, 0x01, 0xce, 0x00}, {0x02, 0x01, 0xce, 0x01},
+        {0x55, 0x01, 0xd7, 0x00}, {0x43, 0x01, 0xd7, 0x00},
+        {0x5d, 0x01, 0xd7, 0x00}, {0x02, 0x01, 0xd7, 0x01},
+        {0x55, 0x01, 0xe1, 0x00}, {0x43, 0x01, 0xe1, 0x00},
+        {0x5d, 0x01, 0xe1, 0x00}, {0x02, 0x01, 0xe1, 0x01}
+    },
+    /* 193 */
+    {
+        {0x56, 0x01, 0xab, 0x00}, {0x82, 0x01, 0xab, 0x00},
+        {0x44, 0x01, 0xab, 0x00}, {0x52, 0x01, 0xab, 0x00},
+        {0x63, 0x01, 0xab, 0x00}, {0x5e, 0x01, 0xab, 0x00},
+        {0x68, 0x01, 0xab, 0x00}, {0x03, 0x01, 0xab, 0x01},
+        {0x56, 0x01, 0xce, 0x00}, {0x82, 0x01, 0xce, 0x00},
+        {0x44, 0x01, 0xce, 0x00}, {0x52, 0x01, 0xce, 0x00},
+        {0x63, 0x01, 0xce, 0x00}, {0x5e, 0x01, 0xce, 0x00},
+        {0x68, 0x01, 0xce, 0x00}, {0x03, 0x01, 0xce, 0x01}
+    },
+    /* 194 */
+    {
+        {0x55, 0x01, 0xaf, 0x00}, {0x43, 0x01, 0xaf, 0x00},
+        {0x5d, 0x01, 0xaf, 0x00}, {0x02, 0x01, 0xaf, 0x01},
+        {0x55, 0x01, 0xb4, 0x00}, {0x43, 0x01, 0xb4, 0x00},
+        {0x5d, 0x01, 0xb4, 0x00}, {0x02, 0x01, 0xb4, 0x01},
+        {0x55, 0x01, 0xb6, 0x00}, {0x43, 0x01, 0xb6, 0x00},
+        {0x5d, 0x01, 0xb6, 0x00}, {0x02, 0x01, 0xb6, 0x01},
+        {0x55, 0x01, 0xb7, 0x00}, {0x43, 0x01, 0xb7, 0x00},
+        {0x5d, 0x01, 0xb7, 0x00}, {0x02, 0x01, 0xb7, 0x01}
+    },
+    /* 195 */
+    {
+        {0x56, 0x01, 0xaf, 0x00}, {0x82, 0x01, 0xaf, 0x00},
+        {0x44, 0x01, 0xaf, 0x00}, {0x52, 0x01, 0xaf, 0x00},
+        {0x63, 0x01, 0xaf, 0x00}, {0x5e, 0x01, 0xaf, 0x00},
+        {0x68, 0x01, 0xaf, 0x00}, {0x03, 0x01, 0xaf, 0x01},
+        {0x56, 0x01, 0xb4, 0x00}, {0x82, 0x01, 0xb4, 0x00},
+        {0x44, 0x01, 0xb4, 0x00}, {0x52, 0x01, 0xb4, 0x00},
+        {0x63, 0x01, 0xb4, 0x00}, {0x5e, 0x01, 0xb4, 0x00},
+        {0x68, 0x01, 0xb4, 0x00}, {0x03, 0x01, 0xb4, 0x01}
+    },
+    /* 196 */
+    {
+        {0x42, 0x01, 0xb0, 0x00}, {0x01, 0x01, 0xb0, 0x01},
+        {0x42, 0x01, 0xb1, 0x00}, {0x01, 0x01, 0xb1, 0x01},
+        {0x42, 0x01, 0xb3, 0x00}, {0x01, 0x01, 0xb3, 0x01},
+        {0x42, 0x01, 0xd1, 0x00}, {0x01, 0x01, 0xd1, 0x01},
+        {0x42, 0x01, 0xd8, 0x00}, {0x01, 0x01, 0xd8, 0x01},
+        {0x42, 0x01, 0xd9, 0x00}, {0x01, 0x01, 0xd9, 0x01},
+        {0x42, 0x01, 0xe3, 0x00}, {0x01, 0x01, 0xe3, 0x01},
+        {0x42, 0x01, 0xe5, 0x00}, {0x01, 0x01, 0xe5, 0x01}
+    },
+    /* 197 */
+    {
+        {0x55, 0x01, 0xb0, 0x00}, {0x43, 0x01, 0xb0, 0x00},
+        {0x5d, 0x01, 0xb0, 0x00}, {0x02, 0x01, 0xb0, 0x01},
+        {0x55, 0x01, 0xb1, 0x00}, {0x43, 0x01, 0xb1, 0x00},
+        {0x5d, 0x01, 0xb1, 0x00}, {0x02, 0x01, 0xb1, 0x01},
+        {0x55, 0x01, 0xb3, 0x00}, {0x43, 0x01, 0xb3, 0x00},
+        {0x5d, 0x01, 0xb3, 0x00}, {0x02, 0x01, 0xb3, 0x01},
+        {0x55, 0x01, 0xd1, 0x00}, {0x43, 0x01, 0xd1, 0x00},
+        {0x5d, 0x01, 0xd1, 0x00}, {0x02, 0x01, 0xd1, 0x01}
+    },
+    /* 198 */
+    {
+        {0x56, 0x01, 0xb0, 0x00}, {0x82, 0x01, 0xb0, 0x00},
+        {0x44, 0x01, 0xb0, 0x00}, {0x52, 0x01, 0xb0, 0x00},
+        {0x63, 0x01, 0xb0, 0x00}, {0x5e, 0x01, 0xb0, 0x00},
+        {0x68, 0x01, 0xb0, 0x00}, {0x03, 0x01, 0xb0, 0x01},
+        {0x56, 0x01, 0xb1, 0x00}, {0x82, 0x01, 0xb1, 0x00},
+        {0x44, 0x01, 0xb1, 0x00}, {0x52, 0x01, 0xb1, 0x00},
+        {0x63, 0x01, 0xb1, 0x00}, {0x5e, 0x01, 0xb1, 0x00},
+        {0x68, 0x01, 0xb1, 0x00}, {0x03, 0x01, 0xb1, 0x01}
+    },
+    /* 199 */
+    {
+        {0x42, 0x01, 0xb2, 0x00}, {0x01, 0x01, 0xb2, 0x01},
+        {0x42, 0x01, 0xb5, 0x00}, {0x01, 0x01, 0xb5, 0x01},
+        {0x42, 0x01, 0xb9, 0x00}, {0x01, 0x01, 0xb9, 0x01},
+        {0x42, 0x01, 0xba, 0x00}, {0x01, 0x01, 0xba, 0x01},
+        {0x42, 0x01, 0xbb, 0x00}, {0x01, 0x01, 0xbb, 0x01},
+        {0x42, 0x01, 0xbd, 0x00}, {0x01, 0x01, 0xbd, 0x01},
+        {0x42, 0x01, 0xbe, 0x00}, {0x01, 0x01, 0xbe, 0x01},
+        {0x42, 0x01, 0xc4, 0x00}, {0x01, 0x01, 0xc4, 0x01}
+    },
+    /* 200 */
+    {
+        {0x55, 0x01, 0xb2, 0x00}, {0x43, 0x01, 0xb2, 0x00},
+        {0x5d, 0x01, 0xb2, 0x00}, {0x02, 0x01, 0xb2, 0x01},
+        {0x55, 0x01, 0xb5, 0x00}, {0x43, 0x01, 0xb5, 0x00},
+        {0x5d, 0x01, 0xb5, 0x00}, {0x02, 0x01, 0xb5, 0x01},
+        {0x55, 0x01, 0xb9, 0x00}, {0x43, 0x01, 0xb9, 0x00},
+        {0x5d, 0x01, 0xb9, 0x00}, {0x02, 0x01, 0xb9, 0x01},
+        {0x55, 0x01, 0xba, 0x00}, {0x43, 0x01, 0xba, 0x00},
+        {0x5d, 0x01, 0xba, 0x00}, {0x02, 0x01, 0xba, 0x01}
+    },
+    /* 201 */
+    {
+        {0x56, 0x01, 0xb2, 0x00}, {0x82, 0x01, 0xb2, 0x00},
+        {0x44, 0x01, 0xb2, 0x00}, {0x52, 0x01, 0xb2, 0x00},
+        {0x63, 0x01, 0xb2, 0x00}, {0x5e, 0x01, 0xb2, 0x00},
+        {0x68, 0x01, 0xb2, 0x00}, {0x03, 0x01, 0xb2, 0x01},
+        {0x56, 0x01, 0xb5, 0x00}, {0x82, 0x01, 0xb5, 0x00},
+        {0x44, 0x01, 0xb5, 0x00}, {0x52, 0x01, 0xb5, 0x00},
+        {0x63, 0x01, 0xb5, 0x00}, {0x5e, 0x01, 0xb5, 0x00},
+        {0x68, 0x01, 0xb5, 0x00}, {0x03, 0x01, 0xb5, 0x01}
+    },
+    /* 202 */
+    {
+        {0x56, 0x01, 0xb3, 0x00}, {0x82, 0x01, 0xb3, 0x00},
+        {0x44, 0x01, 0xb3, 0x00}, {0x52, 0x01, 0xb3, 0x00},
+        {0x63, 0x01, 0xb3, 0x00}, {0x5e, 0x01, 0xb3, 0x00},
+        {0x68, 0x01, 0xb3, 0x00}, {0x03, 0x01, 0xb3, 0x01},
+        {0x56, 0x01, 0xd1, 0x00}, {0x82, 0x01, 0xd1, 0x00},
+        {0x44, 0x01, 0xd1, 0x00}, {0x52, 0x01, 0xd1, 0x00},
+        {0x63, 0x01, 0xd1, 0x00}, {0x5e, 0x01, 0xd1, 0x00},
+        {0x68, 0x01, 0xd1, 0x00}, {0x03, 0x01, 0xd1, 0x01}
+    },
+    /* 203 */
+    {
+        {0x56, 0x01, 0xb6, 0x00}, {0x82, 0x01, 0xb6, 0x00},
+        {0x44, 0x01, 0xb6, 0x00}, {0x52, 0x01, 0xb6, 0x00},
+        {0x63, 0x01, 0xb6, 0x00}, {0x5e, 0x01, 0xb6, 0x00},
+        {0x68, 0x01, 0xb6, 0x00}, {0x03, 0x01, 0xb6, 0x01},
+        {0x56, 0x01, 0xb7, 0x00}, {0x82, 0x01, 0xb7, 0x00},
+        {0x44, 0x01, 0xb7, 0x00}, {0x52, 0x01, 0xb7, 0x00},
+        {0x63, 0x01, 0xb7, 0x00}, {0x5e, 0x01, 0xb7, 0x00},
+        {0x68, 0x01, 0xb7, 0x00}, {0x03, 0x01, 0xb7, 0x01}
+    },
+    /* 204 */
+    {
+        {0x56, 0x01, 0xb8, 0x00}, {0x82, 0x01, 0xb8, 0x00},
+        {0x44, 0x01, 0xb8, 0x00}, {0x52, 0x01, 0xb8, 0x00},
+        {0x63, 0x01, 0xb8, 0x00}, {0x5e, 0x01, 0xb8, 0x00},
+        {0x68, 0x01, 0xb8, 0x00}, {0x03, 0x01, 0xb8, 0x01},
+        {0x56, 0x01, 0xc2, 0x00}, {0x82, 0x01, 0xc2, 0x00},
+        {0x44, 0x01, 0xc2, 0x00}, {0x52, 0x01, 0xc2, 0x00},
+        {0x63, 0x01, 0xc2, 0x00}, {0x5e, 0x01, 0xc2, 0x00},
+        {0x68, 0x01, 0xc2, 0x00}, {0x03, 0x01, 0xc2, 0x01}
+    },
+    /* 205 */
+    {
+        {0x56, 0x01, 0xb9, 0x00}, {0x82, 0x01, 0xb9, 0x00},
+        {0x44, 0x01, 0xb9, 0x00}, {0x52, 0x01, 0xb9, 0x00},
+        {0x63, 0x01, 0xb9, 0x00}, {0x5e, 0x01, 0xb9, 0x00},
+        {0x68, 0x01, 0xb9, 0x00}, {0x03, 0x01, 0xb9, 0x01},
+        {0x56, 0x01, 0xba, 0x00}, {0x82, 0x01, 0xba, 0x00},
+        {0x44, 0x01, 0xba, 0x00}, {0x52, 0x01, 0xba, 0x00},
+        {0x63, 0x01, 0xba, 0x00}, {0x5e, 0x01, 0xba, 0x00},
+        {0x68, 0x01, 0xba, 0x00}, {0x03, 0x01, 0xba, 0x01}
+    },
+    /* 206 */
+    {
+        {0x55, 0x01, 0xbb, 0x00}, {0x43, 0x01, 0xbb, 0x00},
+        {0x5d, 0x01, 0xbb, 0x00}, {0x02, 0x01, 0xbb, 0x01},
+        {0x55, 0x01, 0xbd, 0x00}, {0x43, 0x01, 0xbd, 0x00},
+        {0x5d, 0x01, 0xbd, 0x00}, {0x02, 0x01, 0xbd, 0x01},
+        {0x55, 0x01, 0xbe, 0x00}, {0x43, 0x01, 0xbe, 0x00},
+        {0x5d, 0x01, 0xbe, 0x00}, {0x02, 0x01, 0xbe, 0x01},
+        {0x55, 0x01, 0xc4, 0x00}, {0x43, 0x01, 0xc4, 0x00},
+        {0x5d, 0x01, 0xc4, 0x00}, {0x02, 0x01, 0xc4, 0x01}
+    },
+    /* 207 */
+    {
+        {0x56, 0x01, 0xbb, 0x00}, {0x82, 0x01, 0xbb, 0x00},
+        {0x44, 0x01, 0xbb, 0x00}, {0x52, 0x01, 0xbb, 0x00},
+        {0x63, 0x01, 0xbb, 0x00}, {0x5e, 0x01, 0xbb, 0x00},
+        {0x68, 0x01, 0xbb, 0x00}, {0x03, 0x01, 0xbb, 0x01},
+        {0x56, 0x01, 0xbd, 0x00}, {0x82, 0x01, 0xbd, 0x00},
+        {0x44, 0x01, 0xbd, 0x00}, {0x52, 0x01, 0xbd, 0x00},
+        {0x63, 0x01, 0xbd, 0x00}, {0x5e, 0x01, 0xbd, 0x00},
+        {0x68, 0x01, 0xbd, 0x00}, {0x03, 0x01, 0xbd, 0x01}
+    },
+    /* 208 */
+    {
+        {0x55, 0x01, 0xbc, 0x00}, {0x43, 0x01, 0xbc, 0x00},
+        {0x5d, 0x01, 0xbc, 0x00}, {0x02, 0x01, 0xbc, 0x01},
+        {0x55, 0x01, 0xbf, 0x00}, {0x43, 0x01, 0xbf, 0x00},
+        {0x5d, 0x01, 0xbf, 0x00}, {0x02, 0x01, 0xbf, 0x01},
+        {0x55, 0x01, 0xc5, 0x00}, {0x43, 0x01, 0xc5, 0x00},
+        {0x5d, 0x01, 0xc5, 0x00}, {0x02, 0x01, 0xc5, 0x01},
+        {0x55, 0x01, 0xe7, 0x00}, {0x43, 0x01, 0xe7, 0x00},
+        {0x5d, 0x01, 0xe7, 0x00}, {0x02, 0x01, 0xe7, 0x01}
+    },
+    /* 209 */
+    {
+        {0x56, 0x01, 0xbc, 0x00}, {0x82, 0x01, 0xbc, 0x00},
+        {0x44, 0x01, 0xbc, 0x00}, {0x52, 0x01, 0xbc, 0x00},
+        {0x63, 0x01, 0xbc, 0x00}, {0x5e, 0x01, 0xbc, 0x00},
+        {0x68, 0x01, 0xbc, 0x00}, {0x03, 0x01, 0xbc, 0x01},
+        {0x56, 0x01, 0xbf, 0x00}, {0x82, 0x01, 0xbf, 0x00},
+        {0x44, 0x01, 0xbf, 0x00}, {0x52, 0x01, 0xbf, 0x00},
+        {0x63, 0x01, 0xbf, 0x00}, {0x5e, 0x01, 0xbf, 0x00},
+        {0x68, 0x01, 0xbf, 0x00}, {0x03, 0x01, 0xbf, 0x01}
+    },
+    /* 210 */
+    {
+        {0x56, 0x01, 0xbe, 0x00}, {0x82, 0x01, 0xbe, 0x00},
+        {0x44, 0x01, 0xbe, 0x00}, {0x52, 0x01, 0xbe, 0x00},
+        {0x63, 0x01, 0xbe, 0x00}, {0x5e, 0x01, 0xbe, 0x00},
+        {0x68, 0x01, 0xbe, 0x00}, {0x03, 0x01, 0xbe, 0x01},
+        {0x56, 0x01, 0xc4, 0x00}, {0x82, 0x01, 0xc4, 0x00},
+        {0x44, 0x01, 0xc4, 0x00}, {0x52, 0x01, 0xc4, 0x00},
+        {0x63, 0x01, 0xc4, 0x00}, {0x5e, 0x01, 0xc4, 0x00},
+        {0x68, 0x01, 0xc4, 0x00}, {0x03, 0x01, 0xc4, 0x01}
+    },
+    /* 211 */
+    {
+        {0x00, 0x01, 0xc0, 0x01}, {0x00, 0x01, 0xc1, 0x01},
+        {0x00, 0x01, 0xc8, 0x01}, {0x00, 0x01, 0xc9, 0x01},
+        {0x00, 0x01, 0xca, 0x01}, {0x00, 0x01, 0xcd, 0x01},
+        {0x00, 0x01, 0xd2, 0x01}, {0x00, 0x01, 0xd5, 0x01},
+        {0x00, 0x01, 0xda, 0x01}, {0x00, 0x01, 0xdb, 0x01},
+        {0x00, 0x01, 0xee, 0x01}, {0x00, 0x01, 0xf0, 0x01},
+        {0x00, 0x01, 0xf2, 0x01}, {0x00, 0x01, 0xf3, 0x01},
+        {0x00, 0x01, 0xff, 0x01}, {0xe3, 0x00, 0x00, 0x00}
+    },
+    /* 212 */
+    {
+        {0x42, 0x01, 0xc0, 0x00}, {0x01, 0x01, 0xc0, 0x01},
+        {0x42, 0x01, 0xc1, 0x00}, {0x01, 0x01, 0xc1, 0x01},
+        {0x42, 0x01, 0xc8, 0x00}, {0x01, 0x01, 0xc8, 0x01},
+        {0x42, 0x01, 0xc9, 0x00}, {0x01, 0x01, 0xc9, 0x01},
+        {0x42, 0x01, 0xca, 0x00}, {0x01, 0x01, 0xca, 0x01},
+        {0x42, 0x01, 0xcd, 0x00}, {0x01, 0x01, 0xcd, 0x01},
+        {0x42, 0x01, 0xd2, 0x00}, {0x01, 0x01, 0xd2, 0x01},
+        {0x42, 0x01, 0xd5, 0x00}, {0x01, 0x01, 0xd5, 0x01}
+    },
+    /* 213 */
+    {
+        {0x55, 0x01, 0xc0, 0x00}, {0x43, 0x01, 0xc0, 0x00},
+        {0x5d, 0x01, 0xc0, 0x00}, {0x02, 0x01, 0xc0, 0x01},
+        {0x55, 0x01, 0xc1, 0x00}, {0x43, 0x01, 0xc1, 0x00},
+        {0x5d, 0x01, 0xc1, 0x00}, {0x02, 0x01, 0xc1, 0x01},
+        {0x55, 0x01, 0xc8, 0x00}, {0x43, 0x01, 0xc8, 0x00},
+        {0x5d, 0x01, 0xc8, 0x00}, {0x02, 0x01, 0xc8, 0x01},
+        {0x55, 0x01, 0xc9, 0x00}, {0x43, 0x01, 0xc9, 0x00},
+        {0x5d, 0x01, 0xc9, 0x00}, {0x02, 0x01, 0xc9, 0x01}
+    },
+    /* 214 */
+    {
+        {0x56, 0x01, 0xc0, 0x00}, {0x82, 0x01, 0xc0, 0x00},
+        {0x44, 0x01, 0xc0, 0x00}, {0x52, 0x01, 0xc0, 0x00},
+        {0x63, 0x01, 0xc0, 0x00}, {0x5e, 0x01, 0xc0, 0x00},
+        {0x68, 0x01, 0xc0, 0x00}, {0x03, 0x01, 0xc0, 0x01},
+        {0x56, 0x01, 0xc1, 0x00}, {0x82, 0x01, 0xc1, 0x00},
+        {0x44, 0x01, 0xc1, 0x00}, {0x52, 0x01, 0xc1, 0x00},
+        {0x63, 0x01, 0xc1, 0x00}, {0x5e, 0x01, 0xc1, 0x00},
+        {0x68, 0x01, 0xc1, 0x00}, {0x03, 0x01, 0xc1, 0x01}
+    },
+    /* 215 */
+    {
+        {0x56, 0x01, 0xc5, 0x00}, {0x82, 0x01, 0xc5, 0x00},
+        {0x44, 0x01, 0xc5, 0x00}, {0x52, 0x01, 0xc5, 0x00},
+        {0x63, 0x01, 0xc5, 0x00}, {0x5e, 0x01, 0xc5, 0x00},
+        {0x68, 0x01, 0xc5, 0x00}, {0x03, 0x01, 0xc5, 0x01},
+        {0x56, 0x01, 0xe7, 0x00}, {0x82, 0x01, 0xe7, 0x00},
+        {0x44, 0x01, 0xe7, 0x00}, {0x52, 0x01, 0xe7, 0x00},
+        {0x63, 0x01, 0xe7, 0x00}, {0x5e, 0x01, 0xe7, 0x00},
+        {0x68, 0x01, 0xe7, 0x00}, {0x03, 0x01, 0xe7, 0x01}
+    },
+    /* 216 */
+    {
+        {0x55, 0x01, 0xc6, 0x00}, {0x43, 0x01, 0xc6, 0x00},
+        {0x5d, 0x01, 0xc6, 0x00}, {0x02, 0x01, 0xc6, 0x01},
+        {0x55, 0x01, 0xe4, 0x00}, {0x43, 0x01, 0xe4, 0x00},
+        {0x5d, 0x01, 0xe4, 0x00}, {0x02, 0x01, 0xe4, 0x01},
+        {0x55, 0x01, 0xe8, 0x00}, {0x43, 0x01, 0xe8, 0x00},
+        {0x5d, 0x01, 0xe8, 0x00}, {0x02, 0x01, 0xe8, 0x01},
+        {0x55, 0x01, 0xe9, 0x00}, {0x43, 0x01, 0xe9, 0x00},
+        {0x5d, 0x01, 0xe9, 0x00}, {0x02, 0x01, 0xe9, 0x01}
+    },
+    /* 217 */
+    {
+        {0x56, 0x01, 0xc6, 0x00}, {0x82, 0x01, 0xc6, 0x00},
+        {0x44, 0x01, 0xc6, 0x00}, {0x52, 0x01, 0xc6, 0x00},
+        {0x63, 0x01, 0xc6, 0x00}, {0x5e, 0x01, 0xc6, 0x00},
+        {0x68, 0x01, 0xc6, 0x00}, {0x03, 0x01, 0xc6, 0x01},
+        {0x56, 0x01, 0xe4, 0x00}, {0x82, 0x01, 0xe4, 0x00},
+        {0x44, 0x01, 0xe4, 0x00}, {0x52, 0x01, 0xe4, 0x00},
+        {0x63, 0x01, 0xe4, 0x00}, {0x5e, 0x01, 0xe4, 0x00},
+        {0x68, 0x01, 0xe4, 0x00}, {0x03, 0x01, 0xe4, 0x01}
+    },
+    /* 218 */
+    {
+        {0x55, 0x01, 0xec, 0x00}, {0x43, 0x01, 0xec, 0x00},
+        {0x5d, 0x01, 0xec, 0x00}, {0x02, 0x01, 0xec, 0x01},
+        {0x55, 0x01, 0xed, 0x00}, {0x43, 0x01, 0xed, 0x00},
+        {0x5d, 0x01, 0xed, 0x00}, {0x02, 0x01, 0xed, 0x01},
+        {0x42, 0x01, 0xc7, 0x00}, {0x01, 0x01, 0xc7, 0x01},
+        {0x42, 0x01, 0xcf, 0x00}, {0x01, 0x01, 0xcf, 0x01},
+        {0x42, 0x01, 0xea, 0x00}, {0x01, 0x01, 0xea, 0x01},
+        {0x42, 0x01, 0xeb, 0x00}, {0x01, 0x01, 0xeb, 0x01}
+    },
+    /* 219 */
+    {
+        {0x55, 0x01, 0xc7, 0x00}, {0x43, 0x01, 0xc7, 0x00},
+        {0x5d, 0x01, 0xc7, 0x00}, {0x02, 0x01, 0xc7, 0x01},
+        {0x55, 0x01, 0xcf, 0x00}, {0x43, 0x01, 0xcf, 0x00},
+        {0x5d, 0x01, 0xcf, 0x00}, {0x02, 0x01, 0xcf, 0x01},
+        {0x55, 0x01, 0xea, 0x00}, {0x43, 0x01, 0xea, 0x00},
+        {0x5d, 0x01, 0xea, 0x00}, {0x02, 0x01, 0xea, 0x01},
+        {0x55, 0x01, 0xeb, 0x00}, {0x43, 0x01, 0xeb, 0x00},
+        {0x5d, 0x01, 0xeb, 0x00}, {0x02, 0x01, 0xeb, 0x01}
+    },
+    /* 220 */
+    {
+        {0x56, 0x01, 0xc7, 0x00}, {0x82, 0x01, 0xc7, 0x00},
+        {0x44, 0x01, 0xc7, 0x00}, {0x52, 0x01, 0xc7, 0x00},
+        {0x63, 0x01, 0xc7, 0x00}, {0x5e, 0x01, 0xc7, 0x00},
+        {0x68, 0x01, 0xc7, 0x00}, {0x03, 0x01, 0xc7, 0x01},
+        {0x56, 0x01, 0xcf, 0x00}, {0x82, 0x01, 0xcf, 0x00},
+        {0x44, 0x01, 0xcf, 0x00}, {0x52, 0x01, 0xcf, 0x00},
+        {0x63, 0x01, 0xcf, 0x00}, {0x5e, 0x01, 0xcf, 0x00},
+        {0x68, 0x01, 0xcf, 0x00}, {0x03, 0x01, 0xcf, 0x01}
+    },
+    /* 221 */
+    {
+        {0x56, 0x01, 0xc8, 0x00}, {0x82, 0x01, 0xc8, 0x00},
+        {0x44, 0x01, 0xc8, 0x00}, {0x52, 0x01, 0xc8, 0x00},
+        {0x63, 0x01, 0xc8, 0x00}, {0x5e, 0x01, 0xc8, 0x00},
+        {0x68, 0x01, 0xc8, 0x00}, {0x03, 0x01, 0xc8, 0x01},
+        {0x56, 0x01, 0xc9, 0x00}, {0x82, 0x01, 0xc9, 0x00},
+        {0x44, 0x01, 0xc9, 0x00}, {0x52, 0x01, 0xc9, 0x00},
+        {0x63, 0x01, 0xc9, 0x00}, {0x5e, 0x01, 0xc9, 0x00},
+        {0x68, 0x01, 0xc9, 0x00}, {0x03, 0x01, 0xc9, 0x01}
+    },
+    /* 222 */
+    {
+        {0x55, 0x01, 0xca, 0x00}, {0x43, 0x01, 0xca, 0x00},
+        {0x5d, 0x01, 0xca, 0x00}, {0x02, 0x01, 0xca, 0x01},
+        {0x55, 0x01, 0xcd, 0x00}, {0x43, 0x01, 0xcd, 0x00},
+        {0x5d, 0x01, 0xcd, 0x00}, {0x02, 0x01, 0xcd, 0x01},
+        {0x55, 0x01, 0xd2, 0x00}, {0x43, 0x01, 0xd2, 0x00},
+        {0x5d, 0x01, 0xd2, 0x00}, {0x02, 0x01, 0xd2, 0x01},
+        {0x55, 0x01, 0xd5, 0x00}, {0x43, 0x01, 0xd5, 0x00},
+        {0x5d, 0x01, 0xd5, 0x00}, {0x02, 0x01, 0xd5, 0x01}
+    },
+    /* 223 */
+    {
+        {0x56, 0x01, 0xca, 0x00}, {0x82, 0x01, 0xca, 0x00},
+        {0x44, 0x01, 0xca, 0x00}, {0x52, 0x01, 0xca, 0x00},
+        {0x63, 0x01, 0xca, 0x00}, {0x5e, 0x01, 0xca, 0x00},
+        {0x68, 0x01, 0xca, 0x00}, {0x03, 0x01, 0xca, 0x01},
+        {0x56, 0x01, 0xcd, 0x00}, {0x82, 0x01, 0xcd, 0x00},
+        {0x44, 0x01, 0xcd, 0x00}, {0x52, 0x01, 0xcd, 0x00},
+        {0x63, 0x01, 0xcd, 0x00}, {0x5e, 0x01, 0xcd, 0x00},
+        {0x68, 0x01, 0xcd, 0x00}, {0x03, 0x01, 0xcd, 0x01}
+    },
+    /* 224 */
+    {
+        {0x42, 0x01, 0xda, 0x00}, {0x01, 0x01, 0xda, 0x01},
+        {0x42, 0x01, 0xdb, 0x00}, {0x01, 0x01, 0xdb, 0x01},
+        {0x42, 0x01, 0xee, 0x00}, {0x01, 0x01, 0xee, 0x01},
+        {0x42, 0x01, 0xf0, 0x00}, {0x01, 0x01, 0xf0, 0x01},
+        {0x42, 0x01, 0xf2, 0x00}, {0x01, 0x01, 0xf2, 0x01},
+        {0x42, 0x01, 0xf3, 0x00}, {0x01, 0x01, 0xf3, 0x01},
+        {0x42, 0x01, 0xff, 0x00}, {0x01, 0x01, 0xff, 0x01},
+        {0x00, 0x01, 0xcb, 0x01}, {0x00, 0x01, 0xcc, 0x01}
+    },
+    /* 225 */
+    {
+        {0x55, 0x01, 0xf2, 0x00}, {0x43, 0x01, 0xf2, 0x00},
+        {0x5d, 0x01, 0xf2, 0x00}, {0x02, 0x01, 0xf2, 0x01},
+        {0x55, 0x01, 0xf3, 0x00}, {0x43, 0x01, 0xf3, 0x00},
+        {0x5d, 0x01, 0xf3, 0x00}, {0x02, 0x01, 0xf3, 0x01},
+        {0x55, 0x01, 0xff, 0x00}, {0x43, 0x01, 0xff, 0x00},
+        {0x5d, 0x01, 0xff, 0x00}, {0x02, 0x01, 0xff, 0x01},
+        {0x42, 0x01, 0xcb, 0x00}, {0x01, 0x01, 0xcb, 0x01},
+        {0x42, 0x01, 0xcc, 0x00}, {0x01, 0x01, 0xcc, 0x01}
+    },
+    /* 226 */
+    {
+        {0x56, 0x01, 0xff, 0x00}, {0x82, 0x01, 0xff, 0x00},
+        {0x44, 0x01, 0xff, 0x00}, {0x52, 0x01, 0xff, 0x00},
+        {0x63, 0x01, 0xff, 0x00}, {0x5e, 0x01, 0xff, 0x00},
+        {0x68, 0x01, 0xff, 0x00}, {0x03, 0x01, 0xff, 0x01},
+        {0x55, 0x01, 0xcb, 0x00}, {0x43, 0x01, 0xcb, 0x00},
+        {0x5d, 0x01, 0xcb, 0x00}, {0x02, 0x01, 0xcb, 0x01},
+        {0x55, 0x01, 0xcc, 0x00}, {0x43, 0x01, 0xcc, 0x00},
+        {0x5d, 0x01, 0xcc, 0x00}, {0x02, 0x01, 0xcc, 0x01}
+    },
+    /* 227 */
+    {
+        {0x56, 0x01, 0xcb, 0x00}, {0x82, 0x01, 0xcb, 0x00},
+        {0x44, 0x01, 0xcb, 0x00}, {0x52, 0x01, 0xcb, 0x00},
+        {0x63, 0x01, 0xcb, 0x00}, {0x5e, 0x01, 0xcb, 0x00},
+        {0x68, 0x01, 0xcb, 0x00}, {0x03, 0x01, 0xcb, 0x01},
+        {0x56, 0x01, 0xcc, 0x00}, {0x82, 0x01, 0xcc, 0x00},
+        {0x44, 0x01, 0xcc, 0x00}, {0x52, 0x01, 0xcc, 0x00},
+        {0x63, 0x01, 0xcc, 0x00}, {0x5e, 0x01, 0xcc, 0x00},
+        {0x68, 0x01, 0xcc, 0x00}, {0x03, 0x01, 0xcc, 0x01}
+    },
+    /* 228 */
+    {
+        {0x56, 0x01, 0xd2, 0x00}, {0x82, 0x01, 0xd2, 0x00},
+        {0x44, 0x01, 0xd2, 0x00}, {0x52, 0x01, 0xd2, 0x00},
+        {0x63, 0x01, 0xd2, 0x00}, {0x5e, 0x01, 0xd2, 0x00},
+        {0x68, 0x01, 0xd2, 0x00}, {0x03, 0x01, 0xd2, 0x01},
+        {0x56, 0x01, 0xd5, 0x00}, {0x82, 0x01, 0xd5, 0x00},
+        {0x44, 0x01, 0xd5, 0x00}, {0x52, 0x01, 0xd5, 0x00},
+        {0x63, 0x01, 0xd5, 0x00}, {0x5e, 0x01, 0xd5, 0x00},
+        {0x68, 0x01, 0xd5, 0x00}, {0x03, 0x01, 0xd5, 0x01}
+    },
+    /* 229 */
+    {
+        {0x00, 0x01, 0xd3, 0x01}, {0x00, 0x01, 0xd4, 0x01},
+        {0x00, 0x01, 0xd6, 0x01}, {0x00, 0x01, 0xdd, 0x01},
+        {0x00, 0x01, 0xde, 0x01}, {0x00, 0x01, 0xdf, 0x01},
+        {0x00, 0x01, 0xf1, 0x01}, {0x00, 0x01, 0xf4, 0x01},
+        {0x00, 0x01, 0xf5, 0x01}, {0x00, 0x01, 0xf6, 0x01},
+        {0x00, 0x01, 0xf7, 0x01}, {0x00, 0x01, 0xf8, 0x01},
+        {0x00, 0x01, 0xfa, 0x01}, {0x00, 0x01, 0xfb, 0x01},
+        {0x00, 0x01, 0xfc, 0x01}, {0x00, 0x01, 0xfd, 0x01}
+    },
+    /* 230 */
+    {
+        {0x42, 0x01, 0xd3, 0x00}, {0x01, 0x01, 0xd3, 0x01},
+        {0x42, 0x01, 0xd4, 0x00}, {0x01, 0x01, 0xd4, 0x01},
+        {0x42, 0x01, 0xd6, 0x00}, {0x01, 0x01, 0xd6, 0x01},
+        {0x42, 0x01, 0xdd, 0x00}, {0x01, 0x01, 0xdd, 0x01},
+        {0x42, 0x01, 0xde, 0x00}, {0x01, 0x01, 0xde, 0x01},
+        {0x42, 0x01, 0xdf, 0x00}, {0x01, 0x01, 0xdf, 0x01},
+        {0x42, 0x01, 0xf1, 0x00}, {0x01, 0x01, 0xf1, 0x01},
+        {0x42, 0x01, 0xf4, 0x00}, {0x01, 0x01, 0xf4, 0x01}
+    },
+    /* 231 */
+    {
+        {0x55, 0x01, 0xd3, 0x00}, {0x43, 0x01, 0xd3, 0x00},
+        {0x5d, 0x01, 0xd3, 0x00}, {0x02, 0x01, 0xd3, 0x01},
+        {0x55, 0x01, 0xd4, 0x00}, {0x43, 0x01, 0xd4, 0x00},
+        {0x5d, 0x01, 0xd4, 0x00}, {0x02, 0x01, 0xd4, 0x01},
+        {0x55, 0x01, 0xd6, 0x00}, {0x43, 0x01, 0xd6, 0x00},
+        {0x5d, 0x01, 0xd6, 0x00}, {0x02, 0x01, 0xd6, 0x01},
+        {0x55, 0x01, 0xdd, 0x00}, {0x43, 0x01, 0xdd, 0x00},
+        {0x5d, 0x01, 0xdd, 0x00}, {0x02, 0x01, 0xdd, 0x01}
+    },
+    /* 232 */
+    {
+        {0x56, 0x01, 0xd3, 0x00}, {0x82, 0x01, 0xd3, 0x00},
+        {0x44, 0x01, 0xd3, 0x00}, {0x52, 0x01, 0xd3, 0x00},
+        {0x63, 0x01, 0xd3, 0x00}, {0x5e, 0x01, 0xd3, 0x00},
+        {0x68, 0x01, 0xd3, 0x00}, {0x03, 0x01, 0xd3, 0x01},
+        {0x56, 0x01, 0xd4, 0x00}, {0x82, 0x01, 0xd4, 0x00},
+        {0x44, 0x01, 0xd4, 0x00}, {0x52, 0x01, 0xd4, 0x00},
+        {0x63, 0x01, 0xd4, 0x00}, {0x5e, 0x01, 0xd4, 0x00},
+        {0x68, 0x01, 0xd4, 0x00}, {0x03, 0x01, 0xd4, 0x01}
+    },
+    /* 233 */
+    {
+        {0x56, 0x01, 0xd6, 0x00}, {0x82, 0x01, 0xd6, 0x00},
+        {0x44, 0x01, 0xd6, 0x00}, {0x52, 0x01, 0xd6, 0x00},
+        {0x63, 0x01, 0xd6, 0x00}, {0x5e, 0x01, 0xd6, 0x00},
+        {0x68, 0x01, 0xd6, 0x00}, {0x03, 0x01, 0xd6, 0x01},
+        {0x56, 0x01, 0xdd, 0x00}, {0x82, 0x01, 0xdd, 0x00},
+        {0x44, 0x01, 0xdd, 0x00}, {0x52, 0x01, 0xdd, 0x00},
+        {0x63, 0x01, 0xdd, 0x00}, {0x5e, 0x01, 0xdd, 0x00},
+        {0x68, 0x01, 0xdd, 0x00}, {0x03, 0x01, 0xdd, 0x01}
+    },
+    /* 234 */
+    {
+        {0x56, 0x01, 0xd7, 0x00}, {0x82, 0x01, 0xd7, 0x00},
+        {0x44, 0x01, 0xd7, 0x00}, {0x52, 0x01, 0xd7, 0x00},
+        {0x63, 0x01, 0xd7, 0x00}, {0x5e, 0x01, 0xd7, 0x00},
+        {0x68, 0x01, 0xd7, 0x00}, {0x03, 0x01, 0xd7, 0x01},
+        {0x56, 0x01, 0xe1, 0x00}, {0x82, 0x01, 0xe1, 0x00},
+        {0x44, 0x01, 0xe1, 0x00}, {0x52, 0x01, 0xe1, 0x00},
+        {0x63, 0x01, 0xe1, 0x00}, {0x5e, 0x01, 0xe1, 0x00},
+        {0x68, 0x01, 0xe1, 0x00}, {0x03, 0x01, 0xe1, 0x01}
+    },
+    /* 235 */
+    {
+        {0x55, 0x01, 0xd8, 0x00}, {0x43, 0x01, 0xd8, 0x00},
+        {0x5d, 0x01, 0xd8, 0x00}, {0x02, 0x01, 0xd8, 0x01},
+        {0x55, 0x01, 0xd9, 0x00}, {0x43, 0x01, 0xd9, 0x00},
+        {0x5d, 0x01, 0xd9, 0x00}, {0x02, 0x01, 0xd9, 0x01},
+        {0x55, 0x01, 0xe3, 0x00}, {0x43, 0x01, 0xe3, 0x00},
+        {0x5d, 0x01, 0xe3, 0x00}, {0x02, 0x01, 0xe3, 0x01},
+        {0x55, 0x01, 0xe5, 0x00}, {0x43, 0x01, 0xe5, 0x00},
+        {0x5d, 0x01, 0xe5, 0x00}, {0x02, 0x01, 0xe5, 0x01}
+    },
+    /* 236 */
+    {
+        {0x56, 0x01, 0xd8, 0x00}, {0x82, 0x01, 0xd8, 0x00},
+        {0x44, 0x01, 0xd8, 0x00}, {0x52, 0x01, 0xd8, 0x00},
+        {0x63, 0x01, 0xd8, 0x00}, {0x5e, 0x01, 0xd8, 0x00},
+        {0x68, 0x01, 0xd8, 0x00}, {0x03, 0x01, 0xd8, 0x01},
+        {0x56, 0x01, 0xd9, 0x00}, {0x82, 0x01, 0xd9, 0x00},
+        {0x44, 0x01, 0xd9, 0x00}, {0x52, 0x01, 0xd9, 0x00},
+        {0x63, 0x01, 0xd9, 0x00}, {0x5e, 0x01, 0xd9, 0x00},
+        {0x68, 0x01, 0xd9, 0x00}, {0x03, 0x01, 0xd9, 0x01}
+    },
+    /* 237 */
+    {
+        {0x55, 0x01, 0xda, 0x00}, {0x43, 0x01, 0xda, 0x00},
+        {0x5d, 0x01, 0xda, 0x00}, {0x02, 0x01, 0xda, 0x01},
+        {0x55, 0x01, 0xdb, 0x00}, {0x43, 0x01, 0xdb, 0x00},
+        {0x5d, 0x01, 0xdb, 0x00}, {0x02, 0x01, 0xdb, 0x01},
+        {0x55, 0x01, 0xee, 0x00}, {0x43, 0x01, 0xee, 0x00},
+        {0x5d, 0x01, 0xee, 0x00}, {0x02, 0x01, 0xee, 0x01},
+        {0x55, 0x01, 0xf0, 0x00}, {0x43, 0x01, 0xf0, 0x00},
+        {0x5d, 0x01, 0xf0, 0x00}, {0x02, 0x01, 0xf0, 0x01}
+    },
+    /* 238 */
+    {
+        {0x56, 0x01, 0xda, 0x00}, {0x82, 0x01, 0xda, 0x00},
+        {0x44, 0x01, 0xda, 0x00}, {0x52, 0x01, 0xda, 0x00},
+        {0x63, 0x01, 0xda, 0x00}, {0x5e, 0x01, 0xda, 0x00},
+        {0x68, 0x01, 0xda, 0x00}, {0x03, 0x01, 0xda, 0x01},
+        {0x56, 0x01, 0xdb, 0x00}, {0x82, 0x01, 0xdb, 0x00},
+        {0x44, 0x01, 0xdb, 0x00}, {0x52, 0x01, 0xdb, 0x00},
+        {0x63, 0x01, 0xdb, 0x00}, {0x5e, 0x01, 0xdb, 0x00},
+        {0x68, 0x01, 0xdb, 0x00}, {0x03, 0x01, 0xdb, 0x01}
+    },
+    /* 239 */
+    {
+        {0x55, 0x01, 0xde, 0x00}, {0x43, 0x01, 0xde, 0x00},
+        {0x5d, 0x01, 0xde, 0x00}, {0x02, 0x01, 0xde, 0x01},
+        {0x55, 0x01, 0xdf, 0x00}, {0x43, 0x01, 0xdf, 0x00},
+        {0x5d, 0x01, 0xdf, 0x00}, {0x02, 0x01, 0xdf, 0x01},
+        {0x55, 0x01, 0xf1, 0x00}, {0x43, 0x01, 0xf1, 0x00},
+        {0x5d, 0x01, 0xf1, 0x00}, {0x02, 0x01, 0xf1, 0x01},
+        {0x55, 0x01, 0xf4, 0x00}, {0x43, 0x01, 0xf4, 0x00},
+        {0x5d, 0x01, 0xf4, 0x00}, {0x02, 0x01, 0xf4, 0x01}
+    },
+    /* 240 */
+    {
+        {0x56, 0x01, 0xde, 0x00}, {0x82, 0x01, 0xde, 0x00},
+        {0x44, 0x01, 0xde, 0x00}, {0x52, 0x01, 0xde, 0x00},
+        {0x63, 0x01, 0xde, 0x00}, {0x5e, 0x01, 0xde, 0x00},
+        {0x68, 0x01, 0xde, 0x00}, {0x03, 0x01, 0xde, 0x01},
+        {0x56, 0x01, 0xdf, 0x00}, {0x82, 0x01, 0xdf, 0x00},
+        {0x44, 0x01, 0xdf, 0x00}, {0x52, 0x01, 0xdf, 0x00},
+        {0x63, 0x01, 0xdf, 0x00}, {0x5e, 0x01, 0xdf, 0x00},
+        {0x68, 0x01, 0xdf, 0x00}, {0x03, 0x01, 0xdf, 0x01}
+    },
+    /* 241 */
+    {
+        {0x56, 0x01, 0xe0, 0x00}, {0x82, 0x01, 0xe0, 0x00},
+        {0x44, 0x01, 0xe0, 0x00}, {0x52, 0x01, 0xe0, 0x00},
+        {0x63, 0x01, 0xe0, 0x00}, {0x5e, 0x01, 0xe0, 0x00},
+        {0x68, 0x01, 0xe0, 0x00}, {0x03, 0x01, 0xe0, 0x01},
+        {0x56, 0x01, 0xe2, 0x00}, {0x82, 0x01, 0xe2, 0x00},
+        {0x44, 0x01, 0xe2, 0x00}, {0x52, 0x01, 0xe2, 0x00},
+        {0x63, 0x01, 0xe2, 0x00}, {0x5e, 0x01, 0xe2, 0x00},
+        {0x68, 0x01, 0xe2, 0x00}, {0x03, 0x01, 0xe2, 0x01}
+    },
+    /* 242 */
+    {
+        {0x56, 0x01, 0xe3, 0x00}, {0x82, 0x01, 0xe3, 0x00},
+        {0x44, 0x01, 0xe3, 0x00}, {0x52, 0x01, 0xe3, 0x00},
+        {0x63, 0x01, 0xe3, 0x00}, {0x5e, 0x01, 0xe3, 0x00},
+        {0x68, 0x01, 0xe3, 0x00}, {0x03, 0x01, 0xe3, 0x01},
+        {0x56, 0x01, 0xe5, 0x00}, {0x82, 0x01, 0xe5, 0x00},
+        {0x44, 0x01, 0xe5, 0x00}, {0x52, 0x01, 0xe5, 0x00},
+        {0x63, 0x01, 0xe5, 0x00}, {0x5e, 0x01, 0xe5, 0x00},
+        {0x68, 0x01, 0xe5, 0x00}, {0x03, 0x01, 0xe5, 0x01}
+    },
+    /* 243 */
+    {
+        {0x56, 0x01, 0xe8, 0x00}, {0x82, 0x01, 0xe8, 0x00},
+        {0x44, 0x01, 0xe8, 0x00}, {0x52, 0x01, 0xe8, 0x00},
+        {0x63, 0x01, 0xe8, 0x00}, {0x5e, 0x01, 0xe8, 0x00},
+        {0x68, 0x01, 0xe8, 0x00}, {0x03, 0x01, 0xe8, 0x01},
+        {0x56, 0x01, 0xe9, 0x00}, {0x82, 0x01, 0xe9, 0x00},
+        {0x44, 0x01, 0xe9, 0x00}, {0x52, 0x01, 0xe9, 0x00},
+        {0x63, 0x01, 0xe9, 0x00}, {0x5e, 0x01, 0xe9, 0x00},
+        {0x68, 0x01, 0xe9, 0x00}, {0x03, 0x01, 0xe9, 0x01}
+    },
+    /* 244 */
+    {
+        {0x56, 0x01, 0xea, 0x00}, {0x82, 0x01, 0xea, 0x00},
+        {0x44, 0x01, 0xea, 0x00}, {0x52, 0x01, 0xea, 0x00},
+        {0x63, 0x01, 0xea, 0x00}, {0x5e, 0x01, 0xea, 0x00},
+        {0x68, 0x01, 0xea, 0x00}, {0x03, 0x01, 0xea, 0x01},
+        {0x56, 0x01, 0xeb, 0x00}, {0x82, 0x01, 0xeb, 0x00},
+        {0x44, 0x01, 0xeb, 0x00}, {0x52, 0x01, 0xeb, 0x00},
+        {0x63, 0x01, 0xeb, 0x00}, {0x5e, 0x01, 0xeb, 0x00},
+        {0x68, 0x01, 0xeb, 0x00}, {0x03, 0x01, 0xeb, 0x01}
+    },
+    /* 245 */
+    {
+        {0x56, 0x01, 0xec, 0x00}, {0x82, 0x01, 0xec, 0x00},
+        {0x44, 0x01, 0xec, 0x00}, {0x52, 0x01, 0xec, 0x00},
+        {0x63, 0x01, 0xec, 0x00}, {0x5e, 0x01, 0xec, 0x00},
+        {0x68, 0x01, 0xec, 0x00}, {0x03, 0x01, 0xec, 0x01},
+        {0x56, 0x01, 0xed, 0x00}, {0x82, 0x01, 0xed, 0x00},
+        {0x44, 0x01, 0xed, 0x00}, {0x52, 0x01, 0xed, 0x00},
+        {0x63, 0x01, 0xed, 0x00}, {0x5e, 0x01, 0xed, 0x00},
+        {0x68, 0x01, 0xed, 0x00}, {0x03, 0x01, 0xed, 0x01}
+    },
+    /* 246 */
+    {
+        {0x56, 0x01, 0xee, 0x00}, {0x82, 0x01, 0xee, 0x00},
+        {0x44, 0x01, 0xee, 0x00}, {0x52, 0x01, 0xee, 0x00},
+        {0x63, 0x01, 0xee, 0x00}, {0x5e, 0x01, 0xee, 0x00},
+        {0x68, 0x01, 0xee, 0x00}, {0x03, 0x01, 0xee, 0x01},
+        {0x56, 0x01, 0xf0, 0x00}, {0x82, 0x01, 0xf0, 0x00},
+        {0x44, 0x01, 0xf0, 0x00}, {0x52, 0x01, 0xf0, 0x00},
+        {0x63, 0x01, 0xf0, 0x00}, {0x5e, 0x01, 0xf0, 0x00},
+        {0x68, 0x01, 0xf0, 0x00}, {0x03, 0x01, 0xf0, 0x01}
+    },
+    /* 247 */
+    {
+        {0x56, 0x01, 0xf1, 0x00}, {0x82, 0x01, 0xf1, 0x00},
+        {0x44, 0x01, 0xf1, 0x00}, {0x52, 0x01, 0xf1, 0x00},
+        {0x63, 0x01, 0xf1, 0x00}, {0x5e, 0x01, 0xf1, 0x00},
+        {0x68, 0x01, 0xf1, 0x00}, {0x03, 0x01, 0xf1, 0x01},
+        {0x56, 0x01, 0xf4, 0x00}, {0x82, 0x01, 0xf4, 0x00},
+        {0x44, 0x01, 0xf4, 0x00}, {0x52, 0x01, 0xf4, 0x00},
+        {0x63, 0x01, 0xf4, 0x00}, {0x5e, 0x01, 0xf4, 0x00},
+        {0x68, 0x01, 0xf4, 0x00}, {0x03, 0x01, 0xf4, 0x01}
+    },
+    /* 248 */
+    {
+        {0x56, 0x01, 0xf2, 0x00}, {0x82, 0x01, 0xf2, 0x00},
+        {0x44, 0x01, 0xf2, 0x00}, {0x52, 0x01, 0xf2, 0x00},
+        {0x63, 0x01, 0xf2, 0x00}, {0x5e, 0x01, 0xf2, 0x00},
+        {0x68, 0x01, 0xf2, 0x00}, {0x03, 0x01, 0xf2, 0x01},
+        {0x56, 0x01, 0xf3, 0x00}, {0x82, 0x01, 0xf3, 0x00},
+        {0x44, 0x01, 0xf3, 0x00}, {0x52, 0x01, 0xf3, 0x00},
+        {0x63, 0x01, 0xf3, 0x00}, {0x5e, 0x01, 0xf3, 0x00},
+        {0x68, 0x01, 0xf3, 0x00}, {0x03, 0x01, 0xf3, 0x01}
+    },
+    /* 249 */
+    {
+        {0x42, 0x01, 0xf5, 0x00}, {0x01, 0x01, 0xf5, 0x01},
+        {0x42, 0x01, 0xf6, 0x00}, {0x01, 0x01, 0xf6, 0x01},
+        {0x42, 0x01, 0xf7, 0x00}, {0x01, 0x01, 0xf7, 0x01},
+        {0x42, 0x01, 0xf8, 0x00}, {0x01, 0x01, 0xf8, 0x01},
+        {0x42, 0x01, 0xfa, 0x00}, {0x01, 0x01, 0xfa, 0x01},
+        {0x42, 0x01, 0xfb, 0x00}, {0x01, 0x01, 0xfb, 0x01},
+        {0x42, 0x01, 0xfc, 0x00}, {0x01, 0x01, 0xfc, 0x01},
+        {0x42, 0x01, 0xfd, 0x00}, {0x01, 0x01, 0xfd, 0x01}
+    },
+    /* 250 */
+    {
+        {0x55, 0x01, 0xf5, 0x00}, {0x43, 0x01, 0xf5, 0x00},
+        {0x5d, 0x01, 0xf5, 0x00}, {0x02, 0x01, 0xf5, 0x01},
+        {0x55, 0x01, 0xf6, 0x00}, {0x43, 0x01, 0xf6, 0x00},
+        {0x5d, 0x01, 0xf6, 0x00}, {0x02, 0x01, 0xf6, 0x01},
+        {0x55, 0x01, 0xf7, 0x00}, {0x43, 0x01, 0xf7, 0x00},
+        {0x5d, 0x01, 0xf7, 0x00}, {0x02, 0x01, 0xf7, 0x01},
+        {0x55, 0x01, 0xf8, 0x00}, {0x43, 0x01, 0xf8, 0x00},
+        {0x5d, 0x01, 0xf8, 0x00}, {0x02, 0x01, 0xf8, 0x01}
+    },
+    /* 251 */
+    {
+        {0x56, 0x01, 0xf5, 0x00}, {0x82, 0x01, 0xf5, 0x00},
+        {0x44, 0x01, 0xf5, 0x00}, {0x52, 0x01, 0xf5, 0x00},
+        {0x63, 0x01, 0xf5, 0x00}, {0x5e, 0x01, 0xf5, 0x00},
+        {0x68, 0x01, 0xf5, 0x00}, {0x03, 0x01, 0xf5, 0x01},
+        {0x56, 0x01, 0xf6, 0x00}, {0x82, 0x01, 0xf6, 0x00},
+        {0x44, 0x01, 0xf6, 0x00}, {0x52, 0x01, 0xf6, 0x00},
+        {0x63, 0x01, 0xf6, 0x00}, {0x5e, 0x01, 0xf6, 0x00},
+        {0x68, 0x01, 0xf6, 0x00}, {0x03, 0x01, 0xf6, 0x01}
+    },
+    /* 252 */
+    {
+        {0x56, 0x01, 0xf7, 0x00}, {0x82, 0x01, 0xf7, 0x00},
+        {0x44, 0x01, 0xf7, 0x00}, {0x52, 0x01, 0xf7, 0x00},
+        {0x63, 0x01, 0xf7, 0x00}, {0x5e, 0x01, 0xf7, 0x00},
+        {0x68, 0x01, 0xf7, 0x00}, {0x03, 0x01, 0xf7, 0x01},
+        {0x56, 0x01, 0xf8, 0x00}, {0x82, 0x01, 0xf8, 0x00},
+        {0x44, 0x01, 0xf8, 0x00}, {0x52, 0x01, 0xf8, 0x00},
+        {0x63, 0x01, 0xf8, 0x00}, {0x5e, 0x01, 0xf8, 0x00},
+        {0x68, 0x01, 0xf8, 0x00}, {0x03, 0x01, 0xf8, 0x01}
+    },
+    /* 253 */
+    {
+        {0x55, 0x01, 0xfa, 0x00}, {0x43, 0x01, 0xfa, 0x00},
+        {0x5d, 0x01, 0xfa, 0x00}, {0x02, 0x01, 0xfa, 0x01},
+        {0x55, 0x01, 0xfb, 0x00}, {0x43, 0x01, 0xfb, 0x00},
+        {0x5d, 0x01, 0xfb, 0x00}, {0x02, 0x01, 0xfb, 0x01},
+        {0x55, 0x01, 0xfc, 0x00}, {0x43, 0x01, 0xfc, 0x00},
+        {0x5d, 0x01, 0xfc, 0x00}, {0x02, 0x01, 0xfc, 0x01},
+        {0x55, 0x01, 0xfd, 0x00}, {0x43, 0x01, 0xfd, 0x00},
+        {0x5d, 0x01, 0xfd, 0x00}, {0x02, 0x01, 0xfd, 0x01}
+    },
+    /* 254 */
+    {
+        {0x56, 0x01, 0xfa, 0x00}, {0x82, 0x01, 0xfa, 0x00},
+        {0x44, 0x01, 0xfa, 0x00}, {0x52, 0x01, 0xfa, 0x00},
+        {0x63, 0x01, 0xfa, 0x00}, {0x5e, 0x01, 0xfa, 0x00},
+        {0x68, 0x01, 0xfa, 0x00}, {0x03, 0x01, 0xfa, 0x01},
+        {0x56, 0x01, 0xfb, 0x00}, {0x82, 0x01, 0xfb, 0x00},
+        {0x44, 0x01, 0xfb, 0x00}, {0x52, 0x01, 0xfb, 0x00},
+        {0x63, 0x01, 0xfb, 0x00}, {0x5e, 0x01, 0xfb, 0x00},
+        {0x68, 0x01, 0xfb, 0x00}, {0x03, 0x01, 0xfb, 0x01}
+    },
+    /* 255 */
+    {
+        {0x56, 0x01, 0xfc, 0x00}, {0x82, 0x01, 0xfc, 0x00},
+        {0x44, 0x01, 0xfc, 0x00}, {0x52, 0x01, 0xfc, 0x00},
+        {0x63, 0x01, 0xfc, 0x00}, {0x5e, 0x01, 0xfc, 0x00},
+        {0x68, 0x01, 0xfc, 0x00}, {0x03, 0x01, 0xfc, 0x01},
+        {0x56, 0x01, 0xfd, 0x00}, {0x82, 0x01, 0xfd, 0x00},
+        {0x44, 0x01, 0xfd, 0x00}, {0x52, 0x01, 0xfd, 0x00},
+        {0x63, 0x01, 0xfd, 0x00}, {0x5e, 0x01, 0xfd, 0x00},
+        {0x68, 0x01, 0xfd, 0x00}, {0x03, 0x01, 0xfd, 0x01}
+    }
+};
+
+
+ngx_int_t
+ngx_http_v2_huff_decode(u_char *state, u_char *src, size_t len, u_char **dst,
+    ngx_uint_t last, ngx_log_t *log)
+{
+    u_char  *end, ch, ending;
+
+    ch = 0;
+    ending = 1;
+
+    end = src + len;
+
+    while (src != end) {
+        ch = *src++;
+
+        if (ngx_http_v2_huff_decode_bits(state, &ending, ch >> 4, dst)
+            != NGX_OK)
+        {
+            ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
+                           "http2 huffman decoding error at state %d: "
+                           "bad code 0x%Xd", *state, ch >> 4);
+
+            return NGX_ERROR;
+        }
+
+        if (ngx_http_v2_huff_decode_bits(state, &ending, ch & 0xf, dst)
+            != NGX_OK)
+        {
+            ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
+                           "http2 huffman decoding error at state %d: "
+                           "bad code 0x%Xd", *state, ch & 0xf);
+
+            return NGX_ERROR;
+        }
+    }
+
+    if (last) {
+        if (!ending) {
+            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, log, 0,
+                           "http2 huffman decoding error: "
+                           "incomplete code 0x%Xd", ch);
+
+            return NGX_ERROR;
+        }
+
+        *state = 0;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_inline ngx_int_t
+ngx_http_v2_huff_decode_bits(u_char *state, u_char *ending, ngx_uint_t bits,
+    u_char **dst)
+{
+    ngx_http_v2_huff_decode_code_t  code;
+
+    code = ngx_http_v2_huff_decode_codes[*state][bits];
+
+    if (code.next == *state) {
+        return NGX_ERROR;
+    }
+
+    if (code.emit) {
+        **dst = code.sym;
+        (*dst)++;
+    }
+
+    *ending = code.ending;
+    *state = code.next;
+
+    return NGX_OK;
+}
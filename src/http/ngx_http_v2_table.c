@@ -0,0 +1,340 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+/* RFC 7541, section 4.1: each entry costs 32 octets in addition to data */
+#define NGX_HTTP_V2_ENTRY_OVERHEAD  32
+
+#define NGX_HTTP_V2_TABLE_ENTRIES                                             \
+    (NGX_HTTP_V2_TABLE_SIZE / NGX_HTTP_V2_ENTRY_OVERHEAD)
+
+
+static ngx_int_t ngx_http_v2_table_account(ngx_http_v2_connection_t *h2c,
+    size_t size);
+static u_char *ngx_http_v2_table_copy(ngx_http_v2_hpack_t *hpack, u_char *dst,
+    u_char *src, size_t len);
+static ngx_pool_t *ngx_http_v2_table_pool(ngx_http_v2_connection_t *h2c);
+
+
+static ngx_http_v2_header_t  ngx_http_v2_static_table[] = {
+    { ngx_string(":authority"), ngx_string("") },
+    { ngx_string(":method"), ngx_string("GET") },
+    { ngx_string(":method"), ngx_string("POST") },
+    { ngx_string(":path"), ngx_string("/") },
+    { ngx_string(":path"), ngx_string("/index.html") },
+    { ngx_string(":scheme"), ngx_string("http") },
+    { ngx_string(":scheme"), ngx_string("https") },
+    { ngx_string(":status"), ngx_string("200") },
+    { ngx_string(":status"), ngx_string("204") },
+    { ngx_string(":status"), ngx_string("206") },
+    { ngx_string(":status"), ngx_string("304") },
+    { ngx_string(":status"), ngx_string("400") },
+    { ngx_string(":status"), ngx_string("404") },
+    { ngx_string(":status"), ngx_string("500") },
+    { ngx_string("accept-charset"), ngx_string("") },
+    { ngx_string("accept-encoding"), ngx_string("gzip, deflate") },
+    { ngx_string("accept-language"), ngx_string("") },
+    { ngx_string("accept-ranges"), ngx_string("") },
+    { ngx_string("accept"), ngx_string("") },
+    { ngx_string("access-control-allow-origin"), ngx_string("") },
+    { ngx_string("age"), ngx_string("") },
+    { ngx_string("allow"), ngx_string("") },
+    { ngx_string("authorization"), ngx_string("") },
+    { ngx_string("cache-control"), ngx_string("") },
+    { ngx_string("content-disposition"), ngx_string("") },
+    { ngx_string("content-encoding"), ngx_string("") },
+    { ngx_string("content-language"), ngx_string("") },
+    { ngx_string("content-length"), ngx_string("") },
+    { ngx_string("content-location"), ngx_string("") },
+    { ngx_string("content-range"), ngx_string("") },
+    { ngx_string("content-type"), ngx_string("") },
+    { ngx_string("cookie"), ngx_string("") },
+    { ngx_string("date"), ngx_string("") },
+    { ngx_string("etag"), ngx_string("") },
+    { ngx_string("expect"), ngx_string("") },
+    { ngx_string("expires"), ngx_string("") },
+    { ngx_string("from"), ngx_string("") },
+    { ngx_string("host"), ngx_string("") },
+    { ngx_string("if-match"), ngx_string("") },
+    { ngx_string("if-modified-since"), ngx_string("") },
+    { ngx_string("if-none-match"), ngx_string("") },
+    { ngx_string("if-range"), ngx_string("") },
+    { ngx_string("if-unmodified-since"), ngx_string("") },
+    { ngx_string("last-modified"), ngx_string("") },
+    { ngx_string("link"), ngx_string("") },
+    { ngx_string("location"), ngx_string("") },
+    { ngx_string("max-forwards"), ngx_string("") },
+    { ngx_string("proxy-authenticate"), ngx_string("") },
+    { ngx_string("proxy-authorization"), ngx_string("") },
+    { ngx_string("range"), ngx_string("") },
+    { ngx_string("referer"), ngx_string("") },
+    { ngx_string("refresh"), ngx_string("") },
+    { ngx_string("retry-after"), ngx_string("") },
+    { ngx_string("server"), ngx_string("") },
+    { ngx_string("set-cookie"), ngx_string("") },
+    { ngx_string("strict-transport-security"), ngx_string("") },
+    { ngx_string("transfer-encoding"), ngx_string("") },
+    { ngx_string("user-agent"), ngx_string("") },
+    { ngx_string("vary"), ngx_string("") },
+    { ngx_string("via"), ngx_string("") },
+    { ngx_string("www-authenticate"), ngx_string("") },
+};
+
+#define NGX_HTTP_V2_STATIC_TABLE_ENTRIES                                      \
+    (sizeof(ngx_http_v2_static_table)                                         \
+     / sizeof(ngx_http_v2_header_t))
+
+
+ngx_int_t
+ngx_http_v2_get_indexed_header(ngx_http_v2_connection_t *h2c,
+    ngx_uint_t index, ngx_uint_t name_only)
+{
+    u_char                *p;
+    ngx_pool_t            *pool;
+    ngx_http_v2_header_t  *entry;
+
+    if (index == 0) {
+        ngx_log_error(NGX_LOG_INFO, h2c->connection->log, 0,
+                      "client sent invalid hpack table index 0");
+        return NGX_ERROR;
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, h2c->connection->log, 0,
+                   "http2 get indexed %s: %ui",
+                   name_only ? "name" : "header", index);
+
+    index--;
+
+    if (index < NGX_HTTP_V2_STATIC_TABLE_ENTRIES) {
+        h2c->state.header.name = ngx_http_v2_static_table[index].name;
+
+        if (!name_only) {
+            h2c->state.header.value = ngx_http_v2_static_table[index].value;
+        }
+
+        return NGX_OK;
+    }
+
+    index -= NGX_HTTP_V2_STATIC_TABLE_ENTRIES;
+
+    if (index >= h2c->hpack.added - h2c->hpack.deleted) {
+        ngx_log_error(NGX_LOG_INFO, h2c->connection->log, 0,
+                      "client sent out of bound hpack table index: %ui",
+                      index);
+        return NGX_ERROR;
+    }
+
+    /* the most recently added entry has the lowest index */
+
+    entry = &h2c->hpack.entries[(h2c->hpack.added - index - 1)
+                                % NGX_HTTP_V2_TABLE_ENTRIES];
+
+    /*
+     * The strings are copied out of the table: they may be evicted
+     * while the header is still in use.
+     */
+
+    pool = ngx_http_v2_table_pool(h2c);
+
+    p = ngx_pnalloc(pool, entry->name.len + 1);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    h2c->state.header.name.len = entry->name.len;
+    h2c->state.header.name.data = p;
+
+    p = ngx_http_v2_table_copy(&h2c->hpack, p, entry->name.data,
+                               entry->name.len);
+    *p = '\0';
+
+    if (name_only) {
+        return NGX_OK;
+    }
+
+    p = ngx_pnalloc(pool, entry->value.len + 1);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    h2c->state.header.value.len = entry->value.len;
+    h2c->state.header.value.data = p;
+
+    p = ngx_http_v2_table_copy(&h2c->hpack, p, entry->value.data,
+                               entry->value.len);
+    *p = '\0';
+
+    return NGX_OK;
+}
+
+
+ngx_int_t
+ngx_http_v2_add_header(ngx_http_v2_connection_t *h2c,
+    ngx_http_v2_header_t *header)
+{
+    u_char                *p, *end;
+    size_t                 size;
+    ngx_http_v2_header_t  *entry;
+
+    ngx_log_debug4(NGX_LOG_DEBUG_HTTP, h2c->connection->log, 0,
+                   "http2 add header to hpack table: \"%V: %V\" %uz/%uz",
+                   &header->name, &header->value,
+                   h2c->hpack.size, h2c->hpack.max);
+
+    size = header->name.len + header->value.len + NGX_HTTP_V2_ENTRY_OVERHEAD;
+
+    if (ngx_http_v2_table_account(h2c, size) != NGX_OK) {
+        /* the entry does not fit at all, the table is emptied */
+        return NGX_OK;
+    }
+
+    if (h2c->hpack.entries == NULL) {
+
+        /*
+         * The table persists across idle periods of the connection,
+         * so it is allocated from the connection pool.
+         */
+
+        h2c->hpack.entries = ngx_palloc(h2c->connection->pool,
+                                        sizeof(ngx_http_v2_header_t)
+                                        * NGX_HTTP_V2_TABLE_ENTRIES);
+        if (h2c->hpack.entries == NULL) {
+            return NGX_ERROR;
+        }
+
+        h2c->hpack.storage = ngx_pnalloc(h2c->connection->pool,
+                                         NGX_HTTP_V2_TABLE_SIZE);
+        if (h2c->hpack.storage == NULL) {
+            return NGX_ERROR;
+        }
+
+        h2c->hpack.pos = h2c->hpack.storage;
+    }
+
+    /*
+     * The strings are stored in order of addition and evicted from
+     * the oldest end, so the ring never overwrites live data: the
+     * table size accounts for at least as many octets as it stores.
+     */
+
+    entry = &h2c->hpack.entries[h2c->hpack.added % NGX_HTTP_V2_TABLE_ENTRIES];
+
+    end = h2c->hpack.storage + NGX_HTTP_V2_TABLE_SIZE;
+
+    entry->name.len = header->name.len;
+    entry->name.data = h2c->hpack.pos;
+
+    p = h2c->hpack.pos + header->name.len;
+
+    if (p >= end) {
+        ngx_memcpy(h2c->hpack.pos, header->name.data, end - h2c->hpack.pos);
+        ngx_memcpy(h2c->hpack.storage,
+                   header->name.data + (end - h2c->hpack.pos),
+                   p - end);
+        p = h2c->hpack.storage + (p - end);
+
+    } else {
+        ngx_memcpy(h2c->hpack.pos, header->name.data, header->name.len);
+    }
+
+    entry->value.len = header->value.len;
+    entry->value.data = p;
+
+    h2c->hpack.pos = p + header->value.len;
+
+    if (h2c->hpack.pos >= end) {
+        ngx_memcpy(p, header->value.data, end - p);
+        ngx_memcpy(h2c->hpack.storage, header->value.data + (end - p),
+                   h2c->hpack.pos - end);
+        h2c->hpack.pos = h2c->hpack.storage + (h2c->hpack.pos - end);
+
+    } else {
+        ngx_memcpy(p, header->value.data, header->value.len);
+    }
+
+    h2c->hpack.added++;
+    h2c->hpack.size += size;
+
+    return NGX_OK;
+}
+
+
+ngx_int_t
+ngx_http_v2_table_size(ngx_http_v2_connection_t *h2c, size_t size)
+{
+    ngx_log_debug1(NGX_LOG_DEBUG_HTTP, h2c->connection->log, 0,
+                   "http2 new hpack table size: %uz", size);
+
+    if (size > NGX_HTTP_V2_TABLE_SIZE) {
+        ngx_log_error(NGX_LOG_INFO, h2c->connection->log, 0,
+                      "client sent invalid table size update: %uz", size);
+
+        return NGX_ERROR;
+    }
+
+    h2c->hpack.max = size;
+
+    (void) ngx_http_v2_table_account(h2c, 0);
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_v2_table_account(ngx_http_v2_connection_t *h2c, size_t size)
+{
+    ngx_http_v2_header_t  *entry;
+
+    if (size > h2c->hpack.max) {
+        h2c->hpack.deleted = h2c->hpack.added;
+        h2c->hpack.size = 0;
+
+        return NGX_DECLINED;
+    }
+
+    while (h2c->hpack.size + size > h2c->hpack.max) {
+        entry = &h2c->hpack.entries[h2c->hpack.deleted++
+                                    % NGX_HTTP_V2_TABLE_ENTRIES];
+
+        h2c->hpack.size -= entry->name.len + entry->value.len
+                           + NGX_HTTP_V2_ENTRY_OVERHEAD;
+    }
+
+    return NGX_OK;
+}
+
+
+static u_char *
+ngx_http_v2_table_copy(ngx_http_v2_hpack_t *hpack, u_char *dst, u_char *src,
+    size_t len)
+{
+    size_t  rest;
+
+    rest = hpack->storage + NGX_HTTP_V2_TABLE_SIZE - src;
+
+    if (len > rest) {
+        dst = ngx_cpymem(dst, src, rest);
+        src = hpack->storage;
+        len -= rest;
+    }
+
+    return ngx_cpymem(dst, src, len);
+}
+
+
+static ngx_pool_t *
+ngx_http_v2_table_pool(ngx_http_v2_connection_t *h2c)
+{
+    if (h2c->state.stream) {
+        return h2c->state.stream->request->pool;
+    }
+
+    return h2c->state.pool;
+}
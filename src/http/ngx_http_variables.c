@@ -1943,9 +1943,12 @@ ngx_http_variable_request_body(ngx_http_request_t *r,
     ngx_buf_t    *buf;
     ngx_chain_t  *cl;
 
+    /* a spilled body would be in a temporary file without the spill store */
+
     if (r->request_body == NULL
         || r->request_body->bufs == NULL
-        || r->request_body->temp_file)
+        || r->request_body->temp_file
+        || r->request_body->spill)
     {
         v->not_found = 1;
 
@@ -49,7 +49,7 @@ ngx_calloc(size_t size, ngx_log_t *log)
 #if (NGX_HAVE_POSIX_MEMALIGN)
 /*
  * malloc只关于16字节（或8字节）对齐，如果要更大的对齐标准需要memalign或posix_memalign。
- * (关于页对齐为vmalloc，内部实现为调用 memalign(getpagesize ()/*页大小*/, size/*要申请大小*/) )
+ * (关于页对齐为vmalloc，内部实现为调用 memalign(getpagesize(), size)，前者为页大小，后者为要申请大小)
 */
 void *
 ngx_memalign(size_t alignment, size_t size, ngx_log_t *log)
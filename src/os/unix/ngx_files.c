@@ -12,6 +12,10 @@
 #if (NGX_THREADS)
 #include <ngx_thread_pool.h>
 static void ngx_thread_read_handler(void *data, ngx_log_t *log);
+#if (NGX_HAVE_PWRITEV)
+static void ngx_thread_write_chain_to_file_handler(void *data, ngx_log_t *log);
+#endif
+static void ngx_thread_rename_file_handler(void *data, ngx_log_t *log);
 #endif
 
 
@@ -170,6 +174,246 @@ ngx_thread_read_handler(void *data, ngx_log_t *log)
 
 #endif
 
+
+/*
+ * the temporary files are written and renamed using a task of the file,
+ * the chain bufs must not be changed until the write is complete
+ */
+
+typedef struct {
+    ngx_fd_t       fd;
+    ngx_chain_t   *chain;
+    off_t          offset;
+
+    u_char        *from;
+    u_char        *to;
+
+    size_t         nbytes;
+    ngx_err_t      err;
+} ngx_thread_file_ctx_t;
+
+
+#if (NGX_HAVE_PWRITEV)
+
+ssize_t
+ngx_thread_write_chain_to_file(ngx_file_t *file, ngx_chain_t *cl, off_t offset,
+    ngx_pool_t *pool)
+{
+    ngx_thread_task_t      *task;
+    ngx_thread_file_ctx_t  *ctx;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_CORE, file->log, 0,
+                   "thread write chain: %d, %p, %O",
+                   file->fd, cl, offset);
+
+    task = file->thread_task;
+
+    if (task == NULL) {
+        task = ngx_thread_task_alloc(pool, sizeof(ngx_thread_file_ctx_t));
+        if (task == NULL) {
+            return NGX_ERROR;
+        }
+
+        file->thread_task = task;
+    }
+
+    ctx = task->ctx;
+
+    if (task->event.active) {
+        return NGX_AGAIN;
+    }
+
+    if (task->event.complete) {
+        task->event.complete = 0;
+
+        if (ctx->to) {
+            ngx_log_error(NGX_LOG_ALERT, file->log, 0,
+                          "invalid thread call, rename instead of write");
+            return NGX_ERROR;
+        }
+
+        if (ctx->err) {
+            ngx_log_error(NGX_LOG_CRIT, file->log, ctx->err,
+                          "pwritev() \"%s\" failed", file->name.data);
+            return NGX_ERROR;
+        }
+
+        if (ctx->nbytes == 0) {
+            ngx_log_error(NGX_LOG_CRIT, file->log, 0,
+                          "pwritev() \"%s\" has written only partially",
+                          file->name.data);
+            return NGX_ERROR;
+        }
+
+        file->offset += ctx->nbytes;
+
+        return ctx->nbytes;
+    }
+
+    task->handler = ngx_thread_write_chain_to_file_handler;
+
+    ctx->fd = file->fd;
+    ctx->chain = cl;
+    ctx->offset = offset;
+    ctx->from = NULL;
+    ctx->to = NULL;
+
+    if (file->thread_handler(task, file) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    return NGX_AGAIN;
+}
+
+
+static void
+ngx_thread_write_chain_to_file_handler(void *data, ngx_log_t *log)
+{
+    ngx_thread_file_ctx_t *ctx = data;
+
+    u_char        *prev;
+    off_t          offset;
+    size_t         size;
+    ssize_t        n;
+    ngx_err_t      err;
+    ngx_uint_t     nelts;
+    ngx_chain_t   *cl;
+    struct iovec  *iov, iovs[NGX_IOVS_PREALLOCATE];
+
+    cl = ctx->chain;
+    offset = ctx->offset;
+
+    ctx->nbytes = 0;
+    ctx->err = 0;
+
+    do {
+        prev = NULL;
+        iov = NULL;
+        size = 0;
+        nelts = 0;
+
+        /* create the iovec and coalesce the neighbouring bufs */
+
+        while (cl && nelts < NGX_IOVS_PREALLOCATE) {
+
+            if (prev == cl->buf->pos) {
+                iov->iov_len += cl->buf->last - cl->buf->pos;
+
+            } else {
+                iov = &iovs[nelts++];
+
+                iov->iov_base = (void *) cl->buf->pos;
+                iov->iov_len = cl->buf->last - cl->buf->pos;
+            }
+
+            size += cl->buf->last - cl->buf->pos;
+            prev = cl->buf->last;
+            cl = cl->next;
+        }
+
+eintr:
+
+        n = pwritev(ctx->fd, iovs, nelts, offset);
+
+        if (n == -1) {
+            err = ngx_errno;
+
+            if (err == NGX_EINTR) {
+                goto eintr;
+            }
+
+            ctx->err = err;
+            return;
+        }
+
+        ngx_log_debug3(NGX_LOG_DEBUG_CORE, log, 0,
+                       "pwritev: %d, %z of %uz", ctx->fd, n, size);
+
+        if ((size_t) n != size) {
+            ctx->nbytes = 0;
+            return;
+        }
+
+        ctx->nbytes += n;
+        offset += n;
+
+    } while (cl);
+}
+
+#endif
+
+
+ngx_int_t
+ngx_thread_rename_file(ngx_file_t *file, u_char *to, ngx_pool_t *pool)
+{
+    ngx_thread_task_t      *task;
+    ngx_thread_file_ctx_t  *ctx;
+
+    ngx_log_debug2(NGX_LOG_DEBUG_CORE, file->log, 0,
+                   "thread rename: \"%s\" to \"%s\"", file->name.data, to);
+
+    task = file->thread_task;
+
+    if (task == NULL) {
+        task = ngx_thread_task_alloc(pool, sizeof(ngx_thread_file_ctx_t));
+        if (task == NULL) {
+            return NGX_ERROR;
+        }
+
+        file->thread_task = task;
+    }
+
+    ctx = task->ctx;
+
+    if (task->event.active) {
+        return NGX_AGAIN;
+    }
+
+    if (task->event.complete) {
+        task->event.complete = 0;
+
+        if (ctx->to != to) {
+            ngx_log_error(NGX_LOG_ALERT, file->log, 0,
+                          "invalid thread call, write instead of rename");
+            return NGX_ERROR;
+        }
+
+        if (ctx->err) {
+            ngx_set_errno(ctx->err);
+            return NGX_ERROR;
+        }
+
+        return NGX_OK;
+    }
+
+    task->handler = ngx_thread_rename_file_handler;
+
+    ctx->from = file->name.data;
+    ctx->to = to;
+
+    if (file->thread_handler(task, file) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    return NGX_AGAIN;
+}
+
+
+static void
+ngx_thread_rename_file_handler(void *data, ngx_log_t *log)
+{
+    ngx_thread_file_ctx_t *ctx = data;
+
+    ngx_log_debug0(NGX_LOG_DEBUG_CORE, log, 0, "thread rename handler");
+
+    if (ngx_rename_file(ctx->from, ctx->to) == NGX_FILE_ERROR) {
+        ctx->err = ngx_errno;
+
+    } else {
+        ctx->err = 0;
+    }
+}
+
 #endif /* NGX_THREADS */
 
 
@@ -386,6 +386,12 @@ extern ngx_uint_t  ngx_file_aio;
 #if (NGX_THREADS)
 ssize_t ngx_thread_read(ngx_thread_task_t **taskp, ngx_file_t *file,
     u_char *buf, size_t size, off_t offset, ngx_pool_t *pool);
+#if (NGX_HAVE_PWRITEV)
+ssize_t ngx_thread_write_chain_to_file(ngx_file_t *file, ngx_chain_t *cl,
+    off_t offset, ngx_pool_t *pool);
+#endif
+ngx_int_t ngx_thread_rename_file(ngx_file_t *file, u_char *to,
+    ngx_pool_t *pool);
 #endif
 
 
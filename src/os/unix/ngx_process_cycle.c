@@ -25,10 +25,12 @@ static void ngx_worker_process_exit(ngx_cycle_t *cycle);
 static void ngx_channel_handler(ngx_event_t *ev);
 static void ngx_cache_manager_process_cycle(ngx_cycle_t *cycle, void *data);
 static void ngx_cache_manager_process_handler(ngx_event_t *ev);
+static void ngx_cache_manager_process_exit(ngx_cycle_t *cycle);
 static void ngx_cache_loader_process_handler(ngx_event_t *ev);
 
 
 ngx_uint_t    ngx_process;
+ngx_uint_t    ngx_worker;
 ngx_pid_t     ngx_pid;
 
 sig_atomic_t  ngx_reap;
@@ -354,6 +356,10 @@ ngx_single_process_cycle(ngx_cycle_t *cycle)
             ngx_reopen = 0;
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "reopening logs");
             ngx_reopen_files(cycle, (ngx_uid_t) -1);
+
+#if (NGX_PCRE)
+            ngx_regex_profile_log(cycle->log);
+#endif
         }
     }
 }
@@ -761,6 +767,7 @@ ngx_worker_process_cycle(ngx_cycle_t *cycle, void *data)
     ngx_connection_t  *c;
 
     ngx_process = NGX_PROCESS_WORKER;
+    ngx_worker = worker;
 
     /*
      * 初始化 worker 线程:设置系统配置,切换用户，设置cpu亲和性，屏蔽信号，
@@ -793,8 +800,7 @@ ngx_worker_process_cycle(ngx_cycle_t *cycle, void *data)
 
             ngx_event_cancel_timers();
 
-            if (ngx_event_timer_rbtree.root == ngx_event_timer_rbtree.sentinel)
-            {
+            if (ngx_event_no_timers_left() == NGX_OK) {
                 ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "exiting");
 
                 ngx_worker_process_exit(cycle);
@@ -834,6 +840,10 @@ ngx_worker_process_cycle(ngx_cycle_t *cycle, void *data)
             ngx_reopen = 0;
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "reopening logs");
             ngx_reopen_files(cycle, -1);
+
+#if (NGX_PCRE)
+            ngx_regex_profile_log(cycle->log);
+#endif
         }
     }
 }
@@ -946,6 +956,8 @@ ngx_worker_process_init(ngx_cycle_t *cycle, ngx_int_t worker)
 
 #endif
 
+    ngx_pool_cache_init(ccf->pool_cache);
+
     /* 修改工作目录 */
     if (ccf->working_directory.len) {
         if (chdir((char *) ccf->working_directory.data) == -1) {
@@ -1082,6 +1094,8 @@ ngx_worker_process_exit(ngx_cycle_t *cycle)
 
     ngx_destroy_pool(cycle->pool);
 
+    ngx_pool_cache_log(ngx_cycle->log);
+
     ngx_log_error(NGX_LOG_NOTICE, ngx_cycle->log, 0, "exit");
 
     exit(0);
@@ -1212,6 +1226,11 @@ ngx_cache_manager_process_cycle(ngx_cycle_t *cycle, void *data)
     for ( ;; ) {
 
         if (ngx_terminate || ngx_quit) {
+
+            if (ngx_quit && ctx == &ngx_cache_manager_ctx) {
+                ngx_cache_manager_process_exit(cycle);
+            }
+
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "exiting");
             exit(0);
         }
@@ -1256,6 +1275,25 @@ ngx_cache_manager_process_handler(ngx_event_t *ev)
 }
 
 
+static void
+ngx_cache_manager_process_exit(ngx_cycle_t *cycle)
+{
+    ngx_uint_t    i;
+    ngx_path_t  **path;
+
+    /* the paths may save their state for the next start */
+
+    path = cycle->paths.elts;
+    for (i = 0; i < cycle->paths.nelts; i++) {
+
+        if (path[i]->saver) {
+            path[i]->saver(path[i]->data);
+            ngx_time_update();
+        }
+    }
+}
+
+
 static void
 ngx_cache_loader_process_handler(ngx_event_t *ev)
 {